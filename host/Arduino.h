@@ -0,0 +1,299 @@
+#pragma once
+
+// ---------------------------------------------------------------------------
+// Host (Linux) stand-in for the parts of the Arduino-ESP32 core the UI modules
+// use: timing, logging, PROGMEM access, String and Print. Only on the include
+// path of [env:native] — see host/TFT_eSPI.h.
+// ---------------------------------------------------------------------------
+
+#include <ctype.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+
+using std::max;
+using std::min;
+
+#define PI      3.1415926535897932384626433832795
+#define HIGH    1
+#define LOW     0
+#define PROGMEM
+#define IRAM_ATTR
+
+#define pgm_read_byte( addr )  ( *( const uint8_t * )( addr ) )
+#define pgm_read_word( addr )  ( *( const uint16_t * )( addr ) )
+#define pgm_read_dword( addr ) ( *( const uint32_t * )( addr ) )
+
+#define constrain( amt, low, high ) ( ( amt ) < ( low ) ? ( low ) : ( ( amt ) > ( high ) ? ( high ) : ( amt ) ) )
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+// --- Timing ---------------------------------------------------------------
+
+inline std::chrono::steady_clock::time_point hostEpoch() {
+    static const auto t0 = std::chrono::steady_clock::now();
+    return t0;
+}
+
+inline unsigned long micros() {
+    return ( unsigned long )std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - hostEpoch() ).count();
+}
+
+inline unsigned long millis() {
+    return micros() / 1000UL;
+}
+
+inline void delay( unsigned long ms ) {
+    std::this_thread::sleep_for( std::chrono::milliseconds( ms ) );
+}
+
+inline void yield() {}
+
+// Wall clock — fixed so renders repeat; scenes set hostTime (local time is
+// whatever TZ says, the renderer runs in UTC)
+inline struct timeval hostTime = { 1760877937, 500000 };   // 2025-10-19 12:45:37.5
+
+inline bool getLocalTime( struct tm *info, uint32_t = 5000 ) {
+    time_t t = hostTime.tv_sec;
+    localtime_r( &t, info );
+    return true;
+}
+
+inline long map( long x, long inMin, long inMax, long outMin, long outMax ) {
+    return ( x - inMin ) * ( outMax - outMin ) / ( inMax - inMin ) + outMin;
+}
+
+// --- Logging (same levels as the ESP32 core; stderr keeps stdout for reports) ---
+
+#ifndef CORE_DEBUG_LEVEL
+#define CORE_DEBUG_LEVEL 3
+#endif
+
+#define HOST_LOG( level, format, ... ) fprintf( stderr, "[" level "] " format "\n", ##__VA_ARGS__ )
+
+#if CORE_DEBUG_LEVEL >= 1
+#define log_e( format, ... ) HOST_LOG( "E", format, ##__VA_ARGS__ )
+#else
+#define log_e( format, ... ) do {} while ( 0 )
+#endif
+#if CORE_DEBUG_LEVEL >= 2
+#define log_w( format, ... ) HOST_LOG( "W", format, ##__VA_ARGS__ )
+#else
+#define log_w( format, ... ) do {} while ( 0 )
+#endif
+#if CORE_DEBUG_LEVEL >= 3
+#define log_i( format, ... ) HOST_LOG( "I", format, ##__VA_ARGS__ )
+#else
+#define log_i( format, ... ) do {} while ( 0 )
+#endif
+#if CORE_DEBUG_LEVEL >= 4
+#define log_d( format, ... ) HOST_LOG( "D", format, ##__VA_ARGS__ )
+#else
+#define log_d( format, ... ) do {} while ( 0 )
+#endif
+
+// --- String (the subset the firmware uses, backed by std::string) ----------
+
+class String {
+public:
+    String( const char *s = "" ) : s( s != nullptr ? s : "" ) {}
+    String( const std::string &s ) : s( s ) {}
+    explicit String( char c ) : s( 1, c ) {}
+    String( int v ) : s( std::to_string( v ) ) {}
+    String( unsigned int v ) : s( std::to_string( v ) ) {}
+    String( long v ) : s( std::to_string( v ) ) {}
+    String( unsigned long v ) : s( std::to_string( v ) ) {}
+    String( double v, unsigned int decimals = 2 ) {
+        char buf[ 48 ];
+        snprintf( buf, sizeof( buf ), "%.*f", ( int )decimals, v );
+        s = buf;
+    }
+
+    const char *c_str() const {
+        return s.c_str();
+    }
+    unsigned int length() const {
+        return ( unsigned int )s.length();
+    }
+    bool isEmpty() const {
+        return s.empty();
+    }
+    char charAt( unsigned int i ) const {
+        return i < s.length() ? s[ i ] : '\0';
+    }
+    char operator[]( unsigned int i ) const {
+        return charAt( i );
+    }
+
+    String substring( unsigned int from ) const {
+        return from < s.length() ? String( s.substr( from ) ) : String();
+    }
+    String substring( unsigned int from, unsigned int to ) const {
+        if ( from > to ) {
+            std::swap( from, to );
+        }
+        return from < s.length() ? String( s.substr( from, to - from ) ) : String();
+    }
+    int indexOf( char c, unsigned int from = 0 ) const {
+        size_t p = s.find( c, from );
+        return p == std::string::npos ? -1 : ( int )p;
+    }
+    int indexOf( const String &str, unsigned int from = 0 ) const {
+        size_t p = s.find( str.s, from );
+        return p == std::string::npos ? -1 : ( int )p;
+    }
+    bool startsWith( const String &str ) const {
+        return s.compare( 0, str.s.length(), str.s ) == 0;
+    }
+    bool endsWith( const String &str ) const {
+        return s.length() >= str.s.length() && s.compare( s.length() - str.s.length(), str.s.length(), str.s ) == 0;
+    }
+    long toInt() const {
+        return atol( s.c_str() );
+    }
+    float toFloat() const {
+        return ( float )atof( s.c_str() );
+    }
+    bool reserve( unsigned int size ) {
+        s.reserve( size );
+        return true;
+    }
+    void remove( unsigned int index, unsigned int count = ( unsigned int )-1 ) {
+        if ( index < s.length() ) {
+            s.erase( index, count );
+        }
+    }
+    void trim() {
+        size_t a = s.find_first_not_of( " \t\r\n" );
+        size_t b = s.find_last_not_of( " \t\r\n" );
+        s        = a == std::string::npos ? std::string() : s.substr( a, b - a + 1 );
+    }
+    void toUpperCase() {
+        for ( char &c : s ) {
+            c = ( char )toupper( ( unsigned char )c );
+        }
+    }
+    void toLowerCase() {
+        for ( char &c : s ) {
+            c = ( char )tolower( ( unsigned char )c );
+        }
+    }
+
+    String &operator+=( const String &rhs ) {
+        s += rhs.s;
+        return *this;
+    }
+    String &operator+=( const char *rhs ) {
+        s += rhs;
+        return *this;
+    }
+    String &operator+=( char rhs ) {
+        s += rhs;
+        return *this;
+    }
+    bool operator==( const String &rhs ) const {
+        return s == rhs.s;
+    }
+    bool operator==( const char *rhs ) const {
+        return s == rhs;
+    }
+    bool operator!=( const String &rhs ) const {
+        return s != rhs.s;
+    }
+    bool operator!=( const char *rhs ) const {
+        return s != rhs;
+    }
+    bool operator<( const String &rhs ) const {
+        return s < rhs.s;
+    }
+
+private:
+    std::string s;
+};
+
+inline String operator+( const String &a, const String &b ) {
+    String r( a );
+    r += b;
+    return r;
+}
+
+inline String operator+( const String &a, const char *b ) {
+    String r( a );
+    r += b;
+    return r;
+}
+
+inline String operator+( const char *a, const String &b ) {
+    String r( a );
+    r += b;
+    return r;
+}
+
+inline String operator+( const String &a, char b ) {
+    String r( a );
+    r += b;
+    return r;
+}
+
+// --- Print -----------------------------------------------------------------
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write( uint8_t c ) = 0;
+
+    size_t write( const uint8_t *buf, size_t len ) {
+        size_t n = 0;
+        while ( len-- ) {
+            n += write( *buf++ );
+        }
+        return n;
+    }
+    size_t print( const char *str ) {
+        return write( ( const uint8_t * )str, strlen( str ) );
+    }
+    size_t print( const String &str ) {
+        return print( str.c_str() );
+    }
+    size_t print( char c ) {
+        return write( ( uint8_t )c );
+    }
+    size_t print( long v ) {
+        return print( String( v ) );
+    }
+    size_t print( int v ) {
+        return print( String( v ) );
+    }
+    size_t print( unsigned long v ) {
+        return print( String( v ) );
+    }
+    size_t print( double v, int decimals = 2 ) {
+        return print( String( v, decimals ) );
+    }
+    size_t println() {
+        return print( "\n" );
+    }
+    template <typename T> size_t println( const T &v ) {
+        size_t n = print( v );
+        return n + println();
+    }
+    size_t printf( const char *format, ... ) __attribute__( ( format( printf, 2, 3 ) ) ) {
+        char    buf[ 256 ];
+        va_list args;
+        va_start( args, format );
+        vsnprintf( buf, sizeof( buf ), format, args );
+        va_end( args );
+        return print( buf );
+    }
+};
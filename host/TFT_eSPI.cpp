@@ -0,0 +1,1857 @@
+#include "TFT_eSPI.h"
+
+#include <vector>
+
+// Font data straight from the TFT_eSPI library
+#include <Fonts/glcdfont.c>
+#include <Fonts/Font16.h>
+#include <Fonts/Font32rle.h>
+#include <Fonts/Font64rle.h>
+#include <Fonts/Font7srle.h>
+#include <Fonts/Font72rle.h>
+
+// ---------------------------------------------------------------------------
+
+const char *const HOST_PRIM_NAMES[ HOST_PRIM_COUNT ] = {
+    "px", "hline", "vline", "line", "rect", "rrect", "circle", "tri", "smooth", "text", "bitmap", "image"
+};
+
+struct HostFontInfo {
+    const unsigned char *const *chartbl;
+    const unsigned char        *widthtbl;
+    uint8_t                     height;
+    uint8_t                     baseline;
+};
+
+// Same slots as TFT_eSPI's fontdata[]: 1 = GLCD, 3 and 5 unused
+static const HostFontInfo FONTS[ 9 ] = {
+    { nullptr, nullptr, 0, 0 },
+    { nullptr, nullptr, 8, 7 },
+    { chrtbl_f16, widtbl_f16, chr_hgt_f16, baseline_f16 },
+    { nullptr, nullptr, 0, 0 },
+    { chrtbl_f32, widtbl_f32, chr_hgt_f32, baseline_f32 },
+    { nullptr, nullptr, 0, 0 },
+    { chrtbl_f64, widtbl_f64, chr_hgt_f64, baseline_f64 },
+    { chrtbl_f7s, widtbl_f7s, chr_hgt_f7s, baseline_f7s },
+    { chrtbl_f72, widtbl_f72, chr_hgt_f72, baseline_f72 },
+};
+
+static const uint16_t DEFAULT_4BIT_PALETTE[ 16 ] = {
+    TFT_BLACK, TFT_BROWN, TFT_RED, TFT_ORANGE, TFT_YELLOW, TFT_GREEN, TFT_BLUE, TFT_PURPLE,
+    TFT_DARKGREY, TFT_WHITE, TFT_CYAN, TFT_MAGENTA, TFT_MAROON, TFT_DARKGREEN, TFT_NAVY, TFT_PINK
+};
+
+static constexpr float LO_ALPHA = 1.0f / 32.0f;   // TFT_eSPI's smooth-graphics thresholds
+static constexpr float HI_ALPHA = 1.0f - LO_ALPHA;
+
+static inline uint16_t swap16( uint16_t c ) {
+    return ( uint16_t )( ( c >> 8 ) | ( c << 8 ) );
+}
+
+// Counts a primitive once, however many leaves it is built from
+struct HostCall {
+    HostCall( TFT_eSPI *t, HostPrim kind ) : t( t ) {
+        if ( t->callDepth++ == 0 ) {
+            t->counters.calls[ kind ]++;
+        }
+    }
+    ~HostCall() {
+        t->callDepth--;
+    }
+    TFT_eSPI *t;
+};
+
+// UTF-8 decoder matching TFT_eSPI's (1 to 3 byte sequences)
+static uint16_t decodeUTF8( const uint8_t *buf, uint16_t *index, uint16_t remaining ) {
+    uint16_t c = buf[ ( *index )++ ];
+    if ( ( c & 0x80 ) == 0x00 ) {
+        return c;
+    }
+    if ( ( c & 0xE0 ) == 0xC0 && remaining > 1 ) {
+        return ( ( c & 0x1F ) << 6 ) | ( buf[ ( *index )++ ] & 0x3F );
+    }
+    if ( ( c & 0xF0 ) == 0xE0 && remaining > 2 ) {
+        c = ( ( c & 0x0F ) << 12 ) | ( ( buf[ *index ] & 0x3F ) << 6 );
+        ( *index )++;
+        c = c | ( buf[ ( *index )++ ] & 0x3F );
+        return c;
+    }
+    return c;
+}
+
+// ---------------------------------------------------------------------------
+// Setup, frame storage and clipping
+// ---------------------------------------------------------------------------
+
+TFT_eSPI::TFT_eSPI( int16_t w, int16_t h ) {
+    _init_width  = _width  = w;
+    _init_height = _height = h;
+    rotation     = 0;
+    cursor_x     = cursor_y = padX = 0;
+    textfont     = 1;
+    textsize     = 1;
+    textdatum    = TL_DATUM;
+    textcolor    = bitmap_fg = TFT_WHITE;
+    textbgcolor  = bitmap_bg = TFT_BLACK;
+    gfxFont      = nullptr;
+    glyph_ab     = glyph_bb = 0;
+    _swapBytes   = false;
+    _invert      = false;
+    textwrapX    = true;
+    textwrapY    = false;
+    _frame       = nullptr;
+    callDepth    = 0;
+    hostResetCounters();
+    resetViewport();
+}
+
+TFT_eSPI::~TFT_eSPI() {
+    free( _frame );
+}
+
+void TFT_eSPI::init( uint8_t ) {
+    setRotation( rotation );
+}
+
+void TFT_eSPI::begin( uint8_t tc ) {
+    init( tc );
+}
+
+void TFT_eSPI::allocFrame() {
+    _frame = ( uint16_t * )calloc( ( size_t )_width * _height, sizeof( uint16_t ) );
+}
+
+void TFT_eSPI::hostFill( int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color ) {
+    if ( _frame == nullptr ) {
+        allocFrame();
+    }
+    for ( int32_t j = 0; j < h; j++ ) {
+        uint16_t *p = _frame + ( y + j ) * _width + x;
+        for ( int32_t i = 0; i < w; i++ ) {
+            p[ i ] = color;
+        }
+    }
+}
+
+void TFT_eSPI::hostWriteRow( int32_t x, int32_t y, int32_t w, const uint16_t *colors ) {
+    if ( _frame == nullptr ) {
+        allocFrame();
+    }
+    memcpy( _frame + y * _width + x, colors, w * sizeof( uint16_t ) );
+}
+
+uint16_t TFT_eSPI::hostRead( int32_t x, int32_t y ) {
+    return _frame != nullptr ? _frame[ y * _width + x ] : 0;
+}
+
+bool TFT_eSPI::clipRect( int32_t &x, int32_t &y, int32_t &w, int32_t &h ) {
+    if ( _vpOoB ) {
+        return false;
+    }
+    x += _xDatum;
+    y += _yDatum;
+    if ( x < _vpX ) {
+        w += x - _vpX;
+        x  = _vpX;
+    }
+    if ( y < _vpY ) {
+        h += y - _vpY;
+        y  = _vpY;
+    }
+    if ( x + w > _vpW ) {
+        w = _vpW - x;
+    }
+    if ( y + h > _vpH ) {
+        h = _vpH - y;
+    }
+    return w > 0 && h > 0;
+}
+
+bool TFT_eSPI::clipImage( int32_t &x, int32_t &y, int32_t &w, int32_t &h, int32_t &dx, int32_t &dy ) {
+    int32_t x0 = x + _xDatum;
+    int32_t y0 = y + _yDatum;
+    if ( !clipRect( x, y, w, h ) ) {
+        return false;
+    }
+    dx = x - x0;
+    dy = y - y0;
+    return true;
+}
+
+void TFT_eSPI::countWindow( uint32_t px ) {
+    counters.windows++;
+    counters.pixels += px;
+}
+
+void TFT_eSPI::hostResetCounters() {
+    memset( &counters, 0, sizeof( counters ) );
+}
+
+void TFT_eSPI::setRotation( uint8_t r ) {
+    rotation = r & 3;
+    int32_t w = ( rotation & 1 ) ? _init_height : _init_width;
+    int32_t h = ( rotation & 1 ) ? _init_width : _init_height;
+    if ( w != _width || h != _height ) {
+        free( _frame );
+        _frame  = nullptr;
+        _width  = w;
+        _height = h;
+    }
+    resetViewport();
+}
+
+uint8_t TFT_eSPI::getRotation( void ) {
+    return rotation;
+}
+
+void TFT_eSPI::invertDisplay( bool i ) {
+    _invert = i;
+}
+
+int16_t TFT_eSPI::width( void ) {
+    return _vpDatum ? _xWidth : _width;
+}
+
+int16_t TFT_eSPI::height( void ) {
+    return _vpDatum ? _yHeight : _height;
+}
+
+// ---------------------------------------------------------------------------
+// Viewport
+// ---------------------------------------------------------------------------
+
+void TFT_eSPI::setViewport( int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum ) {
+    _xDatum  = x;
+    _yDatum  = y;
+    _xWidth  = w;
+    _yHeight = h;
+    _vpX     = max( x, ( int32_t )0 );
+    _vpY     = max( y, ( int32_t )0 );
+    _vpW     = min( x + w, _width );
+    _vpH     = min( y + h, _height );
+    _vpDatum = vpDatum;
+    _vpOoB   = _vpX >= _vpW || _vpY >= _vpH;
+    if ( !vpDatum ) {
+        _xDatum  = 0;
+        _yDatum  = 0;
+        _xWidth  = _width;
+        _yHeight = _height;
+    }
+}
+
+bool TFT_eSPI::checkViewport( int32_t x, int32_t y, int32_t w, int32_t h ) {
+    return clipRect( x, y, w, h );
+}
+
+int32_t TFT_eSPI::getViewportX( void ) {
+    return _xDatum;
+}
+
+int32_t TFT_eSPI::getViewportY( void ) {
+    return _yDatum;
+}
+
+int32_t TFT_eSPI::getViewportWidth( void ) {
+    return _xWidth;
+}
+
+int32_t TFT_eSPI::getViewportHeight( void ) {
+    return _yHeight;
+}
+
+bool TFT_eSPI::getViewportDatum( void ) {
+    return _vpDatum;
+}
+
+void TFT_eSPI::frameViewport( uint16_t color, int32_t w ) {
+    // Positive w frames the inside edge of the viewport
+    int32_t x0 = _vpX - _xDatum;
+    int32_t y0 = _vpY - _yDatum;
+    int32_t vw = _vpW - _vpX;
+    int32_t vh = _vpH - _vpY;
+    if ( w <= 0 ) {
+        return;
+    }
+    fillRect( x0, y0, vw, w, color );
+    fillRect( x0, y0 + vh - w, vw, w, color );
+    fillRect( x0, y0 + w, w, vh - 2 * w, color );
+    fillRect( x0 + vw - w, y0 + w, w, vh - 2 * w, color );
+}
+
+void TFT_eSPI::resetViewport( void ) {
+    _xDatum  = 0;
+    _yDatum  = 0;
+    _vpX     = 0;
+    _vpY     = 0;
+    _vpW     = _width;
+    _vpH     = _height;
+    _xWidth  = _width;
+    _yHeight = _height;
+    _vpDatum = false;
+    _vpOoB   = false;
+}
+
+// ---------------------------------------------------------------------------
+// Leaves
+// ---------------------------------------------------------------------------
+
+void TFT_eSPI::drawPixel( int32_t x, int32_t y, uint32_t color ) {
+    HostCall call( this, HOST_PIXEL );
+    int32_t  w = 1, h = 1;
+    if ( clipRect( x, y, w, h ) ) {
+        hostFill( x, y, 1, 1, color );
+        countWindow( 1 );
+    }
+}
+
+void TFT_eSPI::drawFastHLine( int32_t x, int32_t y, int32_t w, uint32_t color ) {
+    HostCall call( this, HOST_HLINE );
+    int32_t  h = 1;
+    if ( clipRect( x, y, w, h ) ) {
+        hostFill( x, y, w, 1, color );
+        countWindow( w );
+    }
+}
+
+void TFT_eSPI::drawFastVLine( int32_t x, int32_t y, int32_t h, uint32_t color ) {
+    HostCall call( this, HOST_VLINE );
+    int32_t  w = 1;
+    if ( clipRect( x, y, w, h ) ) {
+        hostFill( x, y, 1, h, color );
+        countWindow( h );
+    }
+}
+
+void TFT_eSPI::fillRect( int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color ) {
+    HostCall call( this, HOST_RECT );
+    if ( clipRect( x, y, w, h ) ) {
+        hostFill( x, y, w, h, color );
+        countWindow( ( uint32_t )( w * h ) );
+    }
+}
+
+uint16_t TFT_eSPI::readPixel( int32_t x, int32_t y ) {
+    int32_t w = 1, h = 1;
+    return clipRect( x, y, w, h ) ? hostRead( x, y ) : 0;
+}
+
+// Bresenham, emitting each horizontal/vertical run as one leaf call
+void TFT_eSPI::drawLine( int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color ) {
+    HostCall call( this, HOST_LINE );
+    bool     steep = abs( y1 - y0 ) > abs( x1 - x0 );
+    if ( steep ) {
+        std::swap( x0, y0 );
+        std::swap( x1, y1 );
+    }
+    if ( x0 > x1 ) {
+        std::swap( x0, x1 );
+        std::swap( y0, y1 );
+    }
+
+    int32_t dx    = x1 - x0;
+    int32_t dy    = abs( y1 - y0 );
+    int32_t err   = dx >> 1;
+    int32_t ystep = y0 < y1 ? 1 : -1;
+    int32_t xs    = x0;
+    int32_t dlen  = 0;
+    for ( ; x0 <= x1; x0++ ) {
+        dlen++;
+        err -= dy;
+        if ( err < 0 ) {
+            if ( dlen == 1 ) {
+                steep ? drawPixel( y0, xs, color ) : drawPixel( xs, y0, color );
+            }
+            else {
+                steep ? drawFastVLine( y0, xs, dlen, color ) : drawFastHLine( xs, y0, dlen, color );
+            }
+            dlen = 0;
+            y0  += ystep;
+            xs   = x0 + 1;
+            err += dx;
+        }
+    }
+    if ( dlen ) {
+        steep ? drawFastVLine( y0, xs, dlen, color ) : drawFastHLine( xs, y0, dlen, color );
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Shapes
+// ---------------------------------------------------------------------------
+
+void TFT_eSPI::fillScreen( uint32_t color ) {
+    HostCall call( this, HOST_RECT );
+    fillRect( 0, 0, _width, _height, color );
+}
+
+void TFT_eSPI::drawRect( int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color ) {
+    HostCall call( this, HOST_RECT );
+    drawFastHLine( x, y, w, color );
+    drawFastHLine( x, y + h - 1, w, color );
+    drawFastVLine( x, y + 1, h - 2, color );
+    drawFastVLine( x + w - 1, y + 1, h - 2, color );
+}
+
+void TFT_eSPI::drawRoundRect( int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color ) {
+    HostCall call( this, HOST_ROUNDRECT );
+    drawFastHLine( x + r, y, w - r - r, color );
+    drawFastHLine( x + r, y + h - 1, w - r - r, color );
+    drawFastVLine( x, y + r, h - r - r, color );
+    drawFastVLine( x + w - 1, y + r, h - r - r, color );
+    drawCircleHelper( x + r, y + r, r, 1, color );
+    drawCircleHelper( x + w - r - 1, y + r, r, 2, color );
+    drawCircleHelper( x + w - r - 1, y + h - r - 1, r, 4, color );
+    drawCircleHelper( x + r, y + h - r - 1, r, 8, color );
+}
+
+void TFT_eSPI::fillRoundRect( int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color ) {
+    HostCall call( this, HOST_ROUNDRECT );
+    fillRect( x, y + r, w, h - r - r, color );
+    fillCircleHelper( x + r, y + h - r - 1, r, 1, w - r - r - 1, color );
+    fillCircleHelper( x + r, y + r, r, 2, w - r - r - 1, color );
+}
+
+void TFT_eSPI::fillRectVGradient( int16_t x, int16_t y, int16_t w, int16_t h, uint32_t color1, uint32_t color2 ) {
+    HostCall call( this, HOST_RECT );
+    float    delta = -255.0f / h;
+    float    alpha = 255.0f;
+    uint32_t color = color1;
+    while ( h-- > 0 ) {
+        drawFastHLine( x, y++, w, color );
+        alpha += delta;
+        color  = alphaBlend( ( uint8_t )alpha, color1, color2 );
+    }
+}
+
+void TFT_eSPI::fillRectHGradient( int16_t x, int16_t y, int16_t w, int16_t h, uint32_t color1, uint32_t color2 ) {
+    HostCall call( this, HOST_RECT );
+    float    delta = -255.0f / w;
+    float    alpha = 255.0f;
+    uint32_t color = color1;
+    while ( w-- > 0 ) {
+        drawFastVLine( x++, y, h, color );
+        alpha += delta;
+        color  = alphaBlend( ( uint8_t )alpha, color1, color2 );
+    }
+}
+
+void TFT_eSPI::drawCircle( int32_t x0, int32_t y0, int32_t r, uint32_t color ) {
+    HostCall call( this, HOST_CIRCLE );
+    if ( r <= 0 ) {
+        return;
+    }
+    int32_t x  = 1;
+    int32_t dx = 1;
+    int32_t dy = r + r;
+    int32_t p  = -( r >> 1 );
+
+    drawPixel( x0 + r, y0, color );
+    drawPixel( x0 - r, y0, color );
+    drawPixel( x0, y0 - r, color );
+    drawPixel( x0, y0 + r, color );
+    while ( x < r ) {
+        if ( p >= 0 ) {
+            dy -= 2;
+            p  -= dy;
+            r--;
+        }
+        dx += 2;
+        p  += dx;
+        drawPixel( x0 + x, y0 + r, color );
+        drawPixel( x0 - x, y0 + r, color );
+        drawPixel( x0 - x, y0 - r, color );
+        drawPixel( x0 + x, y0 - r, color );
+        if ( r != x ) {
+            drawPixel( x0 + r, y0 + x, color );
+            drawPixel( x0 - r, y0 + x, color );
+            drawPixel( x0 - r, y0 - x, color );
+            drawPixel( x0 + r, y0 - x, color );
+        }
+        x++;
+    }
+}
+
+void TFT_eSPI::drawCircleHelper( int32_t x0, int32_t y0, int32_t r, uint8_t cornername, uint32_t color ) {
+    HostCall call( this, HOST_CIRCLE );
+    int32_t  f     = 1 - r;
+    int32_t  ddF_x = 1;
+    int32_t  ddF_y = -2 * r;
+    int32_t  x     = 0;
+    int32_t  y     = r;
+    while ( x < y ) {
+        if ( f >= 0 ) {
+            y--;
+            ddF_y += 2;
+            f     += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f     += ddF_x;
+        if ( cornername & 0x4 ) {
+            drawPixel( x0 + x, y0 + y, color );
+            drawPixel( x0 + y, y0 + x, color );
+        }
+        if ( cornername & 0x2 ) {
+            drawPixel( x0 + x, y0 - y, color );
+            drawPixel( x0 + y, y0 - x, color );
+        }
+        if ( cornername & 0x8 ) {
+            drawPixel( x0 - y, y0 + x, color );
+            drawPixel( x0 - x, y0 + y, color );
+        }
+        if ( cornername & 0x1 ) {
+            drawPixel( x0 - y, y0 - x, color );
+            drawPixel( x0 - x, y0 - y, color );
+        }
+    }
+}
+
+void TFT_eSPI::fillCircle( int32_t x0, int32_t y0, int32_t r, uint32_t color ) {
+    HostCall call( this, HOST_CIRCLE );
+    int32_t  x  = 0;
+    int32_t  dx = 1;
+    int32_t  dy = r + r;
+    int32_t  p  = -( r >> 1 );
+
+    drawFastHLine( x0 - r, y0, dy + 1, color );
+    while ( x < r ) {
+        if ( p >= 0 ) {
+            drawFastHLine( x0 - x, y0 + r, 2 * x + 1, color );
+            drawFastHLine( x0 - x, y0 - r, 2 * x + 1, color );
+            dy -= 2;
+            p  -= dy;
+            r--;
+        }
+        dx += 2;
+        p  += dx;
+        x++;
+        drawFastHLine( x0 - r, y0 + x, 2 * r + 1, color );
+        drawFastHLine( x0 - r, y0 - x, 2 * r + 1, color );
+    }
+}
+
+void TFT_eSPI::fillCircleHelper( int32_t x0, int32_t y0, int32_t r, uint8_t cornername, int32_t delta, uint32_t color ) {
+    HostCall call( this, HOST_CIRCLE );
+    int32_t  f     = 1 - r;
+    int32_t  ddF_x = 1;
+    int32_t  ddF_y = -r - r;
+    int32_t  y     = 0;
+
+    delta++;
+    while ( y < r ) {
+        if ( f >= 0 ) {
+            if ( cornername & 0x1 ) {
+                drawFastHLine( x0 - y, y0 + r, y + y + delta, color );
+            }
+            if ( cornername & 0x2 ) {
+                drawFastHLine( x0 - y, y0 - r, y + y + delta, color );
+            }
+            r--;
+            ddF_y += 2;
+            f     += ddF_y;
+        }
+        y++;
+        ddF_x += 2;
+        f     += ddF_x;
+        if ( cornername & 0x1 ) {
+            drawFastHLine( x0 - r, y0 + y, r + r + delta, color );
+        }
+        if ( cornername & 0x2 ) {
+            drawFastHLine( x0 - r, y0 - y, r + r + delta, color );
+        }
+    }
+}
+
+void TFT_eSPI::drawTriangle( int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color ) {
+    HostCall call( this, HOST_TRIANGLE );
+    drawLine( x0, y0, x1, y1, color );
+    drawLine( x1, y1, x2, y2, color );
+    drawLine( x2, y2, x0, y0, color );
+}
+
+void TFT_eSPI::fillTriangle( int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color ) {
+    HostCall call( this, HOST_TRIANGLE );
+
+    // Sort by y (y2 >= y1 >= y0)
+    if ( y0 > y1 ) {
+        std::swap( y0, y1 );
+        std::swap( x0, x1 );
+    }
+    if ( y1 > y2 ) {
+        std::swap( y2, y1 );
+        std::swap( x2, x1 );
+    }
+    if ( y0 > y1 ) {
+        std::swap( y0, y1 );
+        std::swap( x0, x1 );
+    }
+
+    if ( y0 == y2 ) {
+        int32_t a = min( x0, min( x1, x2 ) );
+        int32_t b = max( x0, max( x1, x2 ) );
+        drawFastHLine( a, y0, b - a + 1, color );
+        return;
+    }
+
+    int32_t dx01 = x1 - x0, dy01 = y1 - y0;
+    int32_t dx02 = x2 - x0, dy02 = y2 - y0;
+    int32_t dx12 = x2 - x1, dy12 = y2 - y1;
+    int32_t sa   = 0, sb = 0;
+    int32_t last = ( y1 == y2 ) ? y1 : y1 - 1;
+    int32_t y;
+
+    for ( y = y0; y <= last; y++ ) {
+        int32_t a = x0 + sa / dy01;
+        int32_t b = x0 + sb / dy02;
+        sa += dx01;
+        sb += dx02;
+        if ( a > b ) {
+            std::swap( a, b );
+        }
+        drawFastHLine( a, y, b - a + 1, color );
+    }
+
+    sa = dx12 * ( y - y1 );
+    sb = dx02 * ( y - y0 );
+    for ( ; y <= y2; y++ ) {
+        int32_t a = x1 + sa / dy12;
+        int32_t b = x0 + sb / dy02;
+        sa += dx12;
+        sb += dx02;
+        if ( a > b ) {
+            std::swap( a, b );
+        }
+        drawFastHLine( a, y, b - a + 1, color );
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Anti-aliased shapes — coverage from a signed distance (negative inside);
+// solid runs go out as one drawFastHLine, edge pixels are blended singly
+// ---------------------------------------------------------------------------
+
+static float sdfCircle( float x, float y, const float *a ) {
+    return sqrtf( ( x - a[ 0 ] ) * ( x - a[ 0 ] ) + ( y - a[ 1 ] ) * ( y - a[ 1 ] ) ) - a[ 2 ];
+}
+
+static float sdfRing( float x, float y, const float *a ) {
+    return fabsf( sdfCircle( x, y, a ) ) - 0.5f;
+}
+
+static float sdfRoundRect( float x, float y, const float *a ) {
+    float qx = fabsf( x - a[ 0 ] ) - ( a[ 2 ] - a[ 4 ] );
+    float qy = fabsf( y - a[ 1 ] ) - ( a[ 3 ] - a[ 4 ] );
+    float ox = max( qx, 0.0f );
+    float oy = max( qy, 0.0f );
+    return sqrtf( ox * ox + oy * oy ) + min( max( qx, qy ), 0.0f ) - a[ 4 ];
+}
+
+// TFT_eSPI's wedgeLineDistance() less the start radius
+static float sdfWedge( float x, float y, const float *a ) {
+    float xpax = x - a[ 0 ], ypay = y - a[ 1 ];
+    float bax  = a[ 2 ], bay = a[ 3 ];
+    float h    = fmaxf( fminf( ( xpax * bax + ypay * bay ) / ( bax * bax + bay * bay ), 1.0f ), 0.0f );
+    float dx   = xpax - bax * h, dy = ypay - bay * h;
+    return sqrtf( dx * dx + dy * dy ) + h * a[ 4 ] - a[ 5 ];
+}
+
+void TFT_eSPI::smoothShape( float fx0, float fy0, float fx1, float fy1, float ( *sdf )( float, float, const float * ), const float *args, uint32_t fg, uint32_t bg ) {
+    // Bounding box clipped to the viewport (in caller coordinates)
+    int32_t x0 = max( ( int32_t )floorf( fx0 ), _vpX - _xDatum );
+    int32_t y0 = max( ( int32_t )floorf( fy0 ), _vpY - _yDatum );
+    int32_t x1 = min( ( int32_t )ceilf( fx1 ), _vpW - _xDatum - 1 );
+    int32_t y1 = min( ( int32_t )ceilf( fy1 ), _vpH - _yDatum - 1 );
+
+    for ( int32_t y = y0; y <= y1; y++ ) {
+        int32_t run = -1;
+        for ( int32_t x = x0; x <= x1 + 1; x++ ) {
+            float alpha = x <= x1 ? 0.5f - sdf( ( float )x, ( float )y, args ) : 0.0f;
+            if ( alpha > HI_ALPHA ) {
+                if ( run < 0 ) {
+                    run = x;
+                }
+                continue;
+            }
+            if ( run >= 0 ) {
+                drawFastHLine( run, y, x - run, fg );
+                run = -1;
+            }
+            if ( alpha > LO_ALPHA ) {
+                drawPixel( x, y, fg, ( uint8_t )( alpha * 255 ), bg );
+            }
+        }
+    }
+}
+
+uint16_t TFT_eSPI::drawPixel( int32_t x, int32_t y, uint32_t color, uint8_t alpha, uint32_t bg_color ) {
+    if ( bg_color == 0x00FFFFFF ) {
+        bg_color = readPixel( x, y );
+    }
+    color = alphaBlend( alpha, color, bg_color );
+    drawPixel( x, y, color );
+    return color;
+}
+
+void TFT_eSPI::drawSmoothCircle( int32_t x, int32_t y, int32_t r, uint32_t fg_color, uint32_t bg_color ) {
+    HostCall    call( this, HOST_SMOOTH );
+    const float args[] = { ( float )x, ( float )y, ( float )r };
+    smoothShape( x - r - 1, y - r - 1, x + r + 1, y + r + 1, sdfRing, args, fg_color, bg_color );
+}
+
+void TFT_eSPI::fillSmoothCircle( int32_t x, int32_t y, int32_t r, uint32_t color, uint32_t bg_color ) {
+    HostCall    call( this, HOST_SMOOTH );
+    const float args[] = { ( float )x, ( float )y, r + 0.5f };
+    smoothShape( x - r - 1, y - r - 1, x + r + 1, y + r + 1, sdfCircle, args, color, bg_color );
+}
+
+void TFT_eSPI::fillSmoothRoundRect( int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color, uint32_t bg_color ) {
+    HostCall    call( this, HOST_SMOOTH );
+    float       rr     = min( ( float )radius + 0.5f, min( w, h ) / 2.0f );
+    const float args[] = { x + ( w - 1 ) / 2.0f, y + ( h - 1 ) / 2.0f, w / 2.0f, h / 2.0f, rr };
+    smoothShape( x - 1, y - 1, x + w, y + h, sdfRoundRect, args, color, bg_color );
+}
+
+void TFT_eSPI::drawSpot( float ax, float ay, float r, uint32_t fg_color, uint32_t bg_color ) {
+    drawWedgeLine( ax, ay, ax, ay, r, r, fg_color, bg_color );
+}
+
+void TFT_eSPI::drawWideLine( float ax, float ay, float bx, float by, float wd, uint32_t fg_color, uint32_t bg_color ) {
+    drawWedgeLine( ax, ay, bx, by, wd / 2.0f, wd / 2.0f, fg_color, bg_color );
+}
+
+void TFT_eSPI::drawWedgeLine( float ax, float ay, float bx, float by, float ar, float br, uint32_t fg_color, uint32_t bg_color ) {
+    HostCall call( this, HOST_SMOOTH );
+    if ( ar < 0.0f || br < 0.0f ) {
+        return;
+    }
+    if ( fabsf( ax - bx ) < 0.01f && fabsf( ay - by ) < 0.01f ) {
+        bx += 0.01f;    // Avoid a zero-length segment
+    }
+    const float args[] = { ax, ay, bx - ax, by - ay, ar - br, ar };
+    smoothShape( fminf( ax - ar, bx - br ), fminf( ay - ar, by - br ),
+                 fmaxf( ax + ar, bx + br ), fmaxf( ay + ar, by + br ), sdfWedge, args, fg_color, bg_color );
+}
+
+// ---------------------------------------------------------------------------
+// Bitmaps and images
+// ---------------------------------------------------------------------------
+
+void TFT_eSPI::setSwapBytes( bool swap ) {
+    _swapBytes = swap;
+}
+
+bool TFT_eSPI::getSwapBytes( void ) {
+    return _swapBytes;
+}
+
+void TFT_eSPI::setBitmapColor( uint16_t fgcolor, uint16_t bgcolor ) {
+    if ( fgcolor == bgcolor ) {
+        bgcolor = ~fgcolor;
+    }
+    bitmap_fg = fgcolor;
+    bitmap_bg = bgcolor;
+}
+
+void TFT_eSPI::drawBitmap( int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color ) {
+    HostCall call( this, HOST_BITMAP );
+    int32_t  byteWidth = ( w + 7 ) / 8;
+    for ( int32_t j = 0; j < h; j++ ) {
+        for ( int32_t i = 0; i < w; i++ ) {
+            if ( bitmap[ j * byteWidth + i / 8 ] & ( 0x80 >> ( i & 7 ) ) ) {
+                drawPixel( x + i, y + j, color );
+            }
+        }
+    }
+}
+
+void TFT_eSPI::drawBitmap( int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t fgcolor, uint16_t bgcolor ) {
+    HostCall call( this, HOST_BITMAP );
+    int32_t  byteWidth = ( w + 7 ) / 8;
+    for ( int32_t j = 0; j < h; j++ ) {
+        for ( int32_t i = 0; i < w; i++ ) {
+            bool set = bitmap[ j * byteWidth + i / 8 ] & ( 0x80 >> ( i & 7 ) );
+            drawPixel( x + i, y + j, set ? fgcolor : bgcolor );
+        }
+    }
+}
+
+void TFT_eSPI::drawXBitmap( int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color ) {
+    HostCall call( this, HOST_BITMAP );
+    int32_t  byteWidth = ( w + 7 ) / 8;
+    for ( int32_t j = 0; j < h; j++ ) {
+        for ( int32_t i = 0; i < w; i++ ) {
+            if ( bitmap[ j * byteWidth + i / 8 ] & ( 1 << ( i & 7 ) ) ) {
+                drawPixel( x + i, y + j, color );
+            }
+        }
+    }
+}
+
+void TFT_eSPI::drawXBitmap( int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t fgcolor, uint16_t bgcolor ) {
+    HostCall call( this, HOST_BITMAP );
+    int32_t  byteWidth = ( w + 7 ) / 8;
+    for ( int32_t j = 0; j < h; j++ ) {
+        for ( int32_t i = 0; i < w; i++ ) {
+            bool set = bitmap[ j * byteWidth + i / 8 ] & ( 1 << ( i & 7 ) );
+            drawPixel( x + i, y + j, set ? fgcolor : bgcolor );
+        }
+    }
+}
+
+// Writes a block of 16-bit pixels: one window when opaque, one per run when
+// a transparent key splits the rows (as TFT_eSPI does)
+void TFT_eSPI::pushRows( int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, int32_t stride, bool swap, bool transparent, uint16_t key ) {
+    std::vector<uint16_t> row( w );
+    uint32_t              written = 0;
+    for ( int32_t j = 0; j < h; j++ ) {
+        for ( int32_t i = 0; i < w; i++ ) {
+            row[ i ] = swap ? swap16( data[ j * stride + i ] ) : data[ j * stride + i ];
+        }
+        if ( !transparent ) {
+            hostWriteRow( x, y + j, w, row.data() );
+            written += w;
+            continue;
+        }
+        for ( int32_t i = 0; i < w; ) {
+            if ( row[ i ] == key ) {
+                i++;
+                continue;
+            }
+            int32_t start = i;
+            while ( i < w && row[ i ] != key ) {
+                i++;
+            }
+            hostWriteRow( x + start, y + j, i - start, row.data() + start );
+            countWindow( i - start );
+        }
+    }
+    if ( !transparent ) {
+        countWindow( written );
+    }
+}
+
+// 16-bit images: with swapBytes off the buffer holds panel (big-endian) byte
+// order, as sprites do; with it on, native RGB565 values
+void TFT_eSPI::pushImage( int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data ) {
+    pushImage( x, y, w, h, ( const uint16_t * )data );
+}
+
+void TFT_eSPI::pushImage( int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data ) {
+    HostCall call( this, HOST_IMAGE );
+    int32_t  stride = w, dx, dy;
+    if ( clipImage( x, y, w, h, dx, dy ) ) {
+        pushRows( x, y, w, h, data + dy * stride + dx, stride, !_swapBytes, false, 0 );
+    }
+}
+
+void TFT_eSPI::pushImage( int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t transparent ) {
+    pushImage( x, y, w, h, ( const uint16_t * )data, transparent );
+}
+
+void TFT_eSPI::pushImage( int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, uint16_t transparent ) {
+    HostCall call( this, HOST_IMAGE );
+    int32_t  stride = w, dx, dy;
+    if ( clipImage( x, y, w, h, dx, dy ) ) {
+        pushRows( x, y, w, h, data + dy * stride + dx, stride, !_swapBytes, true, transparent );
+    }
+}
+
+// 8-bit RGB332 (bpp8), 4-bit through cmap, or 1-bit in bitmap_fg / bitmap_bg
+void TFT_eSPI::pushImage( int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t *data, bool bpp8, uint16_t *cmap ) {
+    HostCall              call( this, HOST_IMAGE );
+    std::vector<uint16_t> native( ( size_t )w * h );
+    int32_t               stride = bpp8 ? w : ( cmap != nullptr ? ( w + 1 ) / 2 : ( w + 7 ) / 8 );
+    for ( int32_t j = 0; j < h; j++ ) {
+        const uint8_t *src = data + j * stride;
+        for ( int32_t i = 0; i < w; i++ ) {
+            uint16_t c;
+            if ( bpp8 ) {
+                c = color8to16( src[ i ] );
+            }
+            else if ( cmap != nullptr ) {
+                c = cmap[ ( i & 1 ) ? ( src[ i >> 1 ] & 0x0F ) : ( src[ i >> 1 ] >> 4 ) ];
+            }
+            else {
+                c = ( src[ i >> 3 ] & ( 0x80 >> ( i & 7 ) ) ) ? bitmap_fg : bitmap_bg;
+            }
+            native[ j * w + i ] = c;
+        }
+    }
+    int32_t iw = w, dx, dy;
+    if ( clipImage( x, y, w, h, dx, dy ) ) {
+        pushRows( x, y, w, h, native.data() + dy * iw + dx, iw, false, false, 0 );
+    }
+}
+
+void TFT_eSPI::pushImage( int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *data, bool bpp8, uint16_t *cmap ) {
+    pushImage( x, y, w, h, ( const uint8_t * )data, bpp8, cmap );
+}
+
+void TFT_eSPI::pushRect( int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data ) {
+    pushImage( x, y, w, h, data );
+}
+
+void TFT_eSPI::readRect( int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data ) {
+    // Returned in the same byte order pushImage() expects
+    for ( int32_t j = 0; j < h; j++ ) {
+        for ( int32_t i = 0; i < w; i++ ) {
+            uint16_t c          = readPixel( x + i, y + j );
+            data[ j * w + i ] = _swapBytes ? c : swap16( c );
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Text
+// ---------------------------------------------------------------------------
+
+void TFT_eSPI::setCursor( int16_t x, int16_t y ) {
+    cursor_x = x;
+    cursor_y = y;
+}
+
+void TFT_eSPI::setCursor( int16_t x, int16_t y, uint8_t font ) {
+    setTextFont( font );
+    setCursor( x, y );
+}
+
+int16_t TFT_eSPI::getCursorX( void ) {
+    return cursor_x;
+}
+
+int16_t TFT_eSPI::getCursorY( void ) {
+    return cursor_y;
+}
+
+void TFT_eSPI::setTextColor( uint16_t c ) {
+    // Background set to the same colour draws transparent text
+    textcolor = textbgcolor = c;
+}
+
+void TFT_eSPI::setTextColor( uint16_t c, uint16_t b, bool ) {
+    textcolor   = c;
+    textbgcolor = b;
+}
+
+void TFT_eSPI::setTextSize( uint8_t s ) {
+    textsize = s > 7 ? 7 : ( s < 1 ? 1 : s );
+}
+
+void TFT_eSPI::setTextWrap( bool wrapX, bool wrapY ) {
+    textwrapX = wrapX;
+    textwrapY = wrapY;
+}
+
+void TFT_eSPI::setTextDatum( uint8_t d ) {
+    textdatum = d;
+}
+
+void TFT_eSPI::setTextPadding( uint16_t x_width ) {
+    padX = x_width;
+}
+
+uint8_t TFT_eSPI::getTextDatum( void ) {
+    return textdatum;
+}
+
+uint16_t TFT_eSPI::getTextPadding( void ) {
+    return padX;
+}
+
+void TFT_eSPI::setFreeFont( const GFXfont *f ) {
+    if ( f == nullptr ) {
+        setTextFont( 1 );
+        return;
+    }
+    textfont = 1;
+    gfxFont  = f;
+    glyph_ab = 0;
+    glyph_bb = 0;
+    for ( uint16_t c = 0; c < f->last - f->first; c++ ) {
+        const GFXglyph &g  = f->glyph[ c ];
+        int8_t          ab = -g.yOffset;
+        int8_t          bb = g.height - ab;
+        if ( ab > glyph_ab ) {
+            glyph_ab = ab;
+        }
+        if ( bb > glyph_bb ) {
+            glyph_bb = bb;
+        }
+    }
+}
+
+void TFT_eSPI::setTextFont( uint8_t f ) {
+    textfont = f > 0 ? f : 1;
+    gfxFont  = nullptr;
+}
+
+int16_t TFT_eSPI::textWidth( const char *string, uint8_t font ) {
+    int32_t  width = 0;
+    uint16_t n     = 0;
+    uint16_t len   = strlen( string );
+
+    if ( font > 1 && font < 9 ) {
+        const unsigned char *widths = FONTS[ font ].widthtbl;
+        while ( widths != nullptr && n < len ) {
+            uint16_t uniCode = decodeUTF8( ( const uint8_t * )string, &n, len - n );
+            width           += widths[ ( uniCode > 31 && uniCode < 128 ) ? uniCode - 32 : 0 ];
+        }
+    }
+    else if ( gfxFont != nullptr ) {
+        while ( n < len ) {
+            uint16_t uniCode = decodeUTF8( ( const uint8_t * )string, &n, len - n );
+            if ( uniCode < gfxFont->first || uniCode > gfxFont->last ) {
+                continue;
+            }
+            const GFXglyph &g = gfxFont->glyph[ uniCode - gfxFont->first ];
+            // The last glyph can reach past its advance
+            width += n < len ? g.xAdvance : g.xOffset + g.width;
+        }
+    }
+    else {
+        while ( n < len ) {
+            decodeUTF8( ( const uint8_t * )string, &n, len - n );
+            width += 6;
+        }
+    }
+    return width * textsize;
+}
+
+int16_t TFT_eSPI::textWidth( const char *string ) {
+    return textWidth( string, textfont );
+}
+
+int16_t TFT_eSPI::textWidth( const String &string, uint8_t font ) {
+    return textWidth( string.c_str(), font );
+}
+
+int16_t TFT_eSPI::textWidth( const String &string ) {
+    return textWidth( string.c_str(), textfont );
+}
+
+int16_t TFT_eSPI::fontHeight( uint8_t font ) {
+    if ( font > 8 ) {
+        return 0;
+    }
+    if ( font == 1 && gfxFont != nullptr ) {
+        return gfxFont->yAdvance * textsize;
+    }
+    return FONTS[ font ].height * textsize;
+}
+
+int16_t TFT_eSPI::fontHeight( void ) {
+    return fontHeight( textfont );
+}
+
+// Draws a w×h coverage mask at (x, y) scaled by size: textcolor where set and,
+// for opaque text, textbgcolor elsewhere. Opaque unscaled glyphs go out as
+// one block; everything else as horizontal runs.
+void TFT_eSPI::drawMask( int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t *mask, uint8_t size ) {
+    bool opaque = textcolor != textbgcolor;
+    if ( opaque && size == 1 ) {
+        std::vector<uint16_t> block( ( size_t )w * h );
+        for ( int32_t i = 0; i < w * h; i++ ) {
+            block[ i ] = mask[ i ] ? textcolor : textbgcolor;
+        }
+        int32_t bw = w, dx, dy;
+        if ( clipImage( x, y, w, h, dx, dy ) ) {
+            pushRows( x, y, w, h, block.data() + dy * bw + dx, bw, false, false, 0 );
+        }
+        return;
+    }
+    for ( int32_t j = 0; j < h; j++ ) {
+        const uint8_t *row = mask + j * w;
+        for ( int32_t i = 0; i < w; ) {
+            int32_t start = i;
+            uint8_t v     = row[ i ];
+            while ( i < w && row[ i ] == v ) {
+                i++;
+            }
+            if ( v || opaque ) {
+                fillRect( x + start * size, y + j * size, ( i - start ) * size, size, v ? textcolor : textbgcolor );
+            }
+        }
+    }
+}
+
+void TFT_eSPI::drawGfxChar( int32_t x, int32_t y, uint16_t c, uint32_t color, uint8_t size ) {
+    if ( c < gfxFont->first || c > gfxFont->last ) {
+        return;
+    }
+    const GFXglyph &g      = gfxFont->glyph[ c - gfxFont->first ];
+    const uint8_t  *bitmap = gfxFont->bitmap;
+    uint32_t        bo     = g.bitmapOffset;
+    int16_t         xo     = g.xOffset;
+    int16_t         yo     = g.yOffset;
+    uint8_t         bits   = 0;
+    uint8_t         bit    = 0;
+
+    for ( int32_t yy = 0; yy < g.height; yy++ ) {
+        int32_t hpc = 0;    // Foreground run length
+        for ( int32_t xx = 0; xx < g.width; xx++ ) {
+            if ( bit == 0 ) {
+                bits = bitmap[ bo++ ];
+                bit  = 0x80;
+            }
+            if ( bits & bit ) {
+                hpc++;
+            }
+            else if ( hpc ) {
+                if ( size == 1 ) {
+                    drawFastHLine( x + xo + xx - hpc, y + yo + yy, hpc, color );
+                }
+                else {
+                    fillRect( x + ( xo + xx - hpc ) * size, y + ( yo + yy ) * size, size * hpc, size, color );
+                }
+                hpc = 0;
+            }
+            bit >>= 1;
+        }
+        if ( hpc ) {
+            if ( size == 1 ) {
+                drawFastHLine( x + xo + g.width - hpc, y + yo + yy, hpc, color );
+            }
+            else {
+                fillRect( x + ( xo + g.width - hpc ) * size, y + ( yo + yy ) * size, size * hpc, size, color );
+            }
+        }
+    }
+}
+
+// GLCD or FreeFont glyph; for FreeFonts (x, y) is on the baseline
+void TFT_eSPI::drawChar( int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size ) {
+    HostCall call( this, HOST_TEXT );
+    if ( gfxFont != nullptr ) {
+        drawGfxChar( x, y, c, color, size );
+        return;
+    }
+    if ( c < 32 || c > 255 ) {
+        return;
+    }
+
+    uint8_t mask[ 6 * 8 ];
+    for ( int32_t i = 0; i < 6; i++ ) {
+        uint8_t line = i < 5 ? font[ c * 5 + i ] : 0;
+        for ( int32_t j = 0; j < 8; j++ ) {
+            mask[ j * 6 + i ] = ( line >> j ) & 1;
+        }
+    }
+    uint32_t fg = textcolor, bgc = textbgcolor;
+    textcolor   = color;
+    textbgcolor = bg;
+    drawMask( x, y, 6, 8, mask, size );
+    textcolor   = fg;
+    textbgcolor = bgc;
+}
+
+int16_t TFT_eSPI::drawChar( uint16_t uniCode, int32_t x, int32_t y ) {
+    return drawChar( uniCode, x, y, textfont );
+}
+
+int16_t TFT_eSPI::drawChar( uint16_t uniCode, int32_t x, int32_t y, uint8_t font ) {
+    HostCall call( this, HOST_TEXT );
+    if ( _vpOoB || uniCode == 0 ) {
+        return 0;
+    }
+
+    if ( font == 1 ) {
+        drawChar( x, y, uniCode, textcolor, textbgcolor, textsize );
+        if ( gfxFont == nullptr ) {
+            return 6 * textsize;
+        }
+        if ( uniCode < gfxFont->first || uniCode > gfxFont->last ) {
+            return 0;
+        }
+        return gfxFont->glyph[ uniCode - gfxFont->first ].xAdvance * textsize;
+    }
+
+    if ( font > 8 || FONTS[ font ].chartbl == nullptr || uniCode < 32 || uniCode > 127 ) {
+        return 0;
+    }
+
+    int32_t              width  = FONTS[ font ].widthtbl[ uniCode - 32 ];
+    int32_t              height = FONTS[ font ].height;
+    const unsigned char *data   = FONTS[ font ].chartbl[ uniCode - 32 ];
+    std::vector<uint8_t> mask( ( size_t )width * height, 0 );
+
+    if ( font == 2 ) {
+        // Plain bitmap, rows padded to whole bytes
+        int32_t stride = ( width + 6 ) / 8;
+        for ( int32_t j = 0; j < height; j++ ) {
+            for ( int32_t i = 0; i < width; i++ ) {
+                mask[ j * width + i ] = ( data[ j * stride + i / 8 ] >> ( 7 - ( i & 7 ) ) ) & 1;
+            }
+        }
+    }
+    else {
+        // Run-length encoded: bit 7 set = foreground run, low 7 bits = length - 1
+        int32_t pc = 0;
+        while ( pc < width * height ) {
+            uint8_t line = *data++;
+            int32_t run  = ( line & 0x7F ) + 1;
+            if ( line & 0x80 ) {
+                for ( int32_t k = 0; k < run && pc + k < width * height; k++ ) {
+                    mask[ pc + k ] = 1;
+                }
+            }
+            pc += run;
+        }
+    }
+    drawMask( x, y, width, height, mask.data(), textsize );
+    return width * textsize;
+}
+
+int16_t TFT_eSPI::drawString( const char *string, int32_t poX, int32_t poY, uint8_t font ) {
+    HostCall call( this, HOST_TEXT );
+    int16_t  sumX     = 0;
+    uint8_t  padding  = 1;
+    uint8_t  baseline = 0;
+    int32_t  cwidth   = textWidth( string, font );
+    int32_t  cheight  = 8 * textsize;
+    bool     freeFont = font == 1 && gfxFont != nullptr;
+
+    if ( freeFont ) {
+        cheight  = glyph_ab * textsize;
+        poY     += cheight;     // FreeFonts draw on the baseline
+        baseline = cheight;
+        padding  = 101;
+        if ( textdatum == BL_DATUM || textdatum == BC_DATUM || textdatum == BR_DATUM ) {
+            cheight += glyph_bb * textsize;
+        }
+    }
+    if ( font != 1 ) {
+        baseline = FONTS[ font < 9 ? font : 0 ].baseline * textsize;
+        cheight  = fontHeight( font );
+    }
+
+    switch ( textdatum ) {
+        case TC_DATUM:
+            poX     -= cwidth / 2;
+            padding += 1;
+            break;
+        case TR_DATUM:
+            poX     -= cwidth;
+            padding += 2;
+            break;
+        case ML_DATUM:
+            poY -= cheight / 2;
+            break;
+        case MC_DATUM:
+            poX     -= cwidth / 2;
+            poY     -= cheight / 2;
+            padding += 1;
+            break;
+        case MR_DATUM:
+            poX     -= cwidth;
+            poY     -= cheight / 2;
+            padding += 2;
+            break;
+        case BL_DATUM:
+            poY -= cheight;
+            break;
+        case BC_DATUM:
+            poX     -= cwidth / 2;
+            poY     -= cheight;
+            padding += 1;
+            break;
+        case BR_DATUM:
+            poX     -= cwidth;
+            poY     -= cheight;
+            padding += 2;
+            break;
+        case L_BASELINE:
+            poY -= baseline;
+            break;
+        case C_BASELINE:
+            poX     -= cwidth / 2;
+            poY     -= baseline;
+            padding += 1;
+            break;
+        case R_BASELINE:
+            poX     -= cwidth;
+            poY     -= baseline;
+            padding += 2;
+            break;
+    }
+
+    int32_t  xo  = 0;
+    uint16_t len = strlen( string );
+    uint16_t n   = 0;
+    if ( freeFont && textcolor != textbgcolor ) {
+        // Opaque FreeFont text: fill the whole string box first
+        cheight     = ( glyph_ab + glyph_bb ) * textsize;
+        uint16_t c2 = 0;
+        while ( n < len && c2 == 0 ) {
+            c2 = decodeUTF8( ( const uint8_t * )string, &n, len - n );
+        }
+        n = 0;
+        if ( c2 >= gfxFont->first && c2 <= gfxFont->last ) {
+            xo = gfxFont->glyph[ c2 - gfxFont->first ].xOffset * textsize;
+            if ( xo > 0 ) {
+                xo = 0;
+            }
+            else {
+                cwidth -= xo;
+            }
+            fillRect( poX + xo, poY - glyph_ab * textsize, cwidth, cheight, textbgcolor );
+        }
+        padding -= 100;
+    }
+
+    while ( n < len ) {
+        uint16_t uniCode = decodeUTF8( ( const uint8_t * )string, &n, len - n );
+        sumX            += drawChar( uniCode, poX + sumX, poY, font );
+    }
+
+    if ( padX > cwidth && textcolor != textbgcolor ) {
+        int32_t padXc = poX + cwidth + xo;
+        if ( freeFont ) {
+            poX += xo;
+            poY -= glyph_ab * textsize;
+        }
+        switch ( padding ) {
+            case 1:
+                fillRect( padXc, poY, padX - cwidth, cheight, textbgcolor );
+                break;
+            case 2:
+                fillRect( padXc, poY, ( padX - cwidth ) >> 1, cheight, textbgcolor );
+                padXc = ( padX - cwidth ) >> 1;
+                if ( padXc > poX ) {
+                    padXc = poX;
+                }
+                fillRect( poX - padXc, poY, ( padX - cwidth ) >> 1, cheight, textbgcolor );
+                break;
+            case 3:
+                fillRect( poX + cwidth - padX, poY, padX - cwidth, cheight, textbgcolor );
+                break;
+        }
+    }
+    return sumX;
+}
+
+int16_t TFT_eSPI::drawString( const char *string, int32_t x, int32_t y ) {
+    return drawString( string, x, y, textfont );
+}
+
+int16_t TFT_eSPI::drawString( const String &string, int32_t x, int32_t y, uint8_t font ) {
+    return drawString( string.c_str(), x, y, font );
+}
+
+int16_t TFT_eSPI::drawString( const String &string, int32_t x, int32_t y ) {
+    return drawString( string.c_str(), x, y, textfont );
+}
+
+int16_t TFT_eSPI::drawCentreString( const char *string, int32_t x, int32_t y, uint8_t font ) {
+    uint8_t datum = textdatum;
+    textdatum     = TC_DATUM;
+    int16_t w     = drawString( string, x, y, font );
+    textdatum     = datum;
+    return w;
+}
+
+int16_t TFT_eSPI::drawRightString( const char *string, int32_t x, int32_t y, uint8_t font ) {
+    uint8_t datum = textdatum;
+    textdatum     = TR_DATUM;
+    int16_t w     = drawString( string, x, y, font );
+    textdatum     = datum;
+    return w;
+}
+
+int16_t TFT_eSPI::drawCentreString( const String &string, int32_t x, int32_t y, uint8_t font ) {
+    return drawCentreString( string.c_str(), x, y, font );
+}
+
+int16_t TFT_eSPI::drawRightString( const String &string, int32_t x, int32_t y, uint8_t font ) {
+    return drawRightString( string.c_str(), x, y, font );
+}
+
+int16_t TFT_eSPI::drawNumber( long intNumber, int32_t x, int32_t y, uint8_t font ) {
+    char str[ 12 ];
+    snprintf( str, sizeof( str ), "%ld", intNumber );
+    return drawString( str, x, y, font );
+}
+
+int16_t TFT_eSPI::drawNumber( long intNumber, int32_t x, int32_t y ) {
+    return drawNumber( intNumber, x, y, textfont );
+}
+
+int16_t TFT_eSPI::drawFloat( float floatNumber, uint8_t decimal, int32_t x, int32_t y, uint8_t font ) {
+    char str[ 24 ];
+    snprintf( str, sizeof( str ), "%.*f", min( ( int )decimal, 7 ), floatNumber );
+    return drawString( str, x, y, font );
+}
+
+int16_t TFT_eSPI::drawFloat( float floatNumber, uint8_t decimal, int32_t x, int32_t y ) {
+    return drawFloat( floatNumber, decimal, x, y, textfont );
+}
+
+size_t TFT_eSPI::write( uint8_t c ) {
+    HostCall call( this, HOST_TEXT );
+    if ( c == '\r' ) {
+        return 1;
+    }
+
+    if ( gfxFont == nullptr || textfont != 1 ) {
+        if ( c != '\n' && c < 32 ) {
+            return 1;
+        }
+        int32_t cwidth  = 6;
+        int32_t cheight = 8;
+        if ( textfont > 1 && textfont < 9 && FONTS[ textfont ].widthtbl != nullptr ) {
+            cwidth  = FONTS[ textfont ].widthtbl[ ( c == '\n' ? ' ' : c ) - 32 ];
+            cheight = FONTS[ textfont ].height;
+            if ( textfont == 2 ) {
+                cwidth = ( cwidth + 6 ) / 8 * 8;    // Font 2 renders in whole bytes
+            }
+        }
+        cwidth  *= textsize;
+        cheight *= textsize;
+        if ( c == '\n' ) {
+            cursor_y += cheight;
+            cursor_x  = 0;
+            return 1;
+        }
+        if ( textwrapX && cursor_x + cwidth > width() ) {
+            cursor_y += cheight;
+            cursor_x  = 0;
+        }
+        if ( textwrapY && cursor_y >= height() ) {
+            cursor_y = 0;
+        }
+        cursor_x += drawChar( c, cursor_x, cursor_y, textfont );
+        return 1;
+    }
+
+    if ( c == '\n' ) {
+        cursor_x  = 0;
+        cursor_y += textsize * gfxFont->yAdvance;
+        return 1;
+    }
+    if ( c < gfxFont->first || c > gfxFont->last ) {
+        return 1;
+    }
+    const GFXglyph &g = gfxFont->glyph[ c - gfxFont->first ];
+    if ( g.width > 0 && g.height > 0 ) {
+        if ( textwrapX && cursor_x + textsize * ( g.xOffset + g.width ) > width() ) {
+            cursor_x  = 0;
+            cursor_y += textsize * gfxFont->yAdvance;
+        }
+        if ( textwrapY && cursor_y >= height() ) {
+            cursor_y = 0;
+        }
+        drawChar( cursor_x, cursor_y, c, textcolor, textbgcolor, textsize );
+    }
+    cursor_x += g.xAdvance * textsize;
+    return 1;
+}
+
+// ---------------------------------------------------------------------------
+// Colour helpers
+// ---------------------------------------------------------------------------
+
+uint16_t TFT_eSPI::color565( uint8_t r, uint8_t g, uint8_t b ) {
+    return ( ( r & 0xF8 ) << 8 ) | ( ( g & 0xFC ) << 3 ) | ( b >> 3 );
+}
+
+uint16_t TFT_eSPI::color8to16( uint8_t color ) {
+    static const uint8_t blue[] = { 0, 11, 21, 31 };
+    uint16_t             c      = ( color & 0xE0 ) << 8 | ( color & 0xC0 ) << 5;
+    c                          |= ( color & 0x1C ) << 6 | ( color & 0x1C ) << 3;
+    c                          |= blue[ color & 0x03 ];
+    return c;
+}
+
+uint8_t TFT_eSPI::color16to8( uint16_t c ) {
+    return ( ( c & 0xE000 ) >> 8 ) | ( ( c & 0x0700 ) >> 6 ) | ( ( c & 0x0018 ) >> 3 );
+}
+
+uint32_t TFT_eSPI::color16to24( uint16_t color565 ) {
+    uint8_t r = ( color565 >> 8 ) & 0xF8;
+    uint8_t g = ( color565 >> 3 ) & 0xFC;
+    uint8_t b = ( color565 << 3 ) & 0xF8;
+    r        |= r >> 5;
+    g        |= g >> 6;
+    b        |= b >> 5;
+    return ( ( uint32_t )r << 16 ) | ( ( uint32_t )g << 8 ) | b;
+}
+
+uint32_t TFT_eSPI::color24to16( uint32_t color888 ) {
+    return ( ( color888 >> 8 ) & 0xF800 ) | ( ( color888 >> 5 ) & 0x07E0 ) | ( ( color888 >> 3 ) & 0x001F );
+}
+
+uint16_t TFT_eSPI::alphaBlend( uint8_t alpha, uint16_t fgc, uint16_t bgc ) {
+    uint32_t rxb  = bgc & 0xF81F;
+    rxb          += ( ( fgc & 0xF81F ) - rxb ) * ( alpha >> 2 ) >> 6;
+    uint32_t xgx  = bgc & 0x07E0;
+    xgx          += ( ( fgc & 0x07E0 ) - xgx ) * alpha >> 8;
+    return ( rxb & 0xF81F ) | ( xgx & 0x07E0 );
+}
+
+// ---------------------------------------------------------------------------
+// Transactions and DMA
+// ---------------------------------------------------------------------------
+
+void TFT_eSPI::startWrite( void ) {}
+
+void TFT_eSPI::endWrite( void ) {}
+
+bool TFT_eSPI::initDMA( bool ) {
+    return true;
+}
+
+void TFT_eSPI::deInitDMA( void ) {}
+
+void TFT_eSPI::pushImageDMA( int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t * ) {
+    pushImage( x, y, w, h, ( const uint16_t * )data );
+}
+
+bool TFT_eSPI::dmaBusy( void ) {
+    return false;
+}
+
+void TFT_eSPI::dmaWait( void ) {}
+
+// ---------------------------------------------------------------------------
+// PNG export and checksum
+// ---------------------------------------------------------------------------
+
+static uint32_t crc32Update( uint32_t crc, const uint8_t *data, size_t len ) {
+    static uint32_t table[ 256 ];
+    if ( table[ 1 ] == 0 ) {
+        for ( uint32_t n = 0; n < 256; n++ ) {
+            uint32_t c = n;
+            for ( int k = 0; k < 8; k++ ) {
+                c = ( c & 1 ) ? 0xEDB88320UL ^ ( c >> 1 ) : c >> 1;
+            }
+            table[ n ] = c;
+        }
+    }
+    crc = ~crc;
+    while ( len-- ) {
+        crc = table[ ( crc ^ *data++ ) & 0xFF ] ^ ( crc >> 8 );
+    }
+    return ~crc;
+}
+
+static void putBE32( std::vector<uint8_t> &out, uint32_t v ) {
+    out.push_back( v >> 24 );
+    out.push_back( v >> 16 );
+    out.push_back( v >> 8 );
+    out.push_back( v );
+}
+
+static void putChunk( std::vector<uint8_t> &out, const char *type, const std::vector<uint8_t> &data ) {
+    putBE32( out, ( uint32_t )data.size() );
+    size_t start = out.size();
+    out.insert( out.end(), type, type + 4 );
+    out.insert( out.end(), data.begin(), data.end() );
+    putBE32( out, crc32Update( 0, out.data() + start, out.size() - start ) );
+}
+
+// Uncompressed (stored) deflate — the images are small and this keeps zlib out
+bool TFT_eSPI::hostSavePNG( const char *path ) {
+    int32_t              w = _width, h = _height;
+    std::vector<uint8_t> raw;
+    raw.reserve( ( size_t )( w * 3 + 1 ) * h );
+    for ( int32_t y = 0; y < h; y++ ) {
+        raw.push_back( 0 );     // Filter: none
+        for ( int32_t x = 0; x < w; x++ ) {
+            uint16_t c   = hostRead( x, y );
+            uint32_t rgb = color16to24( _invert ? ~c : c );
+            raw.push_back( rgb >> 16 );
+            raw.push_back( rgb >> 8 );
+            raw.push_back( rgb );
+        }
+    }
+
+    std::vector<uint8_t> z = { 0x78, 0x01 };
+    for ( size_t pos = 0; pos < raw.size() || pos == 0; ) {
+        size_t n = min( raw.size() - pos, ( size_t )65535 );
+        z.push_back( pos + n == raw.size() ? 1 : 0 );
+        z.push_back( n & 0xFF );
+        z.push_back( n >> 8 );
+        z.push_back( ~n & 0xFF );
+        z.push_back( ( ~n >> 8 ) & 0xFF );
+        z.insert( z.end(), raw.begin() + pos, raw.begin() + pos + n );
+        pos += n;
+        if ( n == 0 ) {
+            break;
+        }
+    }
+    uint32_t a = 1, b = 0;
+    for ( uint8_t v : raw ) {
+        a = ( a + v ) % 65521;
+        b = ( b + a ) % 65521;
+    }
+    putBE32( z, ( b << 16 ) | a );
+
+    std::vector<uint8_t> png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    std::vector<uint8_t> ihdr;
+    putBE32( ihdr, w );
+    putBE32( ihdr, h );
+    ihdr.insert( ihdr.end(), { 8, 2, 0, 0, 0 } );   // 8-bit RGB
+    putChunk( png, "IHDR", ihdr );
+    putChunk( png, "IDAT", z );
+    putChunk( png, "IEND", {} );
+
+    FILE *f = fopen( path, "wb" );
+    if ( f == nullptr ) {
+        log_e( "[HOST] Cannot write %s", path );
+        return false;
+    }
+    bool ok = fwrite( png.data(), 1, png.size(), f ) == png.size();
+    fclose( f );
+    return ok;
+}
+
+uint32_t TFT_eSPI::hostChecksum() {
+    uint32_t crc = 0;
+    for ( int32_t y = 0; y < _height; y++ ) {
+        for ( int32_t x = 0; x < _width; x++ ) {
+            uint16_t c     = hostRead( x, y );
+            uint8_t  b[ 2 ] = { ( uint8_t )( c >> 8 ), ( uint8_t )c };
+            crc            = crc32Update( crc, b, 2 );
+        }
+    }
+    return crc;
+}
+
+// ---------------------------------------------------------------------------
+// TFT_eSprite
+// ---------------------------------------------------------------------------
+
+TFT_eSprite::TFT_eSprite( TFT_eSPI *tft ) : TFT_eSPI( 0, 0 ) {
+    _tft      = tft;
+    _img8     = nullptr;
+    _colorMap = nullptr;
+    _iwidth   = 0;
+    _iheight  = 0;
+    _bpp      = 16;
+}
+
+TFT_eSprite::~TFT_eSprite( void ) {
+    deleteSprite();
+    free( _colorMap );
+}
+
+void *TFT_eSprite::createSprite( int16_t w, int16_t h, uint8_t ) {
+    if ( _img8 != nullptr ) {
+        return _img8;
+    }
+    if ( w < 1 || h < 1 ) {
+        return nullptr;
+    }
+
+    // Row padding as in TFT_eSprite: 1 bpp to whole bytes, 4 bpp to whole bytes
+    _iwidth  = _bpp == 1 ? ( w + 7 ) & ~7 : ( _bpp == 4 ? ( w + 1 ) & ~1 : w );
+    _iheight = h;
+    size_t bytes = ( size_t )_iwidth * h * _bpp / 8;
+    _img8        = ( uint8_t * )calloc( bytes + 1, 1 );
+    if ( _img8 == nullptr ) {
+        return nullptr;
+    }
+    if ( _bpp == 4 && _colorMap == nullptr ) {
+        createPalette( DEFAULT_4BIT_PALETTE, 16 );
+    }
+    _width  = _init_width  = w;
+    _height = _init_height = h;
+    resetViewport();
+    return _img8;
+}
+
+void *TFT_eSprite::getPointer( void ) {
+    return _img8;
+}
+
+bool TFT_eSprite::created( void ) {
+    return _img8 != nullptr;
+}
+
+void TFT_eSprite::deleteSprite( void ) {
+    free( _img8 );
+    _img8 = nullptr;
+}
+
+void *TFT_eSprite::setColorDepth( int8_t b ) {
+    uint8_t bpp = ( b == 1 || b == 4 || b == 8 ) ? b : 16;
+    if ( _img8 != nullptr && bpp != _bpp ) {
+        // Recreate at the new depth, as TFT_eSprite does
+        int16_t w = _width, h = _height;
+        deleteSprite();
+        _bpp = bpp;
+        return createSprite( w, h );
+    }
+    _bpp = bpp;
+    return _img8;
+}
+
+int8_t TFT_eSprite::getColorDepth( void ) {
+    return _img8 != nullptr ? _bpp : 0;
+}
+
+void TFT_eSprite::createPalette( uint16_t *palette, uint8_t colors ) {
+    createPalette( ( const uint16_t * )palette, colors );
+}
+
+void TFT_eSprite::createPalette( const uint16_t *palette, uint8_t colors ) {
+    if ( _colorMap == nullptr ) {
+        _colorMap = ( uint16_t * )calloc( 16, sizeof( uint16_t ) );
+    }
+    const uint16_t *src = palette != nullptr ? palette : DEFAULT_4BIT_PALETTE;
+    for ( int i = 0; i < 16; i++ ) {
+        _colorMap[ i ] = i < colors ? src[ i ] : 0;
+    }
+}
+
+void TFT_eSprite::setPaletteColor( uint8_t index, uint16_t color ) {
+    if ( _colorMap != nullptr && index < 16 ) {
+        _colorMap[ index ] = color;
+    }
+}
+
+uint16_t TFT_eSprite::getPaletteColor( uint8_t index ) {
+    return ( _colorMap != nullptr && index < 16 ) ? _colorMap[ index ] : 0;
+}
+
+void TFT_eSprite::setBitmapColor( uint16_t fg, uint16_t bg ) {
+    // 1-bit sprites render through the parent TFT's bitmap colours
+    _tft->setBitmapColor( fg, bg );
+}
+
+void TFT_eSprite::hostFill( int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color ) {
+    if ( _img8 == nullptr ) {
+        return;
+    }
+    for ( int32_t j = y; j < y + h; j++ ) {
+        for ( int32_t i = x; i < x + w; i++ ) {
+            size_t idx = ( size_t )j * _iwidth + i;
+            switch ( _bpp ) {
+                case 16:
+                    ( ( uint16_t * )_img8 )[ idx ] = swap16( color );
+                    break;
+                case 8:
+                    _img8[ idx ] = color16to8( color );
+                    break;
+                case 4:
+                    // The colour is the palette index
+                    _img8[ idx >> 1 ] = ( idx & 1 ) ? ( _img8[ idx >> 1 ] & 0xF0 ) | ( color & 0x0F )
+                                                    : ( _img8[ idx >> 1 ] & 0x0F ) | ( ( color & 0x0F ) << 4 );
+                    break;
+                default:
+                    if ( color ) {
+                        _img8[ idx >> 3 ] |= 0x80 >> ( i & 7 );
+                    }
+                    else {
+                        _img8[ idx >> 3 ] &= ~( 0x80 >> ( i & 7 ) );
+                    }
+                    break;
+            }
+        }
+    }
+}
+
+void TFT_eSprite::hostWriteRow( int32_t x, int32_t y, int32_t w, const uint16_t *colors ) {
+    for ( int32_t i = 0; i < w; i++ ) {
+        hostFill( x + i, y, 1, 1, colors[ i ] );
+    }
+}
+
+uint16_t TFT_eSprite::hostRead( int32_t x, int32_t y ) {
+    if ( _img8 == nullptr ) {
+        return 0;
+    }
+    size_t idx = ( size_t )y * _iwidth + x;
+    switch ( _bpp ) {
+        case 16:
+            return swap16( ( ( uint16_t * )_img8 )[ idx ] );
+        case 8:
+            return color8to16( _img8[ idx ] );
+        case 4:
+            return _colorMap[ ( idx & 1 ) ? ( _img8[ idx >> 1 ] & 0x0F ) : ( _img8[ idx >> 1 ] >> 4 ) ];
+        default:
+            return ( _img8[ idx >> 3 ] & ( 0x80 >> ( x & 7 ) ) ) ? _tft->bitmap_fg : _tft->bitmap_bg;
+    }
+}
+
+uint16_t TFT_eSprite::readPixelValue( int32_t x, int32_t y ) {
+    int32_t w = 1, h = 1;
+    if ( _img8 == nullptr || !clipRect( x, y, w, h ) ) {
+        return 0xFFFF;
+    }
+    size_t idx = ( size_t )y * _iwidth + x;
+    switch ( _bpp ) {
+        case 16:
+            return swap16( ( ( uint16_t * )_img8 )[ idx ] );
+        case 8:
+            return _img8[ idx ];
+        case 4:
+            return ( idx & 1 ) ? ( _img8[ idx >> 1 ] & 0x0F ) : ( _img8[ idx >> 1 ] >> 4 );
+        default:
+            return ( _img8[ idx >> 3 ] >> ( 7 - ( x & 7 ) ) ) & 1;
+    }
+}
+
+void TFT_eSprite::fillSprite( uint32_t color ) {
+    HostCall call( this, HOST_RECT );
+    fillRect( _vpX - _xDatum, _vpY - _yDatum, _vpW - _vpX, _vpH - _vpY, color );
+}
+
+void TFT_eSprite::pushRegion( TFT_eSPI *dst, int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh, bool transparent, uint16_t key ) {
+    HostCall call( dst, HOST_IMAGE );
+    int32_t  dx, dy;
+    if ( _img8 == nullptr || !dst->clipImage( tx, ty, sw, sh, dx, dy ) ) {
+        return;
+    }
+    std::vector<uint16_t> native( ( size_t )sw * sh );
+    for ( int32_t j = 0; j < sh; j++ ) {
+        for ( int32_t i = 0; i < sw; i++ ) {
+            native[ j * sw + i ] = hostRead( sx + dx + i, sy + dy + j );
+        }
+    }
+    dst->pushRows( tx, ty, sw, sh, native.data(), sw, false, transparent, key );
+}
+
+void TFT_eSprite::pushSprite( int32_t x, int32_t y ) {
+    pushRegion( _tft, x, y, 0, 0, _width, _height, false, 0 );
+}
+
+void TFT_eSprite::pushSprite( int32_t x, int32_t y, uint16_t transparent ) {
+    pushRegion( _tft, x, y, 0, 0, _width, _height, true, transparent );
+}
+
+bool TFT_eSprite::pushSprite( int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh ) {
+    // Clip the source window to the sprite
+    if ( sx < 0 ) {
+        tx -= sx;
+        sw += sx;
+        sx  = 0;
+    }
+    if ( sy < 0 ) {
+        ty -= sy;
+        sh += sy;
+        sy  = 0;
+    }
+    sw = min( sw, _width - sx );
+    sh = min( sh, _height - sy );
+    if ( _img8 == nullptr || sw < 1 || sh < 1 ) {
+        return false;
+    }
+    pushRegion( _tft, tx, ty, sx, sy, sw, sh, false, 0 );
+    return true;
+}
+
+bool TFT_eSprite::pushToSprite( TFT_eSprite *dspr, int32_t x, int32_t y ) {
+    if ( _img8 == nullptr || dspr == nullptr || !dspr->created() ) {
+        return false;
+    }
+    pushRegion( dspr, x, y, 0, 0, _width, _height, false, 0 );
+    return true;
+}
+
+bool TFT_eSprite::pushToSprite( TFT_eSprite *dspr, int32_t x, int32_t y, uint16_t transparent ) {
+    if ( _img8 == nullptr || dspr == nullptr || !dspr->created() ) {
+        return false;
+    }
+    pushRegion( dspr, x, y, 0, 0, _width, _height, true, transparent );
+    return true;
+}
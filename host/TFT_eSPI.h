@@ -0,0 +1,307 @@
+#pragma once
+
+// ---------------------------------------------------------------------------
+// Host framebuffer backend for TFT_eSPI ([env:native] only)
+//
+// Source-compatible with the TFT_eSPI / TFT_eSprite API the firmware uses, but
+// the "panel" is an in-memory RGB565 framebuffer. Primitives follow TFT_eSPI's
+// own algorithms and go through the same virtual leaves (drawPixel,
+// drawFastH/VLine, fillRect), so GFX_STATS and anything else layered on the
+// leaves behaves as on the device. Sprites use TFT_eSPI's memory layouts
+// (16 bpp byte-swapped, 8 bpp RGB332, 4 bpp paletted, 1 bpp MSB-first rows),
+// so code that pokes getPointer() renders identically.
+//
+// Fonts 1/2/4/6/7/8 and the FreeFonts come from the TFT_eSPI library's own
+// font headers (installed by lib_deps, never compiled as a library here).
+// Smooth (.vlw) fonts are not supported.
+//
+// Host-only additions, all prefixed "host":
+//   hostCounters()   primitive calls, address windows and pixels written
+//   hostSavePNG()    writes the panel (or a sprite) as a 24-bit PNG
+//   hostChecksum()   CRC-32 of the visible pixels, for quick image comparisons
+// ---------------------------------------------------------------------------
+
+#include <Arduino.h>
+
+#include <Fonts/GFXFF/gfxfont.h>
+
+// FreeFonts referenced by the firmware; add the header here when a screen
+// starts using another one
+#include <Fonts/GFXFF/FreeSans9pt7b.h>
+#include <Fonts/GFXFF/FreeSans12pt7b.h>
+#include <Fonts/GFXFF/FreeSansBold12pt7b.h>
+#include <Fonts/GFXFF/FreeSansBold18pt7b.h>
+
+// ILI9341 native geometry (portrait)
+#ifndef TFT_WIDTH
+#define TFT_WIDTH  240
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 320
+#endif
+
+// Colours (RGB565)
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_DARKCYAN    0x03EF
+#define TFT_MAROON      0x7800
+#define TFT_PURPLE      0x780F
+#define TFT_OLIVE       0x7BE0
+#define TFT_LIGHTGREY   0xD69A
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+#define TFT_GREENYELLOW 0xB7E0
+#define TFT_PINK        0xFE19
+#define TFT_BROWN       0x9A60
+#define TFT_GOLD        0xFEA0
+#define TFT_SILVER      0xC618
+#define TFT_SKYBLUE     0x867D
+#define TFT_VIOLET      0x915C
+#define TFT_TRANSPARENT 0x0120
+
+// Text datums
+#define TL_DATUM   0
+#define TC_DATUM   1
+#define TR_DATUM   2
+#define ML_DATUM   3
+#define CL_DATUM   3
+#define MC_DATUM   4
+#define CC_DATUM   4
+#define MR_DATUM   5
+#define CR_DATUM   5
+#define BL_DATUM   6
+#define BC_DATUM   7
+#define BR_DATUM   8
+#define L_BASELINE 9
+#define C_BASELINE 10
+#define R_BASELINE 11
+
+enum HostPrim : uint8_t {
+    HOST_PIXEL,
+    HOST_HLINE,
+    HOST_VLINE,
+    HOST_LINE,
+    HOST_RECT,
+    HOST_ROUNDRECT,
+    HOST_CIRCLE,
+    HOST_TRIANGLE,
+    HOST_SMOOTH,    // Anti-aliased circles, round rects, wedge and wide lines
+    HOST_TEXT,      // One per drawString / drawChar / print call
+    HOST_BITMAP,
+    HOST_IMAGE,     // pushImage / pushImageDMA / pushSprite
+    HOST_PRIM_COUNT
+};
+
+extern const char *const HOST_PRIM_NAMES[ HOST_PRIM_COUNT ];
+
+struct HostGfxCounters {
+    uint32_t calls[ HOST_PRIM_COUNT ];  // Outermost calls only
+    uint32_t windows;                   // Address windows the panel would have opened
+    uint64_t pixels;                    // Pixels written
+};
+
+class TFT_eSprite;
+
+class TFT_eSPI : public Print {
+    friend class TFT_eSprite;
+public:
+    TFT_eSPI( int16_t _W = TFT_WIDTH, int16_t _H = TFT_HEIGHT );
+    virtual ~TFT_eSPI();
+
+    void init( uint8_t tc = 0 ), begin( uint8_t tc = 0 );
+
+    // Virtual leaves — every other primitive is built from these
+    virtual void    drawPixel( int32_t x, int32_t y, uint32_t color );
+    virtual void    drawChar( int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size );
+    virtual void    drawLine( int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color );
+    virtual void    drawFastVLine( int32_t x, int32_t y, int32_t h, uint32_t color );
+    virtual void    drawFastHLine( int32_t x, int32_t y, int32_t w, uint32_t color );
+    virtual void    fillRect( int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color );
+    virtual int16_t drawChar( uint16_t uniCode, int32_t x, int32_t y, uint8_t font );
+    virtual int16_t drawChar( uint16_t uniCode, int32_t x, int32_t y );
+    virtual int16_t width( void );
+    virtual int16_t height( void );
+    virtual uint16_t readPixel( int32_t x, int32_t y );
+
+    void    setRotation( uint8_t r );
+    uint8_t getRotation( void );
+    void    invertDisplay( bool i );
+
+    // Viewport
+    void    setViewport( int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum = true );
+    bool    checkViewport( int32_t x, int32_t y, int32_t w, int32_t h );
+    int32_t getViewportX( void ), getViewportY( void ), getViewportWidth( void ), getViewportHeight( void );
+    bool    getViewportDatum( void );
+    void    frameViewport( uint16_t color, int32_t w );
+    void    resetViewport( void );
+
+    // Shapes
+    void fillScreen( uint32_t color );
+    void drawRect( int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color );
+    void drawRoundRect( int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color );
+    void fillRoundRect( int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color );
+    void fillRectVGradient( int16_t x, int16_t y, int16_t w, int16_t h, uint32_t color1, uint32_t color2 );
+    void fillRectHGradient( int16_t x, int16_t y, int16_t w, int16_t h, uint32_t color1, uint32_t color2 );
+    void drawCircle( int32_t x, int32_t y, int32_t r, uint32_t color );
+    void drawCircleHelper( int32_t x, int32_t y, int32_t r, uint8_t cornername, uint32_t color );
+    void fillCircle( int32_t x, int32_t y, int32_t r, uint32_t color );
+    void fillCircleHelper( int32_t x, int32_t y, int32_t r, uint8_t cornername, int32_t delta, uint32_t color );
+    void drawTriangle( int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t color );
+    void fillTriangle( int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t color );
+
+    // Anti-aliased shapes. bg_color 0x00FFFFFF blends with what is already drawn.
+    uint16_t drawPixel( int32_t x, int32_t y, uint32_t color, uint8_t alpha, uint32_t bg_color = 0x00FFFFFF );
+    void     drawSmoothCircle( int32_t x, int32_t y, int32_t r, uint32_t fg_color, uint32_t bg_color );
+    void     fillSmoothCircle( int32_t x, int32_t y, int32_t r, uint32_t color, uint32_t bg_color = 0x00FFFFFF );
+    void     fillSmoothRoundRect( int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color, uint32_t bg_color = 0x00FFFFFF );
+    void     drawSpot( float ax, float ay, float r, uint32_t fg_color, uint32_t bg_color = 0x00FFFFFF );
+    void     drawWideLine( float ax, float ay, float bx, float by, float wd, uint32_t fg_color, uint32_t bg_color = 0x00FFFFFF );
+    void     drawWedgeLine( float ax, float ay, float bx, float by, float aw, float bw, uint32_t fg_color, uint32_t bg_color = 0x00FFFFFF );
+
+    // Bitmaps and images
+    void setSwapBytes( bool swap );
+    bool getSwapBytes( void );
+    void drawBitmap( int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t fgcolor );
+    void drawBitmap( int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t fgcolor, uint16_t bgcolor );
+    void drawXBitmap( int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t fgcolor );
+    void drawXBitmap( int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t fgcolor, uint16_t bgcolor );
+    void setBitmapColor( uint16_t fgcolor, uint16_t bgcolor );
+    void readRect( int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data );
+    void pushRect( int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data );
+    void pushImage( int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data );
+    void pushImage( int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data );
+    void pushImage( int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t transparent );
+    void pushImage( int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, uint16_t transparent );
+    void pushImage( int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t *data, bool bpp8 = true, uint16_t *cmap = nullptr );
+    void pushImage( int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *data, bool bpp8 = true, uint16_t *cmap = nullptr );
+
+    // Text
+    void     setCursor( int16_t x, int16_t y ), setCursor( int16_t x, int16_t y, uint8_t font );
+    int16_t  getCursorX( void ), getCursorY( void );
+    void     setTextColor( uint16_t color ), setTextColor( uint16_t fgcolor, uint16_t bgcolor, bool bgfill = false );
+    void     setTextSize( uint8_t size ), setTextWrap( bool wrapX, bool wrapY = false ), setTextDatum( uint8_t datum );
+    void     setTextPadding( uint16_t x_width );
+    uint8_t  getTextDatum( void );
+    uint16_t getTextPadding( void );
+    void     setFreeFont( const GFXfont *f = NULL ), setTextFont( uint8_t font );
+    int16_t  textWidth( const char *string, uint8_t font ), textWidth( const char *string );
+    int16_t  textWidth( const String &string, uint8_t font ), textWidth( const String &string );
+    int16_t  fontHeight( uint8_t font ), fontHeight( void );
+    int16_t  drawNumber( long intNumber, int32_t x, int32_t y, uint8_t font ), drawNumber( long intNumber, int32_t x, int32_t y );
+    int16_t  drawFloat( float floatNumber, uint8_t decimal, int32_t x, int32_t y, uint8_t font );
+    int16_t  drawFloat( float floatNumber, uint8_t decimal, int32_t x, int32_t y );
+    int16_t  drawString( const char *string, int32_t x, int32_t y, uint8_t font ), drawString( const char *string, int32_t x, int32_t y );
+    int16_t  drawString( const String &string, int32_t x, int32_t y, uint8_t font ), drawString( const String &string, int32_t x, int32_t y );
+    int16_t  drawCentreString( const char *string, int32_t x, int32_t y, uint8_t font );
+    int16_t  drawRightString( const char *string, int32_t x, int32_t y, uint8_t font );
+    int16_t  drawCentreString( const String &string, int32_t x, int32_t y, uint8_t font );
+    int16_t  drawRightString( const String &string, int32_t x, int32_t y, uint8_t font );
+    size_t   write( uint8_t c ) override;
+    using Print::write;
+
+    // Colour helpers
+    uint16_t color565( uint8_t red, uint8_t green, uint8_t blue );
+    uint16_t color8to16( uint8_t color332 );
+    uint8_t  color16to8( uint16_t color565 );
+    uint32_t color16to24( uint16_t color565 );
+    uint32_t color24to16( uint32_t color888 );
+    uint16_t alphaBlend( uint8_t alpha, uint16_t fgc, uint16_t bgc );
+
+    // Transactions and DMA — synchronous on the host
+    void startWrite( void ), endWrite( void );
+    bool initDMA( bool ctrl_cs = false );
+    void deInitDMA( void );
+    void pushImageDMA( int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t *buffer = nullptr );
+    bool dmaBusy( void );
+    void dmaWait( void );
+
+    // --- Host-only ---
+    const HostGfxCounters &hostCounters() const {
+        return counters;
+    }
+    void     hostResetCounters();
+    bool     hostSavePNG( const char *path );
+    uint32_t hostChecksum();
+
+    uint32_t       textcolor, textbgcolor;
+    int32_t        cursor_x, cursor_y, padX;
+    uint8_t        textfont, textsize, textdatum, rotation;
+    uint16_t       bitmap_fg, bitmap_bg;
+    const GFXfont *gfxFont;
+
+protected:
+    // Storage hooks, absolute and already clipped. Native RGB565 colours.
+    virtual void     hostFill( int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color );
+    virtual void     hostWriteRow( int32_t x, int32_t y, int32_t w, const uint16_t *colors );
+    virtual uint16_t hostRead( int32_t x, int32_t y );
+
+    // Applies the viewport datum and clips; false when nothing is left
+    bool clipRect( int32_t &x, int32_t &y, int32_t &w, int32_t &h );
+    bool clipImage( int32_t &x, int32_t &y, int32_t &w, int32_t &h, int32_t &dx, int32_t &dy );
+
+    void countWindow( uint32_t px );
+    void pushRows( int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, int32_t stride, bool swap, bool transparent, uint16_t key );
+    void drawMask( int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t *mask, uint8_t size );
+    void drawGfxChar( int32_t x, int32_t y, uint16_t c, uint32_t color, uint8_t size );
+    void smoothShape( float fx0, float fy0, float fx1, float fy1, float ( *sdf )( float, float, const float * ), const float *args, uint32_t fg, uint32_t bg );
+    void allocFrame();
+
+    int32_t  _init_width, _init_height, _width, _height;
+    int32_t  _vpX, _vpY, _vpW, _vpH, _xDatum, _yDatum, _xWidth, _yHeight;
+    bool     _vpDatum, _vpOoB, _swapBytes, _invert, textwrapX, textwrapY;
+    uint8_t  glyph_ab, glyph_bb;
+    uint16_t *_frame;
+
+    HostGfxCounters counters;
+    int             callDepth;
+
+    friend struct HostCall;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+    explicit TFT_eSprite( TFT_eSPI *tft );
+    ~TFT_eSprite( void );
+
+    void   *createSprite( int16_t width, int16_t height, uint8_t frames = 1 );
+    void   *getPointer( void );
+    bool    created( void );
+    void    deleteSprite( void );
+    void   *setColorDepth( int8_t b );
+    int8_t  getColorDepth( void );
+    void    createPalette( uint16_t *palette = nullptr, uint8_t colors = 16 );
+    void    createPalette( const uint16_t *palette = nullptr, uint8_t colors = 16 );
+    void    setPaletteColor( uint8_t index, uint16_t color );
+    uint16_t getPaletteColor( uint8_t index );
+    void    setBitmapColor( uint16_t fg, uint16_t bg );
+
+    void     fillSprite( uint32_t color );
+    uint16_t readPixelValue( int32_t x, int32_t y );
+
+    void pushSprite( int32_t x, int32_t y );
+    void pushSprite( int32_t x, int32_t y, uint16_t transparent );
+    bool pushSprite( int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh );
+    bool pushToSprite( TFT_eSprite *dspr, int32_t x, int32_t y );
+    bool pushToSprite( TFT_eSprite *dspr, int32_t x, int32_t y, uint16_t transparent );
+
+protected:
+    void     hostFill( int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color ) override;
+    void     hostWriteRow( int32_t x, int32_t y, int32_t w, const uint16_t *colors ) override;
+    uint16_t hostRead( int32_t x, int32_t y ) override;
+
+    void pushRegion( TFT_eSPI *dst, int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh, bool transparent, uint16_t key );
+
+    TFT_eSPI *_tft;
+    uint8_t  *_img8;        // Pixel memory in the sprite's native layout
+    uint16_t *_colorMap;    // 4 bpp palette
+    int32_t   _iwidth, _iheight;
+    uint8_t   _bpp;
+};
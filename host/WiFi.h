@@ -0,0 +1,28 @@
+#pragma once
+
+// ---------------------------------------------------------------------------
+// Host stand-in for WiFi.h: the renderer only asks for the link state, which
+// a scene can set through WiFi.hostStatus.
+// ---------------------------------------------------------------------------
+
+#include <Arduino.h>
+
+enum wl_status_t {
+    WL_IDLE_STATUS,
+    WL_NO_SSID_AVAIL,
+    WL_SCAN_COMPLETED,
+    WL_CONNECTED,
+    WL_CONNECT_FAILED,
+    WL_CONNECTION_LOST,
+    WL_DISCONNECTED
+};
+
+class WiFiClass {
+public:
+    wl_status_t status() {
+        return hostStatus;
+    }
+    wl_status_t hostStatus = WL_CONNECTED;
+};
+
+inline WiFiClass WiFi;
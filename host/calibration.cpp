@@ -0,0 +1,100 @@
+// ---------------------------------------------------------------------------
+// Touch calibration accuracy — run by render_main after the gesture table
+//
+// A model panel whose raw axes are scaled, offset, turned 1.5° and slightly
+// skewed against the display (as a CYD overlay glued on a little crooked) is
+// "tapped" at the calibration targets with a few ADC counts of noise. Both
+// calibrations are then checked on a 10 px grid of noise-free points:
+//
+//   two-point   the old routine: targets (20, 20) and (300, 220), per-axis
+//               linear extrapolation into a min / max range
+//   affine      touch_cal.h: five targets, least-squares 2×3 matrix
+//
+// Error is the distance from the true pixel, over the whole grid and over the
+// band within 20 px of the panel edges.
+// ---------------------------------------------------------------------------
+
+#include <Arduino.h>
+
+#include <math.h>
+
+#include "../src/hal/touch_cal.h"
+
+// Screen pixel → raw ADC for the model panel
+static void panelRaw( float sx, float sy, float &rx, float &ry ) {
+    const float ROT = 1.5f * ( float )M_PI / 180.0f;
+    float       u   = sx * cosf( ROT ) - sy * sinf( ROT );
+    float       v   = sx * sinf( ROT ) + sy * cosf( ROT ) + 0.02f * sx;     // Skew
+    rx              = 230.0f + 11.4f * u;
+    ry              = 170.0f + 15.3f * v;
+}
+
+static uint32_t rng = 777;
+
+static float noise( float amp ) {
+    rng = rng * 1103515245 + 12345;
+    return ( ( float )( ( rng >> 16 ) % 2001 ) / 1000.0f - 1.0f ) * amp;
+}
+
+struct CalError {
+    float meanAll, maxAll, meanEdge, maxEdge;
+};
+
+static CalError measure( const TouchCal &cal ) {
+    CalError e  = { 0, 0, 0, 0 };
+    int      nA = 0, nE = 0;
+    for ( int sy = 0; sy < 240; sy += 10 ) {
+        for ( int sx = 0; sx < 320; sx += 10 ) {
+            float rx, ry;
+            panelRaw( sx + 0.5f, sy + 0.5f, rx, ry );
+            int16_t x, y;
+            touchCalApply( cal, ( int16_t )lroundf( rx ), ( int16_t )lroundf( ry ), x, y );
+            float d = hypotf( ( float )( x - sx ), ( float )( y - sy ) );
+            e.meanAll += d;
+            e.maxAll   = max( e.maxAll, d );
+            nA++;
+            if ( sx < 20 || sx >= 300 || sy < 20 || sy >= 220 ) {
+                e.meanEdge += d;
+                e.maxEdge   = max( e.maxEdge, d );
+                nE++;
+            }
+        }
+    }
+    e.meanAll  /= nA;
+    e.meanEdge /= nE;
+    return e;
+}
+
+// Prints both calibrations' error; returns 1 if the affine fit is not the better one
+int calibrationReport() {
+    static const int16_t TX[ TOUCH_CAL_POINTS ] = { 20, 300, 300,  20, 160 };
+    static const int16_t TY[ TOUCH_CAL_POINTS ] = { 20,  20, 220, 220, 120 };
+    int16_t              rawX[ TOUCH_CAL_POINTS ], rawY[ TOUCH_CAL_POINTS ];
+    for ( int i = 0; i < TOUCH_CAL_POINTS; i++ ) {
+        float rx, ry;
+        panelRaw( TX[ i ], TY[ i ], rx, ry );
+        rawX[ i ] = ( int16_t )lroundf( rx + noise( 6 ) );
+        rawY[ i ] = ( int16_t )lroundf( ry + noise( 6 ) );
+    }
+
+    // The old two-point routine on taps 1 and 3
+    float    scaleX = ( float )( rawX[ 2 ] - rawX[ 0 ] ) / ( TX[ 2 ] - TX[ 0 ] );
+    float    scaleY = ( float )( rawY[ 2 ] - rawY[ 0 ] ) / ( TY[ 2 ] - TY[ 0 ] );
+    TouchCal twoPoint;
+    touchCalFromRange( twoPoint, ( int )( rawX[ 0 ] - TX[ 0 ] * scaleX ), ( int )( rawX[ 0 ] + ( 320 - TX[ 0 ] ) * scaleX ),
+                       ( int )( rawY[ 0 ] - TY[ 0 ] * scaleY ), ( int )( rawY[ 0 ] + ( 240 - TY[ 0 ] ) * scaleY ) );
+
+    TouchCal    affine;
+    TouchCalFit fit;
+    if ( !touchCalSolve( rawX, rawY, TX, TY, TOUCH_CAL_POINTS, affine, fit ) ) {
+        printf( "\ncalibration: affine solve failed\n" );
+        return 1;
+    }
+
+    CalError a = measure( twoPoint ), b = measure( affine );
+    printf( "\n%-14s %8s %8s %8s %8s   (px)\n", "calibration", "mean", "max", "edge", "edge max" );
+    printf( "%-14s %8.2f %8.2f %8.2f %8.2f\n", "two-point", a.meanAll, a.maxAll, a.meanEdge, a.maxEdge );
+    printf( "%-14s %8.2f %8.2f %8.2f %8.2f   residual rms %u.%u max %u.%u\n", "affine", b.meanAll, b.maxAll,
+            b.meanEdge, b.maxEdge, fit.rms10 / 10, fit.rms10 % 10, fit.max10 / 10, fit.max10 % 10 );
+    return b.maxEdge < a.maxEdge && b.meanAll < a.meanAll ? 0 : 1;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+// ---------------------------------------------------------------------------
+// Host stand-in for esp_heap_caps.h — capabilities are ignored.
+// ---------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT     ( 1 << 2 )
+#define MALLOC_CAP_DMA      ( 1 << 3 )
+#define MALLOC_CAP_INTERNAL ( 1 << 11 )
+
+inline void *heap_caps_malloc( size_t size, uint32_t ) {
+    return malloc( size );
+}
+
+inline void heap_caps_free( void *ptr ) {
+    free( ptr );
+}
+
+// No heap to report on the host; the clock's heap log prints zeros
+inline size_t heap_caps_get_free_size( uint32_t ) {
+    return 0;
+}
+
+inline size_t heap_caps_get_minimum_free_size( uint32_t ) {
+    return 0;
+}
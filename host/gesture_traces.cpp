@@ -0,0 +1,405 @@
+// ---------------------------------------------------------------------------
+// Gesture accuracy over touch traces — run by render_main after the scenes
+//
+// Each trace is a raw controller sample stream at TOUCH_SAMPLE_MS (x, y in
+// ADC units, z pressure, 0 = not touched) with the noise the XPT2046 shows on
+// the CYD: a few counts of jitter, single-sample spikes, a light first
+// sample, landing samples off to one side while the finger settles, and
+// pressure dips mid-press. Every trace runs through two pipelines:
+//
+//   filtered   touch_filter.h, as the touch task does
+//   raw        every touched sample taken as is, released on the first z = 0
+//              (the old loop() poll)
+//
+// and the recognised gestures are compared with the one the trace was made of.
+// For taps and long presses the positions are also compared with the point
+// the press was made at (mean / worst error in screen px): the TOUCH_DOWN event
+// (what the keyboard and the other non-paging screens act on) in both
+// pipelines, and the recognised gesture in the filtered one.
+// The filtered pipeline reads each trace back through the touch_trace.h codec,
+// as the device replayer does; all of them are also written out as one trace
+// file (<outdir>/gestures.trace) for replay on the device.
+//
+// gestureTraceReplay() runs a recorded trace file (binary, or the TRACE hex
+// lines of a serial log) through the same pipeline and lists its gestures with
+// their recognition delay in trace time.
+// ---------------------------------------------------------------------------
+
+#include <Arduino.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+
+#include "../src/hal/touch_cal.h"
+#include "../src/hal/touch_filter.h"
+#include "../src/hal/touch_trace.h"
+#include "../src/ui/gesture.h"
+#include "../src/util/constants.h"
+
+struct RawSample {
+    int16_t  x, y;
+    uint16_t z;
+};
+
+struct Trace {
+    const char            *name;
+    GestureType            expect;
+    SwipeDir               dir;
+    float                  x, y;        // Where the press was made, screen px
+    std::vector<RawSample> samples;
+};
+
+// Default calibration (main.cpp): 200..3900 on both axes
+static int16_t toRawX( float px ) {
+    return ( int16_t )( 200 + px * 3700 / 320 );
+}
+
+static int16_t toRawY( float py ) {
+    return ( int16_t )( 200 + py * 3700 / 240 );
+}
+
+static uint32_t rng = 12345;
+
+static int noise( int amp ) {
+    rng = rng * 1103515245 + 12345;
+    return ( int )( ( rng >> 16 ) % ( 2 * amp + 1 ) ) - amp;
+}
+
+// A press from (x0, y0) to (x1, y1): moves for moveMs after holdMs still,
+// then holds still for tailMs. Spikes every spikeEvery samples (0 = none),
+// one dropout sample at dipAt (-1 = none).
+static Trace makeTrace( const char *name, GestureType expect, SwipeDir dir,
+                        float x0, float y0, float x1, float y1,
+                        int holdMs, int moveMs, int tailMs, int spikeEvery, int dipAt ) {
+    Trace t   = { name, expect, dir, x0, y0, {} };
+    int   n   = ( holdMs + moveMs + tailMs ) / TOUCH_SAMPLE_MS;
+    int   nh  = holdMs / TOUCH_SAMPLE_MS;
+    int   nm  = max( 1, moveMs / TOUCH_SAMPLE_MS );
+    t.samples.push_back( { 0, 0, 0 } );
+    for ( int i = 0; i < n; i++ ) {
+        float f = constrain( ( float )( i - nh ) / nm, 0.0f, 1.0f );
+        float px = x0 + ( x1 - x0 ) * f;
+        float py = y0 + ( y1 - y0 ) * f;
+        RawSample s = { ( int16_t )( toRawX( px ) + noise( 25 ) ), ( int16_t )( toRawY( py ) + noise( 25 ) ),
+                        ( uint16_t )( 900 + noise( 150 ) ) };
+        if ( i < 2 ) {
+            // Finger still landing: light and ~10 px off, then full pressure and ~3 px off
+            int skew = i == 0 ? 3 : 1;
+            s.x += ( int16_t )( skew * ( 40 + noise( 20 ) ) );
+            s.y += ( int16_t )( skew * ( 30 + noise( 20 ) ) );
+            s.z  = i == 0 ? 450 : s.z;
+        }
+        if ( spikeEvery > 0 && i % spikeEvery == spikeEvery / 2 ) {
+            s.x += 350;
+            s.y -= 300;
+        }
+        if ( i == dipAt ) {
+            s.z = 0;
+        }
+        t.samples.push_back( s );
+    }
+    for ( int i = 0; i < 6; i++ ) {
+        t.samples.push_back( { 0, 0, 0 } );
+    }
+    return t;
+}
+
+static std::vector<Trace> buildTraces() {
+    std::vector<Trace> traces;
+    for ( int v = 0; v < 4; v++ ) {
+        float x = 40 + v * 70, y = 60 + v * 35;
+        traces.push_back( makeTrace( "tap", GESTURE_TAP, SWIPE_LEFT, x, y, x, y, 60 + v * 40, 0, 0, 0, -1 ) );
+        traces.push_back( makeTrace( "tap-spike", GESTURE_TAP, SWIPE_LEFT, x, y, x, y, 120, 0, 0, 5, -1 ) );
+        traces.push_back( makeTrace( "tap-dip", GESTURE_TAP, SWIPE_LEFT, x, y, x, y, 150, 0, 0, 0, 6 ) );
+        traces.push_back( makeTrace( "long-press", GESTURE_LONG_PRESS, SWIPE_LEFT, x, y, x, y, 900 + v * 100, 0, 0, 9, 40 ) );
+        traces.push_back( makeTrace( "swipe-left", GESTURE_SWIPE, SWIPE_LEFT, 260, y, 100 - v * 10, y + 10, 30, 150, 0, 0, -1 ) );
+        traces.push_back( makeTrace( "swipe-right", GESTURE_SWIPE, SWIPE_RIGHT, 60, y, 220 + v * 10, y - 8, 30, 160, 0, 0, 8 ) );
+        traces.push_back( makeTrace( "swipe-up", GESTURE_SWIPE, SWIPE_UP, x, 200, x + 6, 80 - v * 10, 20, 140, 0, 0, -1 ) );
+        traces.push_back( makeTrace( "swipe-down", GESTURE_SWIPE, SWIPE_DOWN, x, 50, x - 5, 170 + v * 10, 20, 150, 0, 7, -1 ) );
+        traces.push_back( makeTrace( "drag", GESTURE_DRAG_END, SWIPE_LEFT, x, 60, x, 160, 30, 900, 150, 0, 50 ) );
+    }
+    return traces;
+}
+
+static const char *GESTURE_NAMES[] = { "tap", "long-press", "swipe", "drag", "drag-end" };
+static const char *SWIPE_NAMES[]   = { "left", "right", "up", "down" };
+
+// A completed gesture from a replay, with trace times (ms)
+struct Recognised {
+    Gesture  g;
+    uint32_t ms;            // Sample that completed it
+    uint32_t pressMs;       // First touched sample of its press
+    uint32_t downMs;        // Sample that produced TOUCH_DOWN
+    uint32_t liftMs;        // Last touched sample (releases only)
+    int16_t  downX, downY;  // TOUCH_DOWN position of its press
+};
+
+static void encodeTrace( const std::vector<RawSample> &samples, uint32_t gapMs, std::vector<uint8_t> &out ) {
+    uint8_t buf[ 4 * TOUCH_TRACE_RECORD ];
+    if ( out.empty() ) {
+        out.resize( TOUCH_TRACE_HEADER );
+        touchTraceHeader( out.data(), 0 );
+    }
+    uint32_t dt = gapMs;
+    for ( const RawSample &r : samples ) {
+        size_t n = touchTraceEncode( buf, sizeof( buf ), dt, r.x, r.y, r.z );
+        out.insert( out.end(), buf, buf + n );
+        dt = TOUCH_SAMPLE_MS;
+    }
+}
+
+// Filter → calibration → gestures over a whole trace, as the touch task and
+// loop() do; returns false if data is not a trace
+static bool replay( const uint8_t *data, size_t len, std::vector<Recognised> &out ) {
+    TouchTraceReader rd;
+    if ( !touchTraceOpen( rd, data, len ) ) {
+        return false;
+    }
+    TouchFilter    f;
+    GestureTracker g;
+    TouchCal       cal;
+    touchCalFromRange( cal, 200, 3900, 200, 3900 );
+    if ( rd.flags & TOUCH_TRACE_FLIPPED ) {
+        touchCalRotate180( cal );
+    }
+    touchFilterReset( f );
+    gestureReset( g );
+
+    TouchSample s;
+    uint32_t    pressMs = 0, downMs = 0, liftMs = 0;
+    int16_t     downX = 0, downY = 0;
+    bool        touched = false;
+    while ( touchTraceNext( rd, s ) ) {
+        if ( s.z >= TOUCH_Z_HOLD ) {
+            if ( !touched ) {
+                pressMs = s.ms;
+            }
+            touched = true;
+            liftMs  = s.ms;
+        }
+        TouchFilterResult r = touchFilterFeed( f, s.rawX, s.rawY, s.z );
+        if ( r == TF_NONE ) {
+            continue;
+        }
+        TouchEvent ev = { r == TF_DOWN ? TOUCH_DOWN : r == TF_MOVE ? TOUCH_MOVE : TOUCH_UP,
+                          0, 0, touchFilterX( f ), touchFilterY( f ), s.z, s.ms * 1000 };
+        touchCalApply( cal, ev.rawX, ev.rawY, ev.x, ev.y );
+        if ( r == TF_DOWN ) {
+            downMs = s.ms;
+            downX  = ev.x;
+            downY  = ev.y;
+        }
+        Gesture out1;
+        if ( gestureFeed( g, ev, out1 ) && out1.type != GESTURE_DRAG ) {
+            out.push_back( { out1, s.ms, pressMs, downMs, liftMs, downX, downY } );
+        }
+        if ( r == TF_UP ) {
+            touched = false;
+        }
+    }
+    return true;
+}
+
+static float posError( const Trace &t, int x, int y ) {
+    return hypotf( x - t.x, y - t.y );
+}
+
+// Runs one trace through a pipeline; true if exactly the expected gesture came
+// out. downErr gets the distance of the first TOUCH_DOWN from the press point,
+// err that of the gesture.
+static bool recognise( const Trace &t, bool filtered, float &downErr, float &err ) {
+    downErr = err = 0;
+    if ( filtered ) {
+        std::vector<uint8_t>    bytes;
+        std::vector<Recognised> found;
+        encodeTrace( t.samples, 0, bytes );
+        replay( bytes.data(), bytes.size(), found );
+        if ( !found.empty() ) {
+            downErr = posError( t, found[ 0 ].downX, found[ 0 ].downY );
+            err     = posError( t, found[ 0 ].g.x, found[ 0 ].g.y );
+        }
+        return found.size() == 1 && found[ 0 ].g.type == t.expect &&
+               ( t.expect != GESTURE_SWIPE || found[ 0 ].g.dir == t.dir );
+    }
+
+    // Unfiltered: every touched sample as is, released on the first z = 0
+    GestureTracker g;
+    TouchCal       cal;
+    touchCalFromRange( cal, 200, 3900, 200, 3900 );
+    gestureReset( g );
+
+    int      found   = 0;
+    bool     match   = false;
+    bool     down    = false;
+    bool     pressed = false;
+    uint32_t us      = 0;
+    for ( const RawSample &s : t.samples ) {
+        us += TOUCH_SAMPLE_MS * 1000;
+        if ( s.z < TOUCH_Z_HOLD && !down ) {
+            continue;
+        }
+        TouchEvent ev = { s.z >= TOUCH_Z_HOLD ? ( down ? TOUCH_MOVE : TOUCH_DOWN ) : TOUCH_UP, 0, 0, s.x, s.y, s.z, us };
+        touchCalApply( cal, ev.rawX, ev.rawY, ev.x, ev.y );
+        if ( ev.type == TOUCH_DOWN && !pressed ) {
+            downErr = posError( t, ev.x, ev.y );
+            pressed = true;
+        }
+        down = s.z >= TOUCH_Z_HOLD;
+
+        Gesture out;
+        if ( gestureFeed( g, ev, out ) && out.type != GESTURE_DRAG ) {
+            found++;
+            match = out.type == t.expect && ( out.type != GESTURE_SWIPE || out.dir == t.dir );
+            err   = posError( t, out.x, out.y );
+        }
+    }
+    return found == 1 && match;
+}
+
+// Position error over presses: count, sum and worst, in screen px
+struct ErrStat {
+    int   n;
+    float sum, worst;
+
+    void add( float e ) {
+        n++;
+        sum  += e;
+        worst = max( worst, e );
+    }
+
+    void add( const ErrStat &o ) {
+        n     += o.n;
+        sum   += o.sum;
+        worst  = max( worst, o.worst );
+    }
+
+    void print() const {
+        if ( n == 0 ) {
+            printf( "  %-11s", "    -" );
+            return;
+        }
+        printf( "  %4.1f / %-4.1f", sum / n, worst );
+    }
+};
+
+// Prints the per-kind and overall accuracy and writes every trace, a second
+// apart, to path; returns the filtered pipeline's misses
+int gestureTraceReport( const char *path ) {
+    std::vector<Trace>   traces = buildTraces();
+    std::vector<uint8_t> all;
+    for ( const Trace &t : traces ) {
+        encodeTrace( t.samples, all.empty() ? 0 : 1000, all );
+    }
+    FILE *fp = fopen( path, "wb" );
+    if ( fp != nullptr ) {
+        fwrite( all.data(), 1, all.size(), fp );
+        fclose( fp );
+    }
+
+    // Error columns, mean / max px, for taps and long presses: where TOUCH_DOWN
+    // landed in each pipeline, and the recognised gesture (filtered, when right)
+    printf( "\n%-14s %8s %8s  %-11s  %-11s  %-11s\n", "gesture", "filtered", "raw",
+            "down filt", "down raw", "tap filt" );
+    static const char *KINDS[] = { "tap", "tap-spike", "tap-dip", "long-press", "swipe-left",
+                                   "swipe-right", "swipe-up", "swipe-down", "drag" };
+    int     okF = 0, okR = 0;
+    ErrStat allDownF = {}, allDownR = {}, allTapF = {};
+    for ( const char *kind : KINDS ) {
+        int     n = 0, f = 0, r = 0;
+        bool    point = false;
+        ErrStat downF = {}, downR = {}, tapF = {};
+        for ( const Trace &t : traces ) {
+            if ( strcmp( t.name, kind ) != 0 ) {
+                continue;
+            }
+            float dF, eF, dR, eR;
+            bool  hitF = recognise( t, true, dF, eF );
+            bool  hitR = recognise( t, false, dR, eR );
+            point = t.expect == GESTURE_TAP || t.expect == GESTURE_LONG_PRESS;
+            n++;
+            f += hitF;
+            r += hitR;
+            downF.add( dF );
+            downR.add( dR );
+            if ( hitF ) {
+                tapF.add( eF );
+            }
+        }
+        printf( "%-14s %5d/%-2d %5d/%-2d", kind, f, n, r, n );
+        if ( point ) {
+            downF.print();
+            downR.print();
+            tapF.print();
+            allDownF.add( downF );
+            allDownR.add( downR );
+            allTapF.add( tapF );
+        }
+        printf( "\n" );
+        okF += f;
+        okR += r;
+    }
+    int total = ( int )traces.size();
+    printf( "%-14s %5d/%-2d %5d/%-2d", "all", okF, total, okR, total );
+    allDownF.print();
+    allDownR.print();
+    allTapF.print();
+    printf( "\n" );
+    return total - okF;
+}
+
+// Lists the gestures in a recorded trace; returns 1 if it cannot be read
+int gestureTraceReplay( const char *path ) {
+    std::vector<uint8_t> bytes;
+    FILE                *fp = fopen( path, "rb" );
+    if ( fp == nullptr ) {
+        printf( "\n%s: cannot open\n", path );
+        return 1;
+    }
+    char head[ 4 ] = { 0 };
+    size_t got     = fread( head, 1, sizeof( head ), fp );
+    rewind( fp );
+    if ( got == 4 && memcmp( head, "CYDT", 4 ) == 0 ) {
+        int c;
+        while ( ( c = fgetc( fp ) ) != EOF ) {
+            bytes.push_back( ( uint8_t )c );
+        }
+    }
+    else {
+        // Serial log: the hex after each "TRACE " up to "TRACE END"
+        char line[ 512 ];
+        while ( fgets( line, sizeof( line ), fp ) != nullptr ) {
+            const char *p = strstr( line, "TRACE " );
+            if ( p == nullptr || strncmp( p, "TRACE END", 9 ) == 0 ) {
+                continue;
+            }
+            unsigned v;
+            for ( p += 6; sscanf( p, "%2x", &v ) == 1; p += 2 ) {
+                bytes.push_back( ( uint8_t )v );
+            }
+        }
+    }
+    fclose( fp );
+
+    std::vector<Recognised> found;
+    if ( !replay( bytes.data(), bytes.size(), found ) ) {
+        printf( "\n%s: not a touch trace\n", path );
+        return 1;
+    }
+    printf( "\n%s: %zu bytes, %zu gestures   (trace ms; filter = first touch to DOWN, "
+            "after lift = last touched sample to gesture)\n", path, bytes.size(), found.size() );
+    for ( const Recognised &r : found ) {
+        char what[ 24 ];
+        snprintf( what, sizeof( what ), "%s%s%s", GESTURE_NAMES[ r.g.type ], r.g.type == GESTURE_SWIPE ? " " : "",
+                  r.g.type == GESTURE_SWIPE ? SWIPE_NAMES[ r.g.dir ] : "" );
+        printf( "%8lu  %-12s at %3d,%3d  filter %3lu ms", ( unsigned long )r.ms, what, r.g.x, r.g.y,
+                ( unsigned long )( r.downMs - r.pressMs ) );
+        if ( r.g.type == GESTURE_LONG_PRESS ) {
+            printf( "  after press %lu ms\n", ( unsigned long )( r.ms - r.pressMs ) );
+        }
+        else {
+            printf( "  after lift %3lu ms\n", ( unsigned long )( r.ms - r.liftMs ) );
+        }
+    }
+    return 0;
+}
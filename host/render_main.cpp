@@ -0,0 +1,409 @@
+// ---------------------------------------------------------------------------
+// Host renderer ([env:native]) — draws the UI modules into the framebuffer
+// backend, one scene at a time, and for each scene writes <outdir>/<scene>.png
+// and a report line to stdout:
+//
+//   scene  us  calls  windows  pixels  crc32  golden
+//
+// The checksums are stable across runs and are compared with each scene's
+// golden CRC (SCENES below); a mismatch fails the run. The timings give a
+// rough render-speed trend (host CPU, not the ESP32). The Weather, Regional
+// and Firmware display lists are then checked against their direct drawing
+// code (host/screens_direct.cpp), followed by gesture accuracy over
+// synthesised touch traces, touch calibration accuracy on a model panel, and
+// a gesture listing for each touch trace given (host/gesture_traces.cpp).
+// Usage: .pio/build/native/program [outdir [trace ...]]   (default: render_out)
+// ---------------------------------------------------------------------------
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#include <sys/stat.h>
+
+#include "../src/data/app_state.h"
+#include "../src/net/weather_api.h"
+#include "../src/ui/clock_face.h"
+#include "../src/ui/digit_atlas.h"
+#include "../src/ui/dma_push.h"
+#include "../src/ui/gfx_stats.h"
+#include "../src/ui/icons.h"
+#include "../src/ui/theme.h"
+#include "../src/util/constants.h"
+#include "../src/util/moon.h"
+
+// ---------------------------------------------------------------------------
+// Globals the UI modules expect from main.cpp (same defaults)
+// ---------------------------------------------------------------------------
+DisplayTFT  tft;
+bool        isWhiteTheme     = false;
+bool        updateAvailable  = false;
+int         digitTransition  = DIGIT_FX_SLIDE;
+int         themeMode        = THEME_DARK;
+float       lat              = 0;
+float       lon              = 0;
+String      cityName         = "Plzen";
+bool        regionAutoMode   = true;
+bool        manualDstActive  = false;
+long        gmtOffset_sec    = 3600;
+const char *FIRMWARE_VERSION = "2.0.0";
+String      availableVersion = "";
+int         otaInstallMode   = 1;
+bool        isDigitalClock   = false;
+bool        is12hFormat      = false;
+bool        sweepMode        = false;
+bool        forceClockRedraw = false;
+int         lastHour = -1, lastMin = -1, lastSec = -1;
+int         moonPhaseVal     = 0;
+String      selectedCountry  = "";
+ScreenState currentState     = CLOCK;
+
+extern const int clockX = 230;
+extern const int clockY = 85;
+extern const int radius = 67;
+
+extern const unsigned char icon_sunrise[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x01, 0x80, 0x03, 0xc0, 0x05, 0xa0,
+    0x09, 0x90, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+extern const unsigned char icon_sunset[] = {
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x09, 0x90, 0x05, 0xa0, 0x03, 0xc0,
+    0x01, 0x80, 0x7f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// net/weather_api.cpp is not built (HTTP, JSON); the clock scenes have no
+// fetched weather, so its text helpers are never reached
+String getWeatherDesc( int ) {
+    return "";
+}
+
+String getWindDir( int ) {
+    return "";
+}
+
+// host/gesture_traces.cpp, host/calibration.cpp
+int gestureTraceReport( const char *path );
+int gestureTraceReplay( const char *path );
+int calibrationReport();
+
+// host/screens_direct.cpp
+void screenListsRecord();
+void screenListScene( int screen, int mode );
+int  screenListReport();
+
+// ---------------------------------------------------------------------------
+
+static const char *outDir = "render_out";
+
+typedef void ( *SceneFn )();
+
+// Expected CRC per scene; a mismatch fails the run. Scenes marked `fonts` draw
+// TFT_eSPI glyphs, so their CRCs hold only for the font data they were taken
+// against, identified by GOLDEN_FONTS (see fontProbe()). With other font data
+// those scenes fail as "fonts" and the crc32 column is their new golden set.
+struct Scene {
+    const char *name;
+    SceneFn     draw;
+    uint32_t    golden;
+    bool        fonts;
+};
+
+static const uint32_t GOLDEN_FONTS = 0xa4fb78e8;
+
+// Folds the screen checksum of each printable glyph of font into fp. Font 1
+// is the free font when one is set, as in TFT_eSPI.
+static uint32_t probeGlyphs( uint32_t fp, uint8_t font ) {
+    char glyph[ 2 ] = { 0, 0 };
+    for ( char c = ' '; c <= '~'; c++ ) {
+        tft.fillScreen( TFT_BLACK );
+        glyph[ 0 ] = c;
+        tft.drawString( glyph, 4, 4, font );
+        fp = ( fp * 0x01000193 ) ^ tft.hostChecksum();
+    }
+    return fp;
+}
+
+// Fingerprint of the font data: every glyph of every font the UI uses
+static uint32_t fontProbe() {
+    static const uint8_t        FONTS[]      = { 1, 2, 4, 6, 7, 8 };
+    static const GFXfont *const FREE_FONTS[] = { &FreeSans9pt7b, &FreeSans12pt7b, &FreeSansBold12pt7b, &FreeSansBold18pt7b };
+    uint32_t fp = 0;
+    tft.setTextDatum( TL_DATUM );
+    tft.setTextColor( TFT_WHITE, TFT_BLACK );
+    for ( uint8_t font : FONTS ) {
+        fp = probeGlyphs( fp, font );
+    }
+    for ( const GFXfont *font : FREE_FONTS ) {
+        tft.setFreeFont( font );
+        fp = probeGlyphs( fp, 1 );
+    }
+    tft.setFreeFont( NULL );
+    return fp;
+}
+
+static void setTheme( int mode, bool white ) {
+    themeMode    = mode;
+    isWhiteTheme = white;
+    themeApply();
+}
+
+static void sceneThemeDark() {
+    setTheme( THEME_DARK, false );
+    fillBackground( 0, 0, tft.width(), tft.height() );
+}
+
+static void sceneThemeWhite() {
+    setTheme( THEME_WHITE, true );
+    fillBackground( 0, 0, tft.width(), tft.height() );
+}
+
+static void sceneThemeBlue() {
+    setTheme( THEME_BLUE, false );
+    fillBackground( 0, 0, tft.width(), tft.height() );
+}
+
+static void sceneThemeYellow() {
+    setTheme( THEME_YELLOW, false );
+    fillBackground( 0, 0, tft.width(), tft.height() );
+}
+
+// Parser check: a gradient user theme with a comment and an unknown role
+static void sceneThemeUser() {
+    themeLoadUser( "# test\nbg = #400040\nbgBottom = 0xF81F  # magenta\ntext=#ffffff\nbogus = #000000\n" );
+    setTheme( THEME_USER, false );
+    fillBackground( 0, 0, tft.width(), tft.height() );
+}
+
+// One WMO code per icon, large on the top rows and small underneath
+static const int WEATHER_CODES[] = { 0, 2, 3, 45, 61, 71, 80, 85, 95 };
+
+static void sceneWeatherIcons() {
+    setTheme( THEME_BLUE, false );
+    fillBackground( 0, 0, tft.width(), tft.height() );
+    int n = sizeof( WEATHER_CODES ) / sizeof( WEATHER_CODES[ 0 ] );
+    for ( int i = 0; i < n; i++ ) {
+        drawWeatherIconVector( WEATHER_CODES[ i ], 10 + ( i % 5 ) * 60, 10 + ( i / 5 ) * 60 );
+        drawWeatherIconVectorSmall( WEATHER_CODES[ i ], 10 + i * 30, 150 );
+    }
+}
+
+static void sceneMoonPhases() {
+    setTheme( THEME_DARK, false );
+    fillBackground( 0, 0, tft.width(), tft.height() );
+    for ( int b = 0; b < MOON_CYCLE_BUCKETS; b++ ) {
+        drawMoonPhaseIcon( 24 + ( b % 6 ) * 52, 24 + ( b / 6 ) * 46, 18, b, TFT_WHITE );
+    }
+}
+
+static void sceneIndicators() {
+    setTheme( THEME_WHITE, true );
+    updateAvailable = true;
+    fillBackground( 0, 0, tft.width(), tft.height() );
+    drawWifiIndicator();
+    drawUpdateIndicator();
+    drawSettingsIcon( TFT_BLACK );
+    drawArrowBack( 20, 200, TFT_BLACK );
+    drawArrowUp( 150, 100, TFT_BLACK );
+    drawArrowDown( 200, 100, TFT_BLACK );
+    drawDegreeCircle( 100, 100, 4, TFT_BLACK );
+    updateAvailable = false;
+}
+
+static void sceneDigits() {
+    setTheme( THEME_DARK, false );
+    fillBackground( 0, 0, tft.width(), tft.height() );
+    if ( digitAtlasReady() ) {
+        digitsDrawAll( "12:34", tft.width() / 2, tft.height() / 2, TFT_WHITE );
+    }
+}
+
+// Mid-transition frame of each digit effect, "12:39" -> "12:40"
+static void digitsMidFrame( int fx ) {
+    setTheme( THEME_DARK, false );
+    fillBackground( 0, 0, tft.width(), tft.height() );
+    if ( !digitAtlasReady() ) {
+        return;
+    }
+    digitTransition = fx;
+    digitsDrawAll( "12:39", tft.width() / 2, tft.height() / 2, TFT_WHITE );
+    digitsUpdate( "12:40", TFT_WHITE );
+    for ( int f = 0; f < DIGIT_ANIM_FRAMES / 2; f++ ) {
+        digitsAnimate();
+    }
+    dmaSync();
+    digitTransition = DIGIT_FX_SLIDE;
+}
+
+static void sceneDigitsSlide() {
+    digitsMidFrame( DIGIT_FX_SLIDE );
+}
+
+static void sceneDigitsFlip() {
+    digitsMidFrame( DIGIT_FX_FLIP );
+}
+
+// Every built-in font plus the FreeFonts, through the backend's text paths
+static void sceneText() {
+    setTheme( THEME_DARK, false );
+    fillBackground( 0, 0, tft.width(), tft.height() );
+    tft.setTextDatum( TL_DATUM );
+    tft.setTextColor( TFT_WHITE, TFT_BLACK );
+    tft.drawString( "Font 1 GLCD", 4, 4, 1 );
+    tft.drawString( "Font 2", 4, 16, 2 );
+    tft.drawString( "Font 4", 4, 34, 4 );
+    tft.drawString( "12:45", 4, 64, 6 );
+    tft.drawString( "12:45", 4, 116, 7 );
+    tft.setTextColor( TFT_YELLOW );
+    tft.setFreeFont( &FreeSans9pt7b );
+    tft.drawString( "FreeSans 9", 170, 4 );
+    tft.setFreeFont( &FreeSansBold12pt7b );
+    tft.drawString( "Bold 12", 170, 30 );
+    tft.setFreeFont( &FreeSansBold18pt7b );
+    tft.setTextDatum( MC_DATUM );
+    tft.drawString( "Bold 18", 240, 90 );
+    tft.setFreeFont( NULL );
+    tft.setTextDatum( TL_DATUM );
+    tft.drawString( "45", 170, 160, 8 );
+}
+
+// The real settings screens replayed from their recordings (the replay
+// benchmark); host/screens_direct.cpp checks them against direct drawing
+static void sceneDlistWeather() {
+    screenListScene( 0, THEME_BLUE );
+}
+
+static void sceneDlistRegional() {
+    screenListScene( 1, THEME_DARK );
+}
+
+static void sceneDlistFirmware() {
+    screenListScene( 2, THEME_USER );
+}
+
+// The clock at a fixed time: tick-mode analog, sweep (between two seconds)
+// and the 12 h digital clock with its PM dot
+static void clockScene( bool digital, bool sweep ) {
+    setTheme( THEME_DARK, false );
+    releaseClockSprites();
+    isDigitalClock = digital;
+    sweepMode      = sweep;
+    is12hFormat    = digital;
+    drawClockFace();
+    if ( sweep ) {
+        updateHandsSweep( hostTime );
+    }
+    else {
+        struct tm ti;
+        getLocalTime( &ti );
+        updateHands( ti.tm_hour, ti.tm_min, ti.tm_sec );
+    }
+    dmaSync();
+    releaseClockSprites();
+    isDigitalClock = false;
+    sweepMode      = false;
+    is12hFormat    = false;
+}
+
+static void sceneClockAnalog() {
+    clockScene( false, false );
+}
+
+static void sceneClockSweep() {
+    clockScene( false, true );
+}
+
+static void sceneClockDigital() {
+    clockScene( true, false );
+}
+
+static const Scene SCENES[] = {
+    { "theme-dark",     sceneThemeDark,      0x066e64a1, false },
+    { "theme-white",    sceneThemeWhite,     0x90bb2232, false },
+    { "theme-blue",     sceneThemeBlue,      0x2b8d785c, false },
+    { "theme-yellow",   sceneThemeYellow,    0x0f953bcf, false },
+    { "theme-user",     sceneThemeUser,      0xc84f424b, false },
+    { "weather-icons",  sceneWeatherIcons,   0x7f3a3adb, false },
+    { "moon-phases",    sceneMoonPhases,     0xa5aa3e77, false },
+    { "indicators",     sceneIndicators,     0x5dceab0b, false },
+    { "digits",         sceneDigits,         0x9ee26293, true },
+    { "digits-slide",   sceneDigitsSlide,    0xb7639671, true },
+    { "digits-flip",    sceneDigitsFlip,     0xe53efcea, true },
+    { "text",           sceneText,           0x8c2b7bb4, true },
+    { "clock-analog",   sceneClockAnalog,    0x558af978, true },
+    { "clock-sweep",    sceneClockSweep,     0x6d5067bc, true },
+    { "clock-digital",  sceneClockDigital,   0xc2468194, true },
+    { "dlist-weather",  sceneDlistWeather,   0x906a20d8, true },
+    { "dlist-regional", sceneDlistRegional,  0xe868ecb4, true },
+    { "dlist-firmware", sceneDlistFirmware,  0x475d89da, true },
+};
+
+int main( int argc, char **argv ) {
+    if ( argc > 1 ) {
+        outDir = argv[ 1 ];
+    }
+    mkdir( outDir, 0755 );
+    setenv( "TZ", "UTC0", 1 );      // hostTime renders the same everywhere
+    tzset();
+
+    tft.init();
+    tft.setRotation( 1 );
+    dmaPushInit();
+
+    uint32_t fonts     = fontProbe();
+    bool     fontsSame = fonts == GOLDEN_FONTS;
+    screenListsRecord();
+
+    printf( "%-14s %8s %6s %8s %9s %-8s %s\n", "scene", "us", "calls", "windows", "pixels", "crc32", "golden" );
+    int failures = 0;
+    for ( const Scene &s : SCENES ) {
+        tft.fillScreen( TFT_BLACK );
+        tft.hostResetCounters();
+
+        uint32_t t0 = micros();
+        s.draw();
+        uint32_t us = micros() - t0;
+
+        const HostGfxCounters &c     = tft.hostCounters();
+        uint32_t               calls = 0;
+        for ( int i = 0; i < HOST_PRIM_COUNT; i++ ) {
+            calls += c.calls[ i ];
+        }
+
+        char path[ 256 ];
+        snprintf( path, sizeof( path ), "%s/%s.png", outDir, s.name );
+        if ( !tft.hostSavePNG( path ) ) {
+            failures++;
+        }
+        uint32_t    crc    = tft.hostChecksum();
+        const char *golden = "ok";
+        if ( s.fonts && !fontsSame ) {
+            golden = "fonts";
+            failures++;
+        }
+        else if ( crc != s.golden ) {
+            golden = "MISMATCH";
+            failures++;
+        }
+        printf( "%-14s %8u %6u %8u %9llu %08x %s\n", s.name, us, calls, c.windows,
+                ( unsigned long long )c.pixels, crc, golden );
+    }
+
+    if ( !fontsSame ) {
+        printf( "font data %08x, golden CRCs taken against %08x: record the font scenes again\n",
+                fonts, GOLDEN_FONTS );
+    }
+
+    // Screen recordings must reproduce direct drawing pixel for pixel
+    failures += screenListReport();
+
+    // Every synthesised filtered trace must give exactly its gesture
+    char tracePath[ 256 ];
+    snprintf( tracePath, sizeof( tracePath ), "%s/gestures.trace", outDir );
+    failures += gestureTraceReport( tracePath );
+    failures += calibrationReport();
+
+    // Recorded traces named on the command line
+    for ( int i = 2; i < argc; i++ ) {
+        failures += gestureTraceReplay( argv[ i ] );
+    }
+    return failures == 0 ? 0 : 1;
+}
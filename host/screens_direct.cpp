@@ -0,0 +1,413 @@
+// ---------------------------------------------------------------------------
+// Display-list check for the real settings screens (host only)
+//
+// The Weather, Regional and Firmware screens are display lists recorded by
+// src/ui/screen_lists.cpp. The direct drawing code they replaced is kept
+// below, unchanged apart from the names, as the reference: every recording is
+// replayed against it in every theme and across the flag and text states the
+// screens can show, and any CRC mismatch fails the host run.
+// ---------------------------------------------------------------------------
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#include "../src/data/app_state.h"
+#include "../src/ui/gfx_stats.h"
+#include "../src/ui/icons.h"
+#include "../src/ui/screen_lists.h"
+#include "../src/ui/theme.h"
+#include "../src/util/constants.h"
+
+// Defined in host/render_main.cpp (main.cpp on the device)
+extern DisplayTFT  tft;
+extern bool        isWhiteTheme;
+extern int         themeMode;
+extern float       lat;
+extern float       lon;
+extern String      cityName;
+extern bool        regionAutoMode;
+extern bool        manualDstActive;
+extern long        gmtOffset_sec;
+extern const char *FIRMWARE_VERSION;
+extern String      availableVersion;
+extern bool        updateAvailable;
+extern int         otaInstallMode;
+
+// ---------------------------------------------------------------------------
+// Direct drawing (pre-display-list screens.cpp)
+// ---------------------------------------------------------------------------
+
+static void drawWeatherScreenDirect() {
+    uint16_t bg = getBgColor();
+    uint16_t txt = getTextColor();
+    tft.fillScreen( bg );
+
+    // ===== NADPIS =====
+    tft.setFreeFont( &FreeSans12pt7b );
+    tft.setTextColor( TFT_ORANGE, bg );
+    tft.setTextDatum( TC_DATUM );
+    tft.drawString( "Weather Settings", 160, 5 );
+
+    // ===== MĚSTO =====
+    tft.setFreeFont( &FreeSans9pt7b );
+    tft.setTextColor( TFT_SKYBLUE, bg );
+    tft.setTextDatum( TC_DATUM );
+    String cityDisp = ( cityName == "" ) ? "Not set (Use Regional)" : cityName;
+    if ( cityDisp.length() > 22 ) {
+        cityDisp = cityDisp.substring( 0, 19 ) + "...";
+    }
+    tft.drawString( cityDisp, 160, 38 );
+
+    tft.setFreeFont( NULL );
+    tft.setTextDatum( MC_DATUM );
+
+    // ===== 3 SLOUPCE JEDNOTEK - LABELS =====
+    tft.setTextColor( txt, bg );
+    tft.drawString( "Temperature", 50, 68, 1 );
+    tft.drawString( "Wind speed", 160, 68, 1 );
+    tft.drawString( "Pressure", 270, 68, 1 );
+
+    // ===== SLOUPEC 1: TEPLOTA =====
+    int btnH = 20;
+    int btnY = 80;
+    if ( !app.units.tempF ) {
+        tft.fillRoundRect( 8,  btnY, 38, btnH, 3, TFT_GREEN );
+        tft.setTextColor( TFT_WHITE, TFT_GREEN );
+        tft.drawString( "C", 27, btnY + 10, 1 );
+        tft.drawRoundRect( 50, btnY, 38, btnH, 3, TFT_BLUE );
+        tft.setTextColor( txt, bg );
+        tft.drawString( "F", 69, btnY + 10, 1 );
+    }
+    else {
+        tft.drawRoundRect( 8,  btnY, 38, btnH, 3, TFT_BLUE );
+        tft.setTextColor( txt, bg );
+        tft.drawString( "C", 27, btnY + 10, 1 );
+        tft.fillRoundRect( 50, btnY, 38, btnH, 3, TFT_GREEN );
+        tft.setTextColor( TFT_WHITE, TFT_GREEN );
+        tft.drawString( "F", 69, btnY + 10, 1 );
+    }
+
+    // ===== COLUMN 2: WIND =====
+    tft.setTextColor( txt, bg );
+    if ( !app.units.windMph ) {
+        tft.fillRoundRect( 115, btnY, 38, btnH, 3, TFT_GREEN );
+        tft.setTextColor( TFT_WHITE, TFT_GREEN );
+        tft.drawString( "km/h", 134, btnY + 10, 1 );
+        tft.drawRoundRect( 157, btnY, 38, btnH, 3, TFT_BLUE );
+        tft.setTextColor( txt, bg );
+        tft.drawString( "mph", 176, btnY + 10, 1 );
+    }
+    else {
+        tft.drawRoundRect( 115, btnY, 38, btnH, 3, TFT_BLUE );
+        tft.setTextColor( txt, bg );
+        tft.drawString( "km/h", 134, btnY + 10, 1 );
+        tft.fillRoundRect( 157, btnY, 38, btnH, 3, TFT_GREEN );
+        tft.setTextColor( TFT_WHITE, TFT_GREEN );
+        tft.drawString( "mph", 176, btnY + 10, 1 );
+    }
+
+    // ===== SLOUPEC 3: TLAK =====
+    tft.setTextColor( txt, bg );
+    if ( !app.units.pressureInHg ) {
+        tft.fillRoundRect( 222, btnY, 38, btnH, 3, TFT_GREEN );
+        tft.setTextColor( TFT_WHITE, TFT_GREEN );
+        tft.drawString( "hPa", 241, btnY + 10, 1 );
+        tft.drawRoundRect( 264, btnY, 38, btnH, 3, TFT_BLUE );
+        tft.setTextColor( txt, bg );
+        tft.drawString( "inHg", 283, btnY + 10, 1 );
+    }
+    else {
+        tft.drawRoundRect( 222, btnY, 38, btnH, 3, TFT_BLUE );
+        tft.setTextColor( txt, bg );
+        tft.drawString( "hPa", 241, btnY + 10, 1 );
+        tft.fillRoundRect( 264, btnY, 38, btnH, 3, TFT_GREEN );
+        tft.setTextColor( TFT_WHITE, TFT_GREEN );
+        tft.drawString( "inHg", 283, btnY + 10, 1 );
+    }
+
+    // ===== COORDINATES + EDIT =====
+    tft.setTextColor( txt, bg );
+    tft.setTextDatum( ML_DATUM );
+    String coordStr = "Coord: " + String( lat, 2 ) + ", " + String( lon, 2 );
+    tft.drawString( coordStr, 8, 118, 1 );
+    tft.drawRoundRect( 232, 110, 60, 16, 3, TFT_SKYBLUE );
+    tft.setTextColor( TFT_SKYBLUE, bg );
+    tft.setTextDatum( MC_DATUM );
+    tft.drawString( "EDIT", 262, 118, 1 );
+
+    // ===== INFO =====
+    tft.setTextColor( txt, bg );
+    tft.drawString( "Updates every 30 min", 160, 138, 1 );
+
+    // ===== BACK BUTTON =====
+    tft.fillRoundRect( 40, 152, 240, 16, 4, TFT_DARKGREY );
+    tft.setTextColor( TFT_WHITE );
+    tft.drawString( "BACK TO SETTINGS", 160, 160, 1 );
+}
+
+static void drawRegionalScreenDirect() {
+    tft.fillScreen( getBgColor() );
+    tft.setTextColor( getTextColor() );
+    tft.setTextDatum( MC_DATUM );
+    tft.drawString( "REGIONAL SETUP", 160, 30, 4 );
+
+    int toggleX = 160;
+    int toggleY = 60;
+
+    if ( regionAutoMode ) {
+        tft.fillRoundRect( toggleX - 55, toggleY - 15, 50, 30, 4, TFT_GREEN );
+        tft.setTextColor( TFT_WHITE );
+        tft.drawString( "AUTO", toggleX - 30, toggleY, 2 );
+        tft.drawRoundRect( toggleX + 5, toggleY - 15, 50, 30, 4, TFT_BLUE );
+        tft.setTextColor( getTextColor() );
+        tft.drawString( "MANUAL", toggleX + 30, toggleY, 2 );
+    }
+    else {
+        tft.drawRoundRect( toggleX - 55, toggleY - 15, 50, 30, 4, TFT_BLUE );
+        tft.setTextColor( getTextColor() );
+        tft.drawString( "AUTO", toggleX - 30, toggleY, 2 );
+        tft.fillRoundRect( toggleX + 5, toggleY - 15, 50, 30, 4, TFT_GREEN );
+        tft.setTextColor( TFT_WHITE );
+        tft.drawString( "MANUAL", toggleX + 30, toggleY, 2 );
+    }
+
+    tft.setTextDatum( ML_DATUM );
+    tft.setTextColor( getTextColor() );
+    tft.drawString( "City", 40, 110, 2 );
+    tft.setTextColor( TFT_SKYBLUE );
+    tft.drawString( cityName != "" ? cityName : "---", 40, 130, 2 );
+
+    tft.setTextColor( getTextColor() );
+    tft.drawString( "Timezone", 40, 160, 2 );
+    tft.setTextColor( TFT_SKYBLUE );
+    int tzHours = gmtOffset_sec / 3600;
+    String tzStr = ( tzHours >= 0 ? "+" : "" ) + String( tzHours ) + "h";
+    tft.drawString( tzStr, 40, 180, 2 );
+    if ( !regionAutoMode ) {
+        tft.setTextDatum( MC_DATUM );
+        tft.drawRoundRect( 120, 172, 28, 16, 3, TFT_GREEN );
+        tft.setTextColor( TFT_GREEN );
+        tft.drawString( "+", 134, 180, 2 );
+        tft.drawRoundRect( 155, 172, 28, 16, 3, TFT_GREEN );
+        tft.drawString( "-", 169, 180, 2 );
+        if ( manualDstActive ) {
+            tft.fillRoundRect( 195, 172, 72, 16, 3, TFT_ORANGE );
+            tft.setTextColor( TFT_WHITE );
+        }
+        else {
+            tft.drawRoundRect( 195, 172, 72, 16, 3, getTextColor() );
+            tft.setTextColor( getTextColor() );
+        }
+        tft.drawString( manualDstActive ? "DST: ON" : "DST: OFF", 231, 180, 2 );
+        tft.setTextDatum( ML_DATUM );
+    }
+
+    tft.setTextDatum( MC_DATUM );
+    if ( regionAutoMode ) {
+        tft.drawRoundRect( 40, 205, 105, 30, 6, TFT_GREEN );
+        tft.drawString( "SYNC", 92, 220, 2 );
+    }
+    else {
+        tft.drawRoundRect( 40, 205, 105, 30, 6, TFT_GREEN );
+        tft.drawString( "EDIT", 92, 220, 2 );
+    }
+
+    tft.drawRoundRect( 155, 205, 105, 30, 6, TFT_RED );
+    tft.drawString( "Back", 207, 220, 2 );
+}
+
+static void drawFirmwareScreenDirect() {
+    fillBackground( 0, 0, 320, 240 );
+
+    // Nadpis
+    tft.setTextColor( getTextColor() );
+    tft.setTextDatum( MC_DATUM );
+    tft.drawString( "FIRMWARE", 160, 30, 4 );
+
+    // Set datum for left column
+    tft.setTextDatum( ML_DATUM );
+
+    int yPos = 60;
+
+    // Current version
+    tft.setTextColor( getTextColor() );
+    tft.drawString( "Current version:", 10, yPos, 2 );
+    tft.setTextColor( TFT_GREEN );
+    tft.drawString( String( FIRMWARE_VERSION ), 160, yPos, 2 );
+
+    yPos += 25;
+
+    // Available version
+    tft.setTextColor( getTextColor() );
+    tft.drawString( "Available:", 10, yPos, 2 );
+    if ( availableVersion == "" || !updateAvailable ) {
+        tft.setTextColor( TFT_DARKGREY );
+        tft.drawString( "-", 160, yPos, 2 );
+    }
+    else {
+        tft.setTextColor( TFT_ORANGE );
+        tft.drawString( availableVersion, 160, yPos, 2 );
+    }
+
+    yPos += 35;
+
+    // Install mode nadpis
+    tft.setTextColor( getTextColor() );
+    tft.drawString( "Install mode:", 10, yPos, 2 );
+
+    yPos += 25;  // yPos is now 145
+
+    // Radio buttons for install mode (Auto and By user only)
+    const char *modes[ 2 ] = {"Auto", "By user"};
+    for ( int i = 0; i < 2; i++ ) {
+        int btnY = yPos + ( i * 25 ); // 145, 170
+
+        // Radio button - circle centred on btnY
+        tft.drawCircle( 20, btnY, 6, getTextColor() );
+        if ( otaInstallMode == i ) {
+            tft.fillCircle( 20, btnY, 4, TFT_GREEN );
+        }
+
+        // Text - correctly aligned with circle
+        // ML_DATUM = Middle Left, so y is vertical centre of text
+        // Circle is centred on btnY, text also centred on btnY
+        tft.setTextColor( getTextColor() );
+        tft.drawString( modes[ i ], 35, btnY, 2 );
+    }
+
+    // Reset text datum to centred for buttons
+    tft.setTextDatum( MC_DATUM );
+
+    // Check Now / Install button
+    int btnY = 190;
+    if ( updateAvailable ) {
+        tft.fillRoundRect( 10, btnY, 140, 30, 5, TFT_GREEN );
+        tft.setTextColor( TFT_BLACK );
+        tft.drawString( "INSTALL", 80, btnY + 15, 2 );
+    }
+    else {
+        tft.fillRoundRect( 10, btnY, 140, 30, 5, TFT_BLUE );
+        tft.setTextColor( TFT_WHITE );
+        tft.drawString( "CHECK NOW", 80, btnY + 15, 2 );
+    }
+
+    // Back button (same style as other menus)
+    tft.drawRoundRect( 230, 125, 50, 50, 4, TFT_RED );
+    drawArrowBack( 230, 125, TFT_RED );
+}
+
+// ---------------------------------------------------------------------------
+// States
+// ---------------------------------------------------------------------------
+
+// Texts that hit each formatting path: empty, short, and over the Weather
+// screen's 22-character cut
+static const char *const CITIES[] = { "", "Plzen", "Llanfairpwllgwyngyll-gogerych" };
+
+static void weatherState( int s ) {
+    app.units.tempF        = s & 1;
+    app.units.windMph      = s & 2;
+    app.units.pressureInHg = s & 4;
+    cityName               = CITIES[ ( s >> 3 ) % 3 ];
+    lat                    = ( s & 1 ) ? -33.8688f : 49.7475f;
+    lon                    = ( s & 2 ) ? -151.2093f : 13.3776f;
+}
+
+static const long TZ_OFFSETS[] = { 3600, 0, -18000, 19800 };
+
+static void regionalState( int s ) {
+    regionAutoMode  = s & 1;
+    manualDstActive = s & 2;
+    cityName        = CITIES[ ( s >> 2 ) & 1 ];
+    gmtOffset_sec   = TZ_OFFSETS[ s >> 3 ];
+}
+
+static void firmwareState( int s ) {
+    availableVersion = ( s & 1 ) ? "2.1.0" : "";
+    updateAvailable  = s & 2;
+    otaInstallMode   = s >> 2;
+}
+
+struct ScreenCheck {
+    const char *name;
+    void ( *record )( DisplayList &dl );
+    void ( *direct )();
+    void ( *state )( int s );
+    int         states;
+    int         sceneState;   // Shown by the timed scene
+    DisplayList list;
+};
+
+static ScreenCheck checks[] = {
+    { "weather",  recordWeatherScreen,  drawWeatherScreenDirect,  weatherState,  24, 9,  {} },
+    { "regional", recordRegionalScreen, drawRegionalScreenDirect, regionalState, 32, 6,  {} },
+    { "firmware", recordFirmwareScreen, drawFirmwareScreenDirect, firmwareState, 12, 7,  {} },
+};
+
+static const int THEMES[] = { THEME_DARK, THEME_WHITE, THEME_BLUE, THEME_YELLOW, THEME_USER };
+
+static void screenTheme( int mode ) {
+    themeMode    = mode;
+    isWhiteTheme = mode == THEME_WHITE;
+    themeApply();
+}
+
+// Both paths start from the same TFT text state, as after any other screen
+static void resetTextState() {
+    tft.setFreeFont( NULL );
+    tft.setTextFont( 1 );
+    tft.setTextDatum( TL_DATUM );
+    tft.setTextColor( TFT_WHITE );
+}
+
+// ---------------------------------------------------------------------------
+
+// Records every list once, as the screens do on their first draw
+void screenListsRecord() {
+    for ( ScreenCheck &c : checks ) {
+        c.record( c.list );
+    }
+}
+
+// Render scene: the screen's list replayed in its scene state
+void screenListScene( int screen, int mode ) {
+    ScreenCheck &c = checks[ screen ];
+    screenTheme( mode );
+    c.state( c.sceneState );
+    resetTextState();
+    dlReplay( c.list );
+}
+
+// Replay vs direct over every theme x state; returns the number of mismatches
+int screenListReport() {
+    int failures = 0;
+    printf( "\n%-10s %8s %10s\n", "screen", "states", "mismatch" );
+    for ( ScreenCheck &c : checks ) {
+        int bad = 0;
+        if ( c.list.overflow || !c.list.recorded ) {
+            bad++;
+        }
+        for ( int mode : THEMES ) {
+            screenTheme( mode );
+            for ( int s = 0; s < c.states; s++ ) {
+                c.state( s );
+                resetTextState();
+                c.direct();
+                uint32_t direct = tft.hostChecksum();
+                resetTextState();
+                dlReplay( c.list );
+                uint32_t replay = tft.hostChecksum();
+                if ( replay != direct ) {
+                    if ( bad == 0 ) {
+                        printf( "%s: theme %d state %d: replay CRC %08x != direct %08x\n", c.name, mode, s, replay,
+                                direct );
+                    }
+                    bad++;
+                }
+            }
+        }
+        printf( "%-10s %8d %10d\n", c.name, c.states * ( int )( sizeof( THEMES ) / sizeof( THEMES[ 0 ] ) ), bad );
+        failures += bad;
+    }
+    return failures;
+}
@@ -0,0 +1,330 @@
+# Rasterise the vector weather icons into packed 4-bpp bitmaps for flash
+#
+# The icons used to be drawn at runtime from fillCircle / fillRoundRect /
+# drawLine calls on every redraw. This script renders the same primitives
+# (same coordinates as the old drawWeatherIconVector / ...Small code) with
+# 4x4 supersampling and writes src/ui/weather_icons_data.h:
+#
+#   - one bitmap per icon variant (clear, partly cloudy, fog, ...) and size
+#   - 4 bits per pixel; index 0 = transparent, 1..15 = palette entries
+#   - each palette entry is an ink (sun, cloud, shadow, rain, snow) plus an
+#     alpha, so the runtime can blend anti-aliased edges over the gradient
+#     background and resolve theme-dependent inks (the shadow colour)
+#
+# Runs as a PlatformIO pre-script (regenerates only when this file is newer
+# than the header) or standalone:
+#   python3 scripts/gen_weather_icons.py
+
+import math
+import os
+import sys
+
+SS = 4                          # Supersamples per pixel axis
+ALPHA_LEVELS = (64, 128, 192, 255)  # Quantised edge coverage
+
+# Inks, in palette order. Colours are only used for the size report preview.
+INKS = [
+    ("WX_INK_SUN",    "TFT_YELLOW"),
+    ("WX_INK_CLOUD",  "TFT_SILVER"),
+    ("WX_INK_SHADOW", "theme shadow"),
+    ("WX_INK_RAIN",   "TFT_BLUE"),
+    ("WX_INK_SNOW",   "TFT_SKYBLUE"),
+]
+SUN, CLOUD, SHADOW, RAIN, SNOW = range(len(INKS))
+
+# GLCD font '*' (font 1, 5x7), drawn top-left at the string position
+STAR_GLYPH = [(0, 3), (1, 1), (1, 3), (1, 5), (2, 2), (2, 3), (2, 4),
+              (3, 1), (3, 3), (3, 5), (4, 3)]
+
+
+# ---------------------------------------------------------------------------
+# Primitives — each returns (ink, bbox, inside(px, py)) in pixel space where
+# pixel (i, j) covers [i, i+1) x [j, j+1), matching TFT_eSPI pixel centres.
+# ---------------------------------------------------------------------------
+
+def fill_circle(cx, cy, r, ink):
+    rr = (r + 0.5) ** 2
+    return (ink, (cx - r, cy - r, cx + r + 1, cy + r + 1),
+            lambda x, y: (x - cx - 0.5) ** 2 + (y - cy - 0.5) ** 2 <= rr)
+
+
+def draw_circle(cx, cy, r, ink):
+    lo, hi = (r - 0.5) ** 2, (r + 0.5) ** 2
+    return (ink, (cx - r, cy - r, cx + r + 1, cy + r + 1),
+            lambda x, y: lo <= (x - cx - 0.5) ** 2 + (y - cy - 0.5) ** 2 <= hi)
+
+
+def _in_round_rect(x, y, x0, y0, w, h, rad):
+    if not (x0 <= x < x0 + w and y0 <= y < y0 + h):
+        return False
+    # Corner circles are centred on pixel centres rad in from each edge
+    cx = min(max(x, x0 + rad + 0.5), x0 + w - rad - 0.5)
+    cy = min(max(y, y0 + rad + 0.5), y0 + h - rad - 0.5)
+    return (x - cx) ** 2 + (y - cy) ** 2 <= (rad + 0.5) ** 2
+
+
+def fill_round_rect(x0, y0, w, h, rad, ink):
+    return (ink, (x0, y0, x0 + w, y0 + h),
+            lambda x, y: _in_round_rect(x, y, x0, y0, w, h, rad))
+
+
+def draw_round_rect(x0, y0, w, h, rad, ink):
+    return (ink, (x0, y0, x0 + w, y0 + h),
+            lambda x, y: _in_round_rect(x, y, x0, y0, w, h, rad) and
+            not _in_round_rect(x, y, x0 + 1, y0 + 1, w - 2, h - 2, max(rad - 1, 0)))
+
+
+def draw_line(x0, y0, x1, y1, ink):
+    ax, ay, bx, by = x0 + 0.5, y0 + 0.5, x1 + 0.5, y1 + 0.5
+    dx, dy = bx - ax, by - ay
+    ll = dx * dx + dy * dy
+
+    def inside(x, y):
+        t = 0.0 if ll == 0 else max(0.0, min(1.0, ((x - ax) * dx + (y - ay) * dy) / ll))
+        px, py = ax + t * dx - x, ay + t * dy - y
+        return px * px + py * py <= 0.25 + 1e-9
+    return (ink, (min(x0, x1), min(y0, y1), max(x0, x1) + 1, max(y0, y1) + 1), inside)
+
+
+def star(x0, y0, ink):
+    cells = {(x0 + c, y0 + r) for c, r in STAR_GLYPH}
+    return (ink, (x0, y0, x0 + 5, y0 + 7),
+            lambda x, y: (math.floor(x), math.floor(y)) in cells)
+
+
+def polar(c, r, deg):
+    # Same rounding as polarX/polarY in util/trig.h
+    return c + int(math.floor(r * math.cos(math.radians(deg)) + 0.5)), \
+        c + int(math.floor(r * math.sin(math.radians(deg)) + 0.5))
+
+
+def sun_rays(cx, cy, r0, r1):
+    out = []
+    for deg in range(0, 360, 45):
+        ax, _ = polar(cx, r0, deg)
+        _, ay = polar(cy, r0, deg)
+        bx, _ = polar(cx, r1, deg)
+        _, by = polar(cy, r1, deg)
+        out.append(draw_line(ax, ay, bx, by, SUN))
+    return out
+
+
+# ---------------------------------------------------------------------------
+# Icon scenes — coordinates relative to the draw anchor (x, y)
+# ---------------------------------------------------------------------------
+
+def cloud_large(x, y, ink):
+    return [fill_circle(x + 10, y + 15, 8, ink), fill_circle(x + 18, y + 10, 10, ink),
+            fill_circle(x + 28, y + 15, 8, ink), fill_round_rect(x + 10, y + 15, 20, 8, 4, ink)]
+
+
+def cloud_small(ink):
+    return [fill_circle(9, 13, 6, ink), fill_circle(15, 10, 8, ink),
+            fill_circle(22, 13, 6, ink), fill_round_rect(9, 13, 16, 6, 3, ink)]
+
+
+def cloud_small_offset(ink):
+    return [fill_circle(8, 14, 6, ink), fill_circle(14, 11, 7, ink),
+            fill_circle(20, 14, 5, ink), fill_round_rect(8, 14, 15, 5, 2, ink)]
+
+
+LARGE = {
+    "CLEAR": [fill_circle(16, 16, 10, SUN), draw_circle(16, 16, 11, SHADOW)] + sun_rays(16, 16, 11, 16),
+    "PARTLY": [fill_circle(22, 10, 8, SUN), draw_circle(22, 10, 9, SHADOW)] + cloud_large(0, 5, CLOUD),
+    "FOG": sum(([fill_round_rect(4, 9 + i * 6, 24, 3, 2, CLOUD), draw_round_rect(4, 9 + i * 6, 24, 3, 2, SHADOW)]
+                for i in range(3)), []),
+    "RAIN": cloud_large(0, 2, CLOUD) + sum(([fill_round_rect(10 + i * 6, 22, 2, 6, 1, RAIN),
+                                             draw_round_rect(10 + i * 6, 22, 2, 6, 1, SHADOW)] for i in range(3)), []),
+    "SNOW": cloud_large(0, 2, CLOUD) + [star(12, 22, SNOW), star(22, 22, SNOW)],
+    "SHOWERS": [fill_circle(22, 10, 7, SUN), draw_circle(22, 10, 8, SHADOW)] + cloud_large(0, 2, CLOUD) +
+               [fill_round_rect(16, 22, 2, 6, 1, RAIN)],
+    "SNOW_SHOWERS": [fill_circle(22, 10, 7, SUN), draw_circle(22, 10, 8, SHADOW)] + cloud_large(0, 2, CLOUD) +
+                    [star(12, 22, SNOW), star(22, 22, SNOW)],
+    "STORM": cloud_large(0, 2, SHADOW) + [draw_line(18, 20, 14, 28, SUN), draw_line(14, 28, 20, 28, SUN),
+                                          draw_line(20, 28, 16, 36, SUN)],
+    "CLOUDY": cloud_large(0, 5, CLOUD),
+}
+
+SMALL = {
+    "CLEAR": [fill_circle(16, 16, 9, SUN), draw_circle(16, 16, 10, SHADOW)] + sun_rays(16, 16, 10, 14),
+    "PARTLY": [fill_circle(20, 10, 7, SUN), draw_circle(20, 10, 8, SHADOW)] + cloud_small_offset(CLOUD),
+    "FOG": sum(([fill_round_rect(4, 10 + i * 5, 20, 2, 1, CLOUD), draw_round_rect(4, 10 + i * 5, 20, 2, 1, SHADOW)]
+                for i in range(3)), []),
+    "RAIN": cloud_small(CLOUD) + sum(([fill_round_rect(10 + i * 5, 21, 2, 5, 1, RAIN),
+                                       draw_round_rect(10 + i * 5, 21, 2, 5, 1, SHADOW)] for i in range(3)), []),
+    "SNOW": cloud_small(CLOUD) + [star(11, 21, SNOW), star(19, 21, SNOW)],
+    "SHOWERS": [fill_circle(20, 10, 7, SUN), draw_circle(20, 10, 8, SHADOW)] + cloud_small_offset(CLOUD) +
+               [fill_round_rect(14, 21, 2, 5, 1, RAIN)],
+    "SNOW_SHOWERS": [fill_circle(20, 10, 7, SUN), draw_circle(20, 10, 8, SHADOW)] + cloud_small_offset(CLOUD) +
+                    [star(14, 21, SNOW)],
+    "STORM": cloud_small(SHADOW) + [draw_line(15, 20, 12, 27, SUN), draw_line(12, 27, 17, 27, SUN),
+                                    draw_line(17, 27, 14, 34, SUN)],
+    "CLOUDY": cloud_small(CLOUD),
+}
+
+VARIANTS = ["CLEAR", "PARTLY", "FOG", "RAIN", "SNOW", "SHOWERS", "SNOW_SHOWERS", "STORM", "CLOUDY"]
+
+
+# ---------------------------------------------------------------------------
+# Rasteriser
+# ---------------------------------------------------------------------------
+
+def rasterise(scene):
+    x0 = min(p[1][0] for p in scene)
+    y0 = min(p[1][1] for p in scene)
+    x1 = max(p[1][2] for p in scene)
+    y1 = max(p[1][3] for p in scene)
+    w, h = x1 - x0, y1 - y0
+
+    # Per pixel: (ink, alpha level) — the ink covering most subsamples wins,
+    # alpha is the share of subsamples covered by any primitive.
+    pixels = []
+    for py in range(y0, y1):
+        for px in range(x0, x1):
+            counts = [0] * len(INKS)
+            covered = 0
+            for sy in range(SS):
+                for sx in range(SS):
+                    x = px + (sx + 0.5) / SS
+                    y = py + (sy + 0.5) / SS
+                    top = None
+                    for ink, box, inside in scene:   # Later primitives paint over earlier ones
+                        if box[0] <= x < box[2] + 1 and box[1] <= y < box[3] + 1 and inside(x, y):
+                            top = ink
+                    if top is not None:
+                        counts[top] += 1
+                        covered += 1
+            if covered == 0:
+                pixels.append(None)
+                continue
+            ink = max(range(len(INKS)), key=lambda i: counts[i])
+            a = covered * 255 // (SS * SS)
+            level = min(ALPHA_LEVELS, key=lambda lv: abs(lv - a))
+            if a < ALPHA_LEVELS[0] // 2:
+                pixels.append(None)
+            else:
+                pixels.append((ink, level))
+    return x0, y0, w, h, pixels
+
+
+def build_palette(pixels):
+    freq = {}
+    for p in pixels:
+        if p is not None:
+            freq[p] = freq.get(p, 0) + 1
+    entries = sorted(freq, key=lambda e: (-freq[e], e))
+    keep = entries[:15]
+    remap = {e: i + 1 for i, e in enumerate(keep)}
+    # Rare extras fold into the nearest alpha of the same ink (opaque wins ties)
+    for e in entries[15:]:
+        same = [k for k in keep if k[0] == e[0]] or keep
+        best = min(same, key=lambda k: (abs(k[1] - e[1]), -k[1]))
+        remap[e] = remap[best]
+    return keep, remap
+
+
+def pack(w, h, pixels, remap):
+    out = []
+    for row in range(h):
+        line = [remap[p] if p is not None else 0 for p in pixels[row * w:(row + 1) * w]]
+        if len(line) % 2:
+            line.append(0)
+        for i in range(0, len(line), 2):
+            out.append((line[i] << 4) | line[i + 1])
+    return out
+
+
+def generate(out_path):
+    lines = [
+        "#pragma once",
+        "",
+        "// Generated by scripts/gen_weather_icons.py — do not edit by hand.",
+        "// 4-bpp weather icon bitmaps: two pixels per byte (high nibble first), rows",
+        "// padded to a whole byte; index 0 is transparent, 1..15 index the palette.",
+        "",
+        "#include <stdint.h>",
+        "",
+        "enum WeatherIconInk : uint8_t {",
+    ]
+    lines += ["    %s," % name for name, _ in INKS]
+    lines += [
+        "};",
+        "",
+        "enum WeatherIconId : uint8_t {",
+    ]
+    lines += ["    WX_ICON_%s," % v for v in VARIANTS]
+    lines += [
+        "    WX_ICON_COUNT",
+        "};",
+        "",
+        "struct WeatherIconPaletteEntry {",
+        "    uint8_t ink;    // WeatherIconInk",
+        "    uint8_t alpha;  // Coverage over the background, 255 = opaque",
+        "};",
+        "",
+        "struct WeatherIconBitmap {",
+        "    const char                    *name;",
+        "    int8_t                         dx, dy;         // Top-left relative to the draw anchor",
+        "    uint8_t                        w, h;",
+        "    uint8_t                        paletteSize;",
+        "    const WeatherIconPaletteEntry *palette;        // Entry i is pixel index i + 1",
+        "    const uint8_t                 *pixels;",
+        "    uint16_t                       bytes;          // Flash used by pixels + palette",
+        "};",
+        "",
+    ]
+
+    report = []
+    tables = {}
+    for size_name, scenes in (("LARGE", LARGE), ("SMALL", SMALL)):
+        refs = []
+        for v in VARIANTS:
+            x0, y0, w, h, pixels = rasterise(scenes[v])
+            keep, remap = build_palette(pixels)
+            data = pack(w, h, pixels, remap)
+            ident = "wx%s%s" % (size_name.title(), "".join(p.title() for p in v.split("_")))
+            nbytes = len(data) + 2 * len(keep)
+
+            lines.append("static const WeatherIconPaletteEntry %sPal[] = {" % ident)
+            lines.append("    " + ", ".join("{ %s, %d }" % (INKS[i][0], a) for i, a in keep))
+            lines.append("};")
+            lines.append("static const uint8_t %sPix[] = {" % ident)
+            for i in range(0, len(data), 16):
+                lines.append("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+            lines.append("};")
+            lines.append("")
+            refs.append('    { "%s", %d, %d, %d, %d, %d, %sPal, %sPix, %d },'
+                        % (v.lower(), x0, y0, w, h, len(keep), ident, ident, nbytes))
+            report.append("%-6s %-13s %2dx%-2d %2d colours %4d B" % (size_name.lower(), v.lower(), w, h, len(keep), nbytes))
+        tables[size_name] = refs
+
+    for size_name in ("LARGE", "SMALL"):
+        lines.append("static const WeatherIconBitmap WEATHER_ICONS_%s[ WX_ICON_COUNT ] = {" % size_name)
+        lines += tables[size_name]
+        lines.append("};")
+        lines.append("")
+
+    text = "\n".join(lines).rstrip("\n") + "\n"
+    with open(out_path, "w", encoding="utf-8") as f:
+        f.write(text)
+    return report
+
+
+def main(project_dir, force=False):
+    here = os.path.join(project_dir, "scripts", "gen_weather_icons.py")
+    out = os.path.join(project_dir, "src", "ui", "weather_icons_data.h")
+    if not force and os.path.exists(out) and os.path.getmtime(out) >= os.path.getmtime(here):
+        return
+    report = generate(out)
+    print("[ICONS] Wrote %s" % os.path.relpath(out, project_dir))
+    for line in report:
+        print("[ICONS]   " + line)
+
+
+try:
+    from SCons.Script import Import  # type: ignore
+    Import("env")
+    main(env.subst("$PROJECT_DIR"))  # noqa: F821 — provided by Import("env")
+except ImportError:
+    if __name__ == "__main__":
+        main(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), force="--force" in sys.argv)
@@ -203,7 +203,7 @@ String syncRegion() {
 
 // drawClockFace -> src/ui/clock_face.cpp
 
-// drawDateAndWeek -> src/ui/clock_face.cpp
+// drawDateAndWeek -> src/ui/clock_face.cpp (now updateDateWidgets)
 
 // drawDigitalClock -> src/ui/clock_face.cpp
 
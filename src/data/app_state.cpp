@@ -0,0 +1,35 @@
+#include "app_state.h"
+
+// ── AppState defaults ─────────────────────────────────────────────────────────
+AppState app = {
+    { false, 0, 0.0f, 0, 0, 0.0f, 0, "--:--", "--:--", {}, { "Monday", "Tuesday" } },
+    { false, false, false },
+    { "", false },
+    { "--", false }
+};
+
+// ── Subscribers ───────────────────────────────────────────────────────────────
+struct AppSubscriber {
+    uint32_t    fields;
+    AppListener fn;
+    int         arg;
+};
+
+static AppSubscriber subscribers[ APP_MAX_SUBSCRIBERS ];
+static int           subscriberCount = 0;
+
+void appSubscribe( uint32_t fields, AppListener fn, int arg ) {
+    if ( subscriberCount >= APP_MAX_SUBSCRIBERS ) {
+        log_e( "[STATE] Subscriber table full" );
+        return;
+    }
+    subscribers[ subscriberCount++ ] = { fields, fn, arg };
+}
+
+void appChanged( uint32_t fields ) {
+    for ( int i = 0; i < subscriberCount; i++ ) {
+        if ( subscribers[ i ].fields & fields ) {
+            subscribers[ i ].fn( subscribers[ i ].arg );
+        }
+    }
+}
@@ -6,9 +6,10 @@
 // Application state type definitions
 // ============================================================
 // This header owns every type and constant that describes
-// application state.  Actual runtime globals are still
-// declared in main.cpp for now; the full collapse into a
-// single AppState struct is the Phase 4 refactor.
+// application state, and AppState: the state the clock
+// screen shows, with change notification (see the end of
+// this file). The other runtime globals are still declared
+// in main.cpp and move into AppState group by group.
 // ============================================================
 
 // ----------------------------------------------------------
@@ -47,3 +48,80 @@ struct RecentCity {
     int    gmtOffset;
     int    dstOffset;
 };
+
+// ----------------------------------------------------------
+// AppState — fields with change notification
+// ----------------------------------------------------------
+// Writers store through appSet(), which does nothing when the
+// value is unchanged and otherwise notifies every subscriber
+// of the field's change bit. Clock widgets subscribe with
+// compositorInvalidate, so a weather refresh, a holiday or a
+// unit toggle repaints only the widgets that show it.
+
+enum AppField : uint32_t {
+    APP_WX_FETCHED  = 1UL << 0,
+    APP_WX_NOW      = 1UL << 1,
+    APP_WX_DETAILS  = 1UL << 2,
+    APP_WX_SUN      = 1UL << 3,
+    APP_WX_FORECAST = 1UL << 4,
+    APP_UNIT_TEMP   = 1UL << 5,
+    APP_UNIT_WIND   = 1UL << 6,
+    APP_UNIT_PRESS  = 1UL << 7,
+    APP_HOLIDAY     = 1UL << 8,
+    APP_NAMEDAY     = 1UL << 9
+};
+
+struct WeatherState {
+    bool         fetched;           // APP_WX_FETCHED   first fetch succeeded
+    int          code;              // APP_WX_NOW       WMO weather code
+    float        temp;              //                  °C
+    int          humidity;          // APP_WX_DETAILS   %
+    int          pressure;          //                  hPa
+    float        windSpeed;         //                  km/h
+    int          windDir;           //                  degrees
+    String       sunrise;           // APP_WX_SUN       "HH:MM"
+    String       sunset;
+    ForecastData forecast[ 2 ];     // APP_WX_FORECAST  tomorrow, the day after
+    String       forecastDay[ 2 ];  //                  their day names
+};
+
+struct UnitState {
+    bool tempF;                     // APP_UNIT_TEMP    °F instead of °C
+    bool windMph;                   // APP_UNIT_WIND    mph instead of km/h
+    bool pressureInHg;              // APP_UNIT_PRESS   inHg instead of hPa
+};
+
+struct DayName {
+    String name;
+    bool   valid;                   // name holds a real entry
+};
+
+struct AppState {
+    WeatherState weather;
+    UnitState    units;
+    DayName      holiday;           // APP_HOLIDAY      today's public holiday, "" if none
+    DayName      nameday;           // APP_NAMEDAY      Czech nameday, "--" if none
+};
+
+extern AppState app;                // Defined in app_state.cpp
+
+constexpr int APP_MAX_SUBSCRIBERS = 16;
+
+typedef void ( *AppListener )( int arg );
+
+// Calls fn( arg ) whenever a field in the fields mask changes.
+void appSubscribe( uint32_t fields, AppListener fn, int arg );
+
+// Notifies the subscribers of the changed fields (appSet() does this).
+void appChanged( uint32_t fields );
+
+// Stores value in field and notifies changed; false if it was already equal.
+template <typename T, typename V>
+inline bool appSet( T &field, const V &value, uint32_t changed ) {
+    if ( field == value ) {
+        return false;
+    }
+    field = value;
+    appChanged( changed );
+    return true;
+}
@@ -190,17 +190,13 @@ const int COUNTRIES_COUNT = 11;
 
 // ─── Inline lookup helpers ─────────────────────────────────────────────────────
 
-inline void getCountryCities( String countryName, String cities[], int &count ) {
-    count = 0;
+inline const CountryEntry *findCountry( const String &countryName ) {
     for ( int i = 0; i < COUNTRIES_COUNT; i++ ) {
-        if ( String( countries[ i ].name ) == countryName ) {
-            count = countries[ i ].cityCount;
-            for ( int j = 0; j < count; j++ ) {
-                cities[ j ] = countries[ i ].cities[ j ].name;
-            }
-            return;
+        if ( countryName == countries[ i ].name ) {
+            return &countries[ i ];
         }
     }
+    return nullptr;
 }
 
 inline bool getTimezoneForCity( String countryName, String city,
@@ -1,15 +1,19 @@
 #include "nameday.h"
+#include "app_state.h"
 #include "time.h"
 
 // ── Globals defined here ───────────────────────────────────────────────────────
-String todayNameday   = "--";
 int    lastNamedayDay  = -1;
 int    lastNamedayHour = -1;
-bool   namedayValid    = false;
 
 // ── External globals owned by main.cpp ────────────────────────────────────────
 extern String selectedCountry;
-extern bool   forceClockRedraw;
+
+// Stores today's name ("--" = none) and notifies if it changed
+static void setNameday( const String &name ) {
+    app.nameday.valid = ( name != "--" );
+    appSet( app.nameday.name, name, APP_NAMEDAY );
+}
 
 // ── Czech nameday data table ───────────────────────────────────────────────────
 // Index: [month 1-12][day 1-31].  Row 0 and column 0 are unused sentinels.
@@ -42,8 +46,7 @@ String getNamedayForDate( int day, int month ) {
 void handleNamedayUpdate() {
     // Only for Czech Republic — hardcoded Czech name table
     if ( selectedCountry != "Czech Republic" ) {
-        namedayValid  = false;
-        todayNameday  = "--";
+        setNameday( "--" );
         return;
     }
 
@@ -51,15 +54,13 @@ void handleNamedayUpdate() {
     struct tm *timeinfo = localtime( &now );
 
     if ( !timeinfo ) {
-        namedayValid = false;
-        todayNameday = "--";
+        setNameday( "--" );
         return;
     }
 
     // Ignore invalid / un-synced time (year < 2025)
     if ( timeinfo->tm_year < 125 ) {
-        namedayValid = false;
-        todayNameday = "--";
+        setNameday( "--" );
         return;
     }
 
@@ -74,12 +75,10 @@ void handleNamedayUpdate() {
 
         log_d( "[NAMEDAY] Getting nameday for day %d.%d", today, month );
 
-        todayNameday = getNamedayForDate( today, month );
-        namedayValid = ( todayNameday != "--" );
+        setNameday( getNamedayForDate( today, month ) );
 
-        if ( namedayValid ) {
-            log_d( "[NAMEDAY] SUCCESS: %s", todayNameday.c_str() );
-            forceClockRedraw = true;
+        if ( app.nameday.valid ) {
+            log_d( "[NAMEDAY] SUCCESS: %s", app.nameday.name.c_str() );
         }
         else {
             log_d( "[NAMEDAY] No nameday for this date" );
@@ -94,12 +93,10 @@ void handleNamedayUpdate() {
         if ( timeinfo2 && timeinfo2->tm_mday != lastNamedayDay ) {
             lastNamedayDay = timeinfo2->tm_mday;
             month          = timeinfo2->tm_mon + 1;
-            todayNameday   = getNamedayForDate( lastNamedayDay, month );
-            namedayValid   = ( todayNameday != "--" );
+            setNameday( getNamedayForDate( lastNamedayDay, month ) );
 
-            if ( namedayValid ) {
-                log_d( "[NAMEDAY] Midnight update: %s", todayNameday.c_str() );
-                forceClockRedraw = true;
+            if ( app.nameday.valid ) {
+                log_d( "[NAMEDAY] Midnight update: %s", app.nameday.name.c_str() );
             }
         }
     }
@@ -6,10 +6,9 @@
 // Only active when selectedCountry == "Czech Republic".
 
 // ── State variables (defined in nameday.cpp) ──────────────────────────────────
-extern String todayNameday;   // Name to display, e.g. "Josef"
+// Today's name is app.nameday (app_state.h), e.g. "Josef", or "--".
 extern int    lastNamedayDay;  // tm_mday of the last update  (-1 = never)
 extern int    lastNamedayHour; // tm_hour of the last update  (-1 = never)
-extern bool   namedayValid;    // true when todayNameday is meaningful
 
 // ── Functions ─────────────────────────────────────────────────────────────────
 
@@ -17,6 +16,6 @@ extern bool   namedayValid;    // true when todayNameday is meaningful
 // Returns "--" for invalid dates or days outside the table.
 String getNamedayForDate( int day, int month );
 
-// Call once per loop iteration (or on demand) to refresh todayNameday.
-// Sets forceClockRedraw = true when the name changes.
+// Call once per loop iteration (or on demand) to refresh app.nameday.
+// A new name notifies APP_NAMEDAY subscribers.
 void handleNamedayUpdate();
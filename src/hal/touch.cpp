@@ -0,0 +1,247 @@
+#include "touch.h"
+#include "touch_cal.h"
+#include "touch_filter.h"
+#include "touch_trace.h"
+#include <XPT2046_Touchscreen.h>
+#include <Arduino.h>
+
+#include "../util/constants.h"
+#include "../util/scheduler.h"
+
+// Externs defined in main.cpp
+extern XPT2046_Touchscreen ts;
+
+// ---------------------------------------------------------------------------
+
+static QueueHandle_t     touchQueue   = nullptr;
+static TaskHandle_t      touchTask    = nullptr;
+static volatile uint32_t irqUs        = 0;
+static volatile bool     penDown      = false;
+static volatile uint32_t movesDropped = 0;
+static unsigned long     holdStart    = 0;    // touchHoldOff(), loop() side only
+static unsigned long     holdMs       = 0;
+
+// Calibration, double-buffered: touchSetCal() fills the idle slot and then
+// flips calSlot, so the task never reads a half-written matrix
+static TouchCal         cal[ 2 ];
+static volatile uint8_t calSlot = 0;
+
+#ifdef TOUCH_TRACE
+// Recorder (task writes, loop() starts / stops) and replayer (loop() starts, task runs it)
+static uint8_t          *recBuf    = nullptr;
+static size_t            recCap    = 0;
+static volatile size_t   recLen    = 0;
+static volatile bool     recording = false;
+static uint32_t          recLastMs = 0;
+static const uint8_t    *playData  = nullptr;
+static size_t            playLen   = 0;
+static volatile bool     playing   = false;
+#endif
+
+// Touch-to-event latency (IRQ edge → TOUCH_DOWN dequeued by the UI)
+static uint32_t latSum = 0, latMax = 0, latCount = 0;
+
+static void IRAM_ATTR onPenIrq() {
+    irqUs = micros();
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR( touchTask, &woken );
+    portYIELD_FROM_ISR( woken );
+}
+
+static TouchEvent makeEvent( TouchEventType type, const TouchFilter &f, uint16_t z ) {
+    // The calibration already encodes the orientation
+    TouchEvent ev;
+    ev.type = type;
+    ev.rawX = touchFilterX( f );
+    ev.rawY = touchFilterY( f );
+    ev.z    = z;
+    touchCalApply( cal[ calSlot ], ev.rawX, ev.rawY, ev.x, ev.y );
+    ev.us   = micros();
+    return ev;
+}
+
+// One controller sample through the filter; queues the resulting event and
+// wakes loop(). Returns true when the press is over (or never started).
+static bool feedSample( TouchFilter &filter, int16_t x, int16_t y, uint16_t z, uint32_t downUs ) {
+    TouchFilterResult r = touchFilterFeed( filter, x, y, z );
+    if ( r == TF_DOWN ) {
+        TouchEvent ev = makeEvent( TOUCH_DOWN, filter, z );
+        ev.us         = downUs;
+        penDown       = true;
+        xQueueSend( touchQueue, &ev, portMAX_DELAY );
+        schedWake();
+    }
+    else if ( r == TF_MOVE ) {
+        TouchEvent ev = makeEvent( TOUCH_MOVE, filter, z );
+        if ( xQueueSend( touchQueue, &ev, 0 ) != pdPASS ) {
+            movesDropped = movesDropped + 1;
+        }
+        schedWake();
+    }
+    else if ( r == TF_UP ) {
+        TouchEvent ev = makeEvent( TOUCH_UP, filter, 0 );
+        penDown       = false;
+        xQueueSend( touchQueue, &ev, portMAX_DELAY );
+        schedWake();
+        return true;
+    }
+    return touchFilterIdle( filter ) && z == 0;
+}
+
+#ifdef TOUCH_TRACE
+static void recordSample( const TS_Point &p ) {
+    uint32_t now = millis();
+    size_t   n   = touchTraceEncode( recBuf + recLen, recCap - recLen, recLen == TOUCH_TRACE_HEADER ? 0 : now - recLastMs,
+                                     p.x, p.y, p.z );
+    if ( n == 0 ) {
+        recording = false;      // Buffer full: the trace ends here
+        return;
+    }
+    recLen    = recLen + n;
+    recLastMs = now;
+}
+
+// Feeds the trace to the filter on its own timeline; the controller is not read
+static void replayTrace() {
+    TouchTraceReader rd;
+    TouchSample      s;
+    TouchFilter      filter;
+    touchFilterReset( filter );
+    touchTraceOpen( rd, playData, playLen );
+    TickType_t start = xTaskGetTickCount();
+    while ( playing && touchTraceNext( rd, s ) ) {
+        TickType_t due = start + pdMS_TO_TICKS( s.ms );
+        TickType_t now = xTaskGetTickCount();
+        if ( ( int32_t )( due - now ) > 0 ) {
+            vTaskDelay( due - now );
+        }
+        feedSample( filter, s.rawX, s.rawY, s.z, micros() );
+    }
+    while ( !touchFilterIdle( filter ) ) {
+        feedSample( filter, 0, 0, 0, 0 );   // Trace cut short: release what is held
+    }
+    playing = false;
+}
+#endif
+
+static void touchTaskFn( void * ) {
+    TouchFilter filter;
+    for ( ;; ) {
+        // Sleep until the pen goes down (or a replay starts)
+        ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+#ifdef TOUCH_TRACE
+        if ( playing ) {
+            replayTrace();
+            ulTaskNotifyTake( pdTRUE, 0 );  // Real presses during the replay are dropped
+            continue;
+        }
+#endif
+        touchFilterReset( filter );
+
+        // Sample until the filter has released the press, or the edge turns
+        // out to be too light to start one
+        TickType_t wake = xTaskGetTickCount();
+        for ( ;; ) {
+            TS_Point p = ts.getPoint();     // z = 0 when not touched
+#ifdef TOUCH_TRACE
+            if ( recording ) {
+                recordSample( p );
+            }
+#endif
+            if ( feedSample( filter, p.x, p.y, p.z, irqUs ) ) {
+                break;
+            }
+            vTaskDelayUntil( &wake, pdMS_TO_TICKS( TOUCH_SAMPLE_MS ) );
+        }
+
+        // Conversions toggle T_IRQ while sampling; those edges are not new presses
+        ulTaskNotifyTake( pdTRUE, 0 );
+    }
+}
+
+void touchBegin( int irqPin ) {
+    touchQueue = xQueueCreate( TOUCH_QUEUE_LEN, sizeof( TouchEvent ) );
+    // Same core as loop(), above it in priority: a sample costs ~50 us of SPI
+    xTaskCreatePinnedToCore( touchTaskFn, "touch", 3072, nullptr, 2, &touchTask, 1 );
+    pinMode( irqPin, INPUT );
+    attachInterrupt( digitalPinToInterrupt( irqPin ), onPenIrq, FALLING );
+    log_i( "[TOUCH] IRQ sampling on GPIO %d, %d ms period, queue %d", irqPin, TOUCH_SAMPLE_MS, TOUCH_QUEUE_LEN );
+}
+
+bool touchNextEvent( TouchEvent &ev, uint32_t waitMs ) {
+    if ( touchQueue == nullptr || xQueueReceive( touchQueue, &ev, pdMS_TO_TICKS( waitMs ) ) != pdPASS ) {
+        return false;
+    }
+    if ( ev.type == TOUCH_DOWN ) {
+        uint32_t lat = micros() - ev.us;
+        latSum += lat;
+        latMax  = max( latMax, lat );
+        if ( ++latCount == TOUCH_STATS_EVERY ) {
+            log_i( "[TOUCH] Touch-to-event avg %lu us, max %lu us over %lu presses, %lu moves dropped",
+                   ( unsigned long )( latSum / latCount ), ( unsigned long )latMax,
+                   ( unsigned long )latCount, ( unsigned long )movesDropped );
+            latSum = latMax = latCount = 0;
+        }
+    }
+    return true;
+}
+
+void touchFlush() {
+    if ( touchQueue != nullptr ) {
+        xQueueReset( touchQueue );
+    }
+}
+
+bool touchIsDown() {
+    return penDown;
+}
+
+void touchHoldOff( uint32_t ms ) {
+    holdStart = millis();
+    holdMs    = ms;
+}
+
+bool touchHeldOff() {
+    return millis() - holdStart < holdMs;
+}
+
+void touchSetCal( const TouchCal &c ) {
+    uint8_t idle = calSlot ^ 1;
+    cal[ idle ]  = c;
+    calSlot      = idle;
+}
+
+#ifdef TOUCH_TRACE
+void touchRecordStart( uint8_t *buf, size_t cap, uint8_t flags ) {
+    recording = false;
+    recBuf    = buf;
+    recCap    = cap;
+    recLen    = touchTraceHeader( buf, flags );
+    recording = true;
+}
+
+size_t touchRecordStop() {
+    recording = false;
+    return recLen;
+}
+
+bool touchReplayStart( const uint8_t *trace, size_t len ) {
+    TouchTraceReader rd;
+    if ( playing || recording || !touchTraceOpen( rd, trace, len ) ) {
+        return false;
+    }
+    playData = trace;
+    playLen  = len;
+    playing  = true;
+    xTaskNotifyGive( touchTask );
+    return true;
+}
+
+void touchReplayStop() {
+    playing = false;
+}
+
+bool touchReplaying() {
+    return playing;
+}
+#endif
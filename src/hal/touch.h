@@ -0,0 +1,63 @@
+#pragma once
+#include <Arduino.h>
+
+#include "touch_cal.h"
+
+// ---------------------------------------------------------------------------
+// Interrupt-driven touch input
+//
+// The XPT2046 pulls T_IRQ low when the pen goes down. That edge wakes a
+// sampling task, which reads the controller every TOUCH_SAMPLE_MS while the
+// pen stays down, runs the samples through touch_filter.h and posts
+// timestamped events to a queue; the UI drains the queue from loop(). Nobody
+// touching means no SPI traffic and a blocked task.
+//
+// The task is the only code that talks to the controller. Everything else
+// (the main loop, list drags, calibration, modal waits) reads events.
+// ---------------------------------------------------------------------------
+
+enum TouchEventType : uint8_t {
+    TOUCH_DOWN,     // Press, once the median window is full (touch_filter.h)
+    TOUCH_MOVE,     // Every further sample while held (dropped if the queue is full)
+    TOUCH_UP        // Pen lifted (after the release debounce); last filtered position
+};
+
+struct TouchEvent {
+    TouchEventType type;
+    int16_t        x, y;        // Screen pixels, current calibration (touch_cal.h)
+    int16_t        rawX, rawY;  // Filtered controller ADC values (calibration)
+    uint16_t       z;           // Pressure
+    uint32_t       us;          // micros(): the IRQ edge for TOUCH_DOWN, the sample otherwise
+};
+
+// Call once in setup() after ts.begin(); irqPin is the controller's T_IRQ line
+void touchBegin( int irqPin );
+
+// Raw-to-screen map for the current orientation; takes effect from the next sample
+void touchSetCal( const TouchCal &cal );
+
+// Next queued event, waiting up to waitMs for one. Returns false if none.
+bool touchNextEvent( TouchEvent &ev, uint32_t waitMs = 0 );
+
+// Drops queued events, e.g. before a modal wait for a fresh press
+void touchFlush();
+
+// True between TOUCH_DOWN and TOUCH_UP as sampled (ahead of the queue)
+bool touchIsDown();
+
+// Ignore presses for ms from now: the debounce after a UI action, set by the
+// handler instead of sleeping in it. loop() keeps draining events meanwhile.
+void touchHoldOff( uint32_t ms );
+bool touchHeldOff();
+
+#ifdef TOUCH_TRACE
+// Trace recorder and replayer (touch_trace.h format; build with -D TOUCH_TRACE).
+// The recorder appends every raw sample of live presses to buf until stopped
+// or full. The replayer feeds a trace to the filter on the trace's own timing
+// in place of the controller, so the UI sees exactly the recorded presses.
+void   touchRecordStart( uint8_t *buf, size_t cap, uint8_t flags );
+size_t touchRecordStop();       // Trace length in bytes
+bool   touchReplayStart( const uint8_t *trace, size_t len );     // trace must outlive the replay
+void   touchReplayStop();
+bool   touchReplaying();
+#endif
@@ -0,0 +1,113 @@
+#include "touch_cal.h"
+
+// ---------------------------------------------------------------------------
+
+// num / den in Q16 without overflowing: the shift goes onto the numerator
+// while it has headroom, the rest comes off the denominator
+static int32_t divQ16( int64_t num, int64_t den ) {
+    int shift = TOUCH_CAL_SHIFT;
+    while ( shift > 0 && llabs( num ) < ( 1LL << 46 ) ) {
+        num <<= 1;
+        shift--;
+    }
+    den >>= shift;
+    return den == 0 ? 0 : ( int32_t )( num / den );
+}
+
+static uint32_t isqrt64( uint64_t v ) {
+    uint64_t r = 0, bit = 1ULL << 62;
+    while ( bit > v ) {
+        bit >>= 2;
+    }
+    while ( bit ) {
+        if ( v >= r + bit ) {
+            v -= r + bit;
+            r  = ( r >> 1 ) + bit;
+        }
+        else {
+            r >>= 1;
+        }
+        bit >>= 2;
+    }
+    return ( uint32_t )r;
+}
+
+void touchCalFromRange( TouchCal &cal, int xMin, int xMax, int yMin, int yMax ) {
+    cal.a = ( int32_t )( ( 320LL << TOUCH_CAL_SHIFT ) / ( xMax - xMin ) );
+    cal.b = 0;
+    cal.c = -xMin * cal.a;
+    cal.d = 0;
+    cal.e = ( int32_t )( ( 240LL << TOUCH_CAL_SHIFT ) / ( yMax - yMin ) );
+    cal.f = -yMin * cal.e;
+}
+
+void touchCalRotate180( TouchCal &cal ) {
+    cal.a = -cal.a;
+    cal.b = -cal.b;
+    cal.c = ( 320 << TOUCH_CAL_SHIFT ) - cal.c;
+    cal.d = -cal.d;
+    cal.e = -cal.e;
+    cal.f = ( 240 << TOUCH_CAL_SHIFT ) - cal.f;
+}
+
+bool touchCalSolve( const int16_t *rawX, const int16_t *rawY, const int16_t *scrX, const int16_t *scrY,
+                    int n, TouchCal &cal, TouchCalFit &fit ) {
+    if ( n < 3 ) {
+        return false;
+    }
+    // Normal equations on the centred data, every term scaled by n so the
+    // means stay integral: [ Sxx Sxy ; Sxy Syy ] · [ a ; b ] = [ Sxu ; Syu ]
+    int64_t sx = 0, sy = 0, su = 0, sv = 0;
+    int64_t sxx = 0, syy = 0, sxy = 0, sxu = 0, syu = 0, sxv = 0, syv = 0;
+    for ( int i = 0; i < n; i++ ) {
+        sx  += rawX[ i ];
+        sy  += rawY[ i ];
+        su  += scrX[ i ];
+        sv  += scrY[ i ];
+        sxx += ( int64_t )rawX[ i ] * rawX[ i ];
+        syy += ( int64_t )rawY[ i ] * rawY[ i ];
+        sxy += ( int64_t )rawX[ i ] * rawY[ i ];
+        sxu += ( int64_t )rawX[ i ] * scrX[ i ];
+        syu += ( int64_t )rawY[ i ] * scrX[ i ];
+        sxv += ( int64_t )rawX[ i ] * scrY[ i ];
+        syv += ( int64_t )rawY[ i ] * scrY[ i ];
+    }
+    sxx = n * sxx - sx * sx;
+    syy = n * syy - sy * sy;
+    sxy = n * sxy - sx * sy;
+    sxu = n * sxu - sx * su;
+    syu = n * syu - sy * su;
+    sxv = n * sxv - sx * sv;
+    syv = n * syv - sy * sv;
+
+    int64_t det = sxx * syy - sxy * sxy;
+    if ( det < ( 1LL << 20 ) ) {
+        return false;   // Collinear points (or one point tapped five times)
+    }
+
+    TouchCal r;
+    r.a = divQ16( syy * sxu - sxy * syu, det );
+    r.b = divQ16( sxx * syu - sxy * sxu, det );
+    r.d = divQ16( syy * sxv - sxy * syv, det );
+    r.e = divQ16( sxx * syv - sxy * sxv, det );
+    r.c = ( int32_t )( ( ( su << TOUCH_CAL_SHIFT ) - r.a * sx - r.b * sy ) / n );
+    r.f = ( int32_t )( ( ( sv << TOUCH_CAL_SHIFT ) - r.d * sx - r.e * sy ) / n );
+
+    // Residuals against the exact (unrounded) map
+    uint64_t sumSq = 0, maxSq = 0;
+    for ( int i = 0; i < n; i++ ) {
+        int64_t  ex = ( int64_t )r.a * rawX[ i ] + ( int64_t )r.b * rawY[ i ] + r.c - ( ( int64_t )scrX[ i ] << TOUCH_CAL_SHIFT );
+        int64_t  ey = ( int64_t )r.d * rawX[ i ] + ( int64_t )r.e * rawY[ i ] + r.f - ( ( int64_t )scrY[ i ] << TOUCH_CAL_SHIFT );
+        uint64_t sq = ( uint64_t )( ex * ex + ey * ey );
+        sumSq += sq;
+        maxSq  = max( maxSq, sq );
+    }
+    fit.rms10 = ( uint16_t )( ( ( uint64_t )isqrt64( sumSq / n ) * 10 + ( 1 << 15 ) ) >> TOUCH_CAL_SHIFT );
+    fit.max10 = ( uint16_t )( ( ( uint64_t )isqrt64( maxSq ) * 10 + ( 1 << 15 ) ) >> TOUCH_CAL_SHIFT );
+
+    // touchCalApply() floors; half a pixel here makes it round to nearest
+    r.c += 1 << ( TOUCH_CAL_SHIFT - 1 );
+    r.f += 1 << ( TOUCH_CAL_SHIFT - 1 );
+    cal = r;
+    return true;
+}
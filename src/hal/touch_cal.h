@@ -0,0 +1,51 @@
+#pragma once
+#include <Arduino.h>
+
+// ---------------------------------------------------------------------------
+// Touch calibration — raw controller ADC to screen pixels by a 2×3 affine map
+//
+//   x = ( a·rawX + b·rawY + c ) >> TOUCH_CAL_SHIFT
+//   y = ( d·rawX + e·rawY + f ) >> TOUCH_CAL_SHIFT
+//
+// The cross terms take up panel rotation and skew, and the signs the
+// orientation. One matrix is kept per display orientation (NVS "tcal" /
+// "tcalF"). It is solved by least squares over TOUCH_CAL_POINTS taps, all in
+// 64-bit integer maths, and applied per sample with two multiply-adds per axis.
+//
+// Plain maths, no hardware access, so the host build checks it too.
+// ---------------------------------------------------------------------------
+
+constexpr int TOUCH_CAL_SHIFT  = 16;     // Coefficients are Q16
+constexpr int TOUCH_CAL_POINTS = 5;      // Four corners inset, plus the centre
+constexpr int TOUCH_CAL_MAX_PX = 8;      // Worst residual a usable calibration may leave
+
+struct TouchCal {
+    int32_t a, b, c;        // Screen x, Q16
+    int32_t d, e, f;        // Screen y, Q16
+};
+
+// Fit quality, tenths of a pixel, over the calibration points
+struct TouchCalFit {
+    uint16_t rms10;
+    uint16_t max10;
+};
+
+// Axis-aligned map equivalent to the old map( raw, min, max, 0, 320 / 240 );
+// the defaults and calibrations saved by the two-point routine go through it
+void touchCalFromRange( TouchCal &cal, int xMin, int xMax, int yMin, int yMax );
+
+// Same panel turned 180° (the other display orientation)
+void touchCalRotate180( TouchCal &cal );
+
+// Least-squares fit of n ≥ 3 raw / screen pairs. False if the points are
+// degenerate (all on one line); cal is left unchanged then.
+bool touchCalSolve( const int16_t *rawX, const int16_t *rawY, const int16_t *scrX, const int16_t *scrY,
+                    int n, TouchCal &cal, TouchCalFit &fit );
+
+// Raw sample to screen pixels, clamped to the panel
+inline void touchCalApply( const TouchCal &cal, int16_t rawX, int16_t rawY, int16_t &x, int16_t &y ) {
+    int32_t sx = ( cal.a * rawX + cal.b * rawY + cal.c ) >> TOUCH_CAL_SHIFT;
+    int32_t sy = ( cal.d * rawX + cal.e * rawY + cal.f ) >> TOUCH_CAL_SHIFT;
+    x = ( int16_t )( sx < 0 ? 0 : sx > 319 ? 319 : sx );
+    y = ( int16_t )( sy < 0 ? 0 : sy > 239 ? 239 : sy );
+}
@@ -0,0 +1,59 @@
+#include "touch_filter.h"
+
+// ---------------------------------------------------------------------------
+
+static int16_t median( const int16_t *v, int n ) {
+    int16_t s[ TOUCH_MEDIAN_N ];
+    memcpy( s, v, n * sizeof( int16_t ) );
+    for ( int i = 1; i < n; i++ ) {
+        for ( int j = i; j > 0 && s[ j ] < s[ j - 1 ]; j-- ) {
+            int16_t t = s[ j ];
+            s[ j ]     = s[ j - 1 ];
+            s[ j - 1 ] = t;
+        }
+    }
+    return s[ ( n - 1 ) / 2 ];
+}
+
+void touchFilterReset( TouchFilter &f ) {
+    memset( &f, 0, sizeof( f ) );
+}
+
+TouchFilterResult touchFilterFeed( TouchFilter &f, int16_t rawX, int16_t rawY, uint16_t z ) {
+    bool started = f.down || f.winCount > 0;
+    if ( z < ( started ? TOUCH_Z_HOLD : TOUCH_Z_PRESS ) ) {
+        if ( started && ++f.lightCount >= TOUCH_RELEASE_SAMPLES ) {
+            bool wasDown = f.down;
+            f.down       = false;
+            f.winCount   = 0;
+            f.lightCount = 0;
+            return wasDown ? TF_UP : TF_NONE;   // Too short to fill the window: a bounce
+        }
+        return TF_NONE;
+    }
+    f.lightCount = 0;
+
+    f.winX[ f.winNext ] = rawX;
+    f.winY[ f.winNext ] = rawY;
+    f.winNext           = ( f.winNext + 1 ) % TOUCH_MEDIAN_N;
+    if ( f.winCount < TOUCH_MEDIAN_N ) {
+        f.winCount++;
+    }
+
+    // No position until the window fills: the landing sample is the noisiest,
+    // and a spike among the first few would otherwise place the press
+    if ( f.winCount < TOUCH_MEDIAN_N ) {
+        return TF_NONE;
+    }
+    int32_t mx = median( f.winX, TOUCH_MEDIAN_N );
+    int32_t my = median( f.winY, TOUCH_MEDIAN_N );
+    if ( !f.down ) {
+        f.x    = mx << 4;
+        f.y    = my << 4;
+        f.down = true;
+        return TF_DOWN;
+    }
+    f.x += ( ( mx << 4 ) - f.x ) >> TOUCH_IIR_SHIFT;
+    f.y += ( ( my << 4 ) - f.y ) >> TOUCH_IIR_SHIFT;
+    return TF_MOVE;
+}
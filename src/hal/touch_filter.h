@@ -0,0 +1,59 @@
+#pragma once
+#include <Arduino.h>
+
+// ---------------------------------------------------------------------------
+// Touch sample filter — runs in the touch task on every raw controller read
+//
+//   pressure gate   a press starts at TOUCH_Z_PRESS and holds down to the
+//                   library's own floor; lighter samples carry no position
+//   median-of-N     over the last TOUCH_MEDIAN_N positions, drops single spikes;
+//                   the press is reported (TF_DOWN) only once the window is
+//                   full, at its median, so the landing sample never places it
+//   IIR             first-order low-pass (1 / 2^TOUCH_IIR_SHIFT) on the median
+//   release         the pen is up only after TOUCH_RELEASE_SAMPLES light
+//                   samples in a row, so a pressure dip does not split a drag;
+//                   a press released before its window fills is dropped
+//
+// Plain state and integer maths, no hardware access: the host build runs the
+// same code over touch traces (host/gesture_traces.cpp).
+// ---------------------------------------------------------------------------
+
+constexpr int      TOUCH_MEDIAN_N        = 3;
+constexpr int      TOUCH_IIR_SHIFT       = 1;    // Weight of a new sample: 1/2
+constexpr uint16_t TOUCH_Z_PRESS         = 600;  // Pressure that starts a press
+constexpr uint16_t TOUCH_Z_HOLD          = 400;  // Pressure that keeps it (XPT2046 library reports 0 below)
+constexpr int      TOUCH_RELEASE_SAMPLES = 3;    // Light samples in a row that end a press
+
+enum TouchFilterResult : uint8_t {
+    TF_NONE,        // Nothing to report (pen up, or a light sample while down)
+    TF_DOWN,
+    TF_MOVE,
+    TF_UP
+};
+
+struct TouchFilter {
+    int16_t  winX[ TOUCH_MEDIAN_N ], winY[ TOUCH_MEDIAN_N ];
+    uint8_t  winCount, winNext;
+    int32_t  x, y;          // IIR state, raw ADC units × 16
+    bool     down;          // TF_DOWN reported, TF_UP not yet
+    uint8_t  lightCount;    // Consecutive light samples while down or filling
+};
+
+void touchFilterReset( TouchFilter &f );
+
+// Feeds one raw sample (z = 0 when the controller reports no touch)
+TouchFilterResult touchFilterFeed( TouchFilter &f, int16_t rawX, int16_t rawY, uint16_t z );
+
+// No press started or filling: the touch task may go back to sleep
+inline bool touchFilterIdle( const TouchFilter &f ) {
+    return !f.down && f.winCount == 0;
+}
+
+// Filtered position in raw ADC units; valid once a press has started
+inline int16_t touchFilterX( const TouchFilter &f ) {
+    return ( int16_t )( ( f.x + 8 ) >> 4 );
+}
+
+inline int16_t touchFilterY( const TouchFilter &f ) {
+    return ( int16_t )( ( f.y + 8 ) >> 4 );
+}
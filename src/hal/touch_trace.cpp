@@ -0,0 +1,67 @@
+#include "touch_trace.h"
+
+// ---------------------------------------------------------------------------
+
+static const uint8_t MAGIC[ 4 ] = { 'C', 'Y', 'D', 'T' };
+
+size_t touchTraceHeader( uint8_t *out, uint8_t flags ) {
+    memcpy( out, MAGIC, sizeof( MAGIC ) );
+    out[ 4 ] = TOUCH_TRACE_VERSION;
+    out[ 5 ] = flags;
+    out[ 6 ] = 0;
+    out[ 7 ] = 0;
+    return TOUCH_TRACE_HEADER;
+}
+
+static void putRecord( uint8_t *out, uint16_t dt, uint16_t x, uint16_t y, uint16_t z ) {
+    out[ 0 ] = dt & 0xFF;
+    out[ 1 ] = ( dt >> 8 ) | ( ( x & 0x0F ) << 4 );
+    out[ 2 ] = x >> 4;
+    out[ 3 ] = y & 0xFF;
+    out[ 4 ] = ( y >> 8 ) | ( ( z & 0x0F ) << 4 );
+    out[ 5 ] = z >> 4;
+}
+
+size_t touchTraceEncode( uint8_t *out, size_t cap, uint32_t dtMs, int16_t rawX, int16_t rawY, uint16_t z ) {
+    size_t gaps = dtMs / TOUCH_TRACE_GAP_MS;
+    size_t len  = ( gaps + 1 ) * TOUCH_TRACE_RECORD;
+    if ( len > cap ) {
+        return 0;
+    }
+    for ( size_t i = 0; i < gaps; i++ ) {
+        putRecord( out + i * TOUCH_TRACE_RECORD, TOUCH_TRACE_GAP_MS, 0, 0, 0 );
+    }
+    putRecord( out + gaps * TOUCH_TRACE_RECORD, dtMs % TOUCH_TRACE_GAP_MS, constrain( rawX, 0, 4095 ),
+               constrain( rawY, 0, 4095 ), min( z, ( uint16_t )4095 ) );
+    return len;
+}
+
+bool touchTraceOpen( TouchTraceReader &r, const uint8_t *data, size_t len ) {
+    if ( len < TOUCH_TRACE_HEADER || memcmp( data, MAGIC, sizeof( MAGIC ) ) != 0 || data[ 4 ] != TOUCH_TRACE_VERSION ) {
+        return false;
+    }
+    r.data  = data;
+    r.len   = len;
+    r.pos   = TOUCH_TRACE_HEADER;
+    r.ms    = 0;
+    r.flags = data[ 5 ];
+    return true;
+}
+
+bool touchTraceNext( TouchTraceReader &r, TouchSample &s ) {
+    while ( r.pos + TOUCH_TRACE_RECORD <= r.len ) {
+        const uint8_t *p  = r.data + r.pos;
+        uint16_t       dt = p[ 0 ] | ( ( p[ 1 ] & 0x0F ) << 8 );
+        r.pos += TOUCH_TRACE_RECORD;
+        r.ms  += dt;
+        if ( dt == TOUCH_TRACE_GAP_MS ) {
+            continue;
+        }
+        s.ms   = r.ms;
+        s.rawX = ( int16_t )( ( p[ 1 ] >> 4 ) | ( p[ 2 ] << 4 ) );
+        s.rawY = ( int16_t )( p[ 3 ] | ( ( p[ 4 ] & 0x0F ) << 8 ) );
+        s.z    = ( uint16_t )( ( p[ 4 ] >> 4 ) | ( p[ 5 ] << 4 ) );
+        return true;
+    }
+    return false;
+}
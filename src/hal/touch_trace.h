@@ -0,0 +1,51 @@
+#pragma once
+#include <Arduino.h>
+
+// ---------------------------------------------------------------------------
+// Touch trace format — raw controller samples with their timing
+//
+//   header  8 bytes   "CYDT", version, flags (bit 0: display flipped), 2 spare
+//   sample  6 bytes   four 12-bit fields, little-endian: ms since the previous
+//                     sample, rawX, rawY, z
+//
+// A gap of TOUCH_TRACE_GAP_MS or more (idle between presses) is carried by
+// gap records: dt = 0xFFF and no sample, just TOUCH_TRACE_GAP_MS of time.
+//
+// One sample per controller read, so a trace holds the presses exactly as the
+// touch task saw them (release samples included) and the gaps between them.
+// Written by the recorder in hal/touch.cpp, read by its replayer and by the
+// host build. Plain byte handling, no hardware access.
+// ---------------------------------------------------------------------------
+
+constexpr uint8_t TOUCH_TRACE_VERSION   = 1;
+constexpr size_t  TOUCH_TRACE_HEADER    = 8;
+constexpr size_t  TOUCH_TRACE_RECORD    = 6;
+constexpr uint8_t TOUCH_TRACE_FLIPPED   = 0x01;
+constexpr int     TOUCH_TRACE_GAP_MS    = 0xFFF;
+constexpr size_t  TOUCH_TRACE_MAX_BYTES = TOUCH_TRACE_HEADER + 2000 * TOUCH_TRACE_RECORD; // ~20 s of pen-down
+
+struct TouchSample {
+    uint32_t ms;            // Since the start of the trace
+    int16_t  rawX, rawY;
+    uint16_t z;             // 0 = not touched
+};
+
+struct TouchTraceReader {
+    const uint8_t *data;
+    size_t         len, pos;
+    uint32_t       ms;
+    uint8_t        flags;
+};
+
+// Writes the header; returns TOUCH_TRACE_HEADER
+size_t touchTraceHeader( uint8_t *out, uint8_t flags );
+
+// Appends one sample dtMs after the previous one, with gap records ahead of it
+// if needed; returns the bytes written, or 0 (nothing written) if over cap
+size_t touchTraceEncode( uint8_t *out, size_t cap, uint32_t dtMs, int16_t rawX, int16_t rawY, uint16_t z );
+
+// False if data is not a trace of this version
+bool touchTraceOpen( TouchTraceReader &r, const uint8_t *data, size_t len );
+
+// Next sample; false at the end
+bool touchTraceNext( TouchTraceReader &r, TouchSample &s );
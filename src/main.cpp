@@ -23,6 +23,7 @@ Ref: https://github.com/lachimalaif/DataDisplay-V1-instalator/tree/main
 #include <Update.h>
 #include <WiFi.h>
 #include <XPT2046_Touchscreen.h>
+#include <sys/time.h>
 #include "time.h"
 
 // --- Application modules ---
@@ -33,20 +34,32 @@ Ref: https://github.com/lachimalaif/DataDisplay-V1-instalator/tree/main
 #include "data/recent.h"
 #include "hal/backlight.h"
 #include "hal/led.h"
+#include "hal/touch.h"
 #include "net/location.h"
 #include "net/ota.h"
 #include "net/timezone.h"
 #include "net/holidays.h"
 #include "net/weather_api.h"
 #include "ui/clock_face.h"
+#include "ui/compositor.h"
+#include "ui/digit_atlas.h"
+#include "ui/dma_push.h"
+#include "ui/gesture.h"
+#include "ui/gfx_stats.h"
 #include "ui/icons.h"
+#include "ui/keyboard.h"
 #include "ui/screens.h"
 #include "ui/theme.h"
+#include "ui/theme_fade.h"
+#include "ui/touch_bench.h"
 #include "ui/touch_handler.h"
+#include "ui/vlist.h"
 #include "util/constants.h"
 #include "util/credentials.h"
 #include "util/moon.h"
+#include "util/scheduler.h"
 #include "util/string_utils.h"
+#include "util/trig.h"
 
 // ================= TOUCHSCREEN PIN DEFINITIONS =================
 #define T_CS 33
@@ -56,14 +69,16 @@ Ref: https://github.com/lachimalaif/DataDisplay-V1-instalator/tree/main
 #define T_DOUT 39
 
 // ================= GLOBAL SETTINGS (Must be FIRST) =================
-TFT_eSPI tft = TFT_eSPI();  // pins defined in: include/User_Setup.h
-XPT2046_Touchscreen ts( T_CS, T_IRQ );
+DisplayTFT tft = DisplayTFT();  // pins defined in: include/User_Setup.h (profiled with GFX_STATS)
+XPT2046_Touchscreen ts( T_CS );   // T_IRQ is owned by hal/touch (wakes the sampling task)
 Preferences prefs;
 bool isWhiteTheme = false;  // NOW IT'S HERE, SO EVERYONE CAN SEE IT
 
 // ================= NEW VARIABLES FOR CLOCKS =================
 bool isDigitalClock = false; // false = Analog, true = Digital
 bool is12hFormat = false;    // false = 24h, true = 12h
+bool sweepMode = false;      // Analog only: true = smooth-sweep anti-aliased hands
+int  digitTransition = DIGIT_FX_SLIDE; // Digital only: DIGIT_FX_* animation for changing digits
 bool invertColors = false;  // NEW VARIABLE: Invert colors for CYD boards with inverted displays
 bool displayFlipped = false; // true = rotation 3 (180° flipped), false = rotation 1 (normal)
 
@@ -84,56 +99,32 @@ int updateProgress = 0;   // Progress 0-100%
 String updateStatus = ""; // Status message
 
 // ================= TEMA NASTAVENI =================
-int themeMode = THEME_DARK; // THEME_DARK=0, THEME_WHITE=1, THEME_BLUE=2, THEME_YELLOW=3
+int themeMode = THEME_DARK; // THEME_DARK=0, THEME_WHITE=1, THEME_BLUE=2, THEME_YELLOW=3, THEME_USER=4
 // NOTE: For BLACK and WHITE themes, isWhiteTheme specifies: false=BLACK, true=WHITE
-// For BLUE and YELLOW themes, isWhiteTheme is ignored (solid colors)
+// For BLUE, YELLOW and USER themes, isWhiteTheme is ignored (own palettes, see theme.cpp)
 
-float themeTransition = 0.0f; // Transition progress(0.0 - 1.0)
-
-// Gradient colours
-uint16_t blueLight = 0x07FF;    // Light blue
-uint16_t blueDark = 0x0010;     // Dark blue
-uint16_t yellowLight = 0xFFE0;  // Light yellow
-uint16_t yellowDark = 0xCC00;   // Dark yellow
+float themeTransition = 0.0f; // Crossfade progress (0.0 - 1.0) while a theme fade plays, 0 otherwise
+bool dayNightTheme = false;    // Classic themes follow the sun: WHITE by day, DARK by night (NVS "dayNight")
 
 // ================= WEATHER GLOBALS =================
+// Weather data and units are in AppState (data/app_state.h)
 String weatherCity = "Plzen";
-float currentTemp = 0.0;
-int currentHumidity = 0;
-float currentWindSpeed = 0.0;
-int currentWindDirection = 0;
-int currentPressure = 0;
-int weatherCode = 0;
 float lat = 0;
 float lon = 0;
-bool weatherUnitF = false;
-bool weatherUnitMph = false;  // false = km/h, true = mph
-bool weatherUnitInHg = false; // false = hPa, true = inHg
 float lookupLat = 0.0;
 float lookupLon = 0.0;
 String coordLatBuffer = "";
 String coordLonBuffer = "";
 bool coordEditingLon = false;
 unsigned long lastWeatherUpdate = 0;
-bool initialWeatherFetched = false;
-
-ForecastData forecast[ 2 ];
-// Forecast day name variables
-String forecastDay1Name = "Monday";    // Tomorrow
-String forecastDay2Name = "Tuesday";   // The day after tomorrow
 
 int moonPhaseVal = 0;
 
-// ================= SUN AND AUTO DIM (NEW FROM control.txt) =================
-String sunriseTime = "--:--";
-String sunsetTime = "--:--";
-
 // ================= AUTODIM UI - SETTINGS IN THE MENU =================
 int autoDimEditMode = 0;  // 0=none, 1=editing start, 2=editing end, 3=editing level
 int autoDimTempStart = 22;
 int autoDimTempEnd = 6;
 int autoDimTempLevel = 20;
-unsigned long lastBrightnessUpdate = 0;  // So that the brightness does not change with each loop
 
 bool autoDimEnabled = false;
 int autoDimStart = 22;
@@ -155,6 +146,9 @@ const char *ntpServer = "pool.ntp.org";
 long gmtOffset_sec = 3600;
 int daylightOffset_sec = 0;
 
+// User theme, embedded from data/user_theme.txt (board_build.embed_txtfiles)
+extern const char userThemeTxt[] asm( "_binary_data_user_theme_txt_start" );
+
 extern const int clockX = 230;
 extern const int clockY = 85;
 extern const int radius = 67;
@@ -205,17 +199,10 @@ bool keyboardNumbers = false;
 bool keyboardShift = false;
 bool showPassword = false; // Default: password is hidden (asterisks)
 
-int touchXMin = 200;    // Normal orientation cal — overridden from NVS if saved
-int touchXMax = 3900;
-int touchYMin = 200;
-int touchYMax = 3900;
-int touchXMinF = 3900;  // Flipped orientation cal defaults (axes reversed relative to normal)
-int touchXMaxF = 200;
-int touchYMinF = 3900;
-int touchYMaxF = 200;
 const int SCREEN_WIDTH  = 320;
 const int SCREEN_HEIGHT = 240;
-constexpr float DEGTORAD = ( float )( PI / 180.0 ); // Degrees to radians conversion
+
+static void schedulerInit();
 
 void setup() {
     // Kill backlight FIRST — before tft.init()
@@ -245,10 +232,13 @@ void setup() {
         password = deobfuscatePassword( prefs.getString( "pass", "" ) );
         isDigitalClock = prefs.getBool( "digiClock", false );
         is12hFormat = prefs.getBool( "12hFmt", false );
+        sweepMode = prefs.getBool( "sweep", false );
+        digitTransition = prefs.getInt( "digitFx", DIGIT_FX_SLIDE );
 
         // FIX: Load saved theme
         themeMode = prefs.getInt( "themeMode", THEME_DARK );
         isWhiteTheme = prefs.getBool( "theme", false );
+        dayNightTheme = prefs.getBool( "dayNight", false );
         invertColors = prefs.getBool( "invertColors", false );
         displayFlipped = prefs.getBool( "dispFlip", false );
 
@@ -266,29 +256,20 @@ void setup() {
         autoDimEnd = prefs.getInt( "autoDimEnd", 6 );
         autoDimLevel = prefs.getInt( "autoDimLevel", 20 );
 
-        // Load touch calibration for the active orientation
-        if ( displayFlipped ) {
-            touchXMin = prefs.getInt( "calXMinF", 3900 );
-            touchXMax = prefs.getInt( "calXMaxF",  200 );
-            touchYMin = prefs.getInt( "calYMinF", 3900 );
-            touchYMax = prefs.getInt( "calYMaxF",  200 );
-        }
-        else {
-            touchXMin = prefs.getInt( "calXMin",  200 );
-            touchXMax = prefs.getInt( "calXMax", 3900 );
-            touchYMin = prefs.getInt( "calYMin",  200 );
-            touchYMax = prefs.getInt( "calYMax", 3900 );
-        }
-
         // FIX: Load temperature unit setting (°C / °F)
-        weatherUnitF = prefs.getBool( "weatherUnitF", false );
-        weatherUnitMph = prefs.getBool( "weatherUnitMph", false );
-        weatherUnitInHg = prefs.getBool( "weatherUnitInHg", false );
-        log_d( "[SETUP] Weather unit loaded: %s", weatherUnitF ? "°F" : "°C" );
+        app.units.tempF = prefs.getBool( "weatherUnitF", false );
+        app.units.windMph = prefs.getBool( "weatherUnitMph", false );
+        app.units.pressureInHg = prefs.getBool( "weatherUnitInHg", false );
+        log_d( "[SETUP] Weather unit loaded: %s", app.units.tempF ? "°F" : "°C" );
 
         prefs.end();
         log_d( "[SETUP] Preferences loaded - Theme: %d, AutoDim: %d, InvertColors: %s", themeMode, autoDimEnabled, invertColors ? "TRUE" : "FALSE" );
     } // end if ( nvsInitialized )
+    loadTouchCal();     // Saved for the active orientation, else the defaults
+
+    // Resolve the palette once; every colour lookup reads it from here on
+    themeLoadUser( userThemeTxt );
+    themeApply();
 
     // ===== TFT LCD INITIALIZATION =====
     tft.init();
@@ -302,6 +283,7 @@ void setup() {
     delay( 50 );
 
     tft.fillScreen( getBgColor() ); // Fill screen with theme colour while backlight is still off
+    dmaPushInit();                   // Async sprite pushes on the TFT's HSPI DMA channel
     backlightInit( brightness );     // Attach LEDC and reveal the screen at user brightness
 
     log_d( "[SETUP] Display inverted (SW): %s | User wants inversion: %s", !invertColors ? "TRUE" : "FALSE", invertColors ? "YES" : "NO" );
@@ -311,13 +293,15 @@ void setup() {
     // ===== TOUCHSCREEN INITIALIZATION =====
     SPI.begin( T_CLK, T_DOUT, T_DIN );
     ts.begin();
-    ts.setRotation( 1 ); // Always 1 — coordinate mirroring for flip is handled by the loop-level map() min/max swap
+    ts.setRotation( 1 ); // Always 1 — flip mirroring is in the per-orientation calibration matrix (hal/touch_cal.h)
+    touchBegin( T_IRQ );
 
     log_d( "[SETUP] Touchscreen initialized" );
 
     // ===== UI INITIALIZATION =====
     tft.setTextColor( getTextColor() );
     tft.setTextDatum( MC_DATUM );
+    clockWidgetsInit();
 
     // ===== LOAD SAVED LOCATION =====
     if ( nvsInitialized ) {
@@ -348,6 +332,7 @@ void setup() {
         if ( WiFi.status() == WL_CONNECTED ) {
             log_i( "[SETUP] WiFi connected successfully" );
             showWifiResultScreen( true );
+            delay( UI_SPLASH_DELAY_MS );     // setup() may block; loop() shows it as a timed splash
             drawLoadingScreen();      // Show loading screen while NTP syncs
 
             if ( regionAutoMode ) {
@@ -373,6 +358,7 @@ void setup() {
         else {
             log_w( "[SETUP] WiFi connection failed" );
             showWifiResultScreen( false );
+            delay( UI_SPLASH_DELAY_MS );     // setup() may block; loop() shows it as a timed splash
             currentState = WIFICONFIG;
             scanWifiNetworks();
             drawInitialSetup();
@@ -385,148 +371,390 @@ void setup() {
         drawInitialSetup();
     }
 
+    schedulerInit();        // loop() runs its jobs from here on
+
+#ifdef TRIG_BENCHMARK
+    trigBenchmark();
+#endif
+
     log_i( "[SETUP] === Setup complete ===" );
 }
 
 // getNamedayForDate() and handleNamedayUpdate() moved to src/data/nameday.cpp
 // fetchTodayHoliday() and handleHolidayUpdate() moved to src/net/holidays.cpp
 
+// ---------------------------------------------------------------------------
+// loop() jobs (util/scheduler.h). loop() sleeps until one is due or the touch
+// task posts an event; off the clock screen only the WiFi watch wakes it.
+// ---------------------------------------------------------------------------
+static void brightnessTick();
+static void wifiWatchTick();
+static void reconnectTick();
+static void inactivityTick();
+static void clockTick();
+static void sweepTick();
+static void digitTick();
+static void weatherTick();
+static void versionTick();
+static void loopStatsTick();
+
+static SchedJob brightnessJob = { "brightness", brightnessTick };
+static SchedJob wifiWatchJob  = { "wifi-watch", wifiWatchTick };
+static SchedJob reconnectJob  = { "reconnect", reconnectTick };
+static SchedJob inactivityJob = { "inactivity", inactivityTick };
+static SchedJob clockJob      = { "clock", clockTick };
+static SchedJob sweepJob      = { "sweep", sweepTick };
+static SchedJob digitJob      = { "digits", digitTick };
+static SchedJob weatherJob    = { "weather", weatherTick };
+static SchedJob versionJob    = { "version", versionTick };
+static SchedJob loopStatsJob  = { "loop-stats", loopStatsTick };
+
+static bool clockRedrawQueued = false;  // clockJob armed for the lastSec == -1 repaint
+
+// Arms the jobs that run from boot; the clock jobs are armed by loop()
+static void schedulerInit() {
+    schedBegin();
+    schedEvery( brightnessJob, BRIGHTNESS_UPDATE_INTERVAL );
+    schedEvery( wifiWatchJob, WIFI_CHECK_INTERVAL );
+    schedAfter( inactivityJob, SETTINGS_INACTIVITY_TIMEOUT );
+    schedAfter( weatherJob, 0 );
+    schedAfter( versionJob, 0 );
+    schedEvery( loopStatsJob, LOOP_STATS_INTERVAL );
+    touchBenchBegin();
+}
 
-void loop() {
-    // AUTODIM LOGIC
-    if ( millis() - lastBrightnessUpdate > BRIGHTNESS_UPDATE_INTERVAL ) {
-        applyAutoDim();
-        lastBrightnessUpdate = millis();
+// AUTODIM AND DAY/NIGHT THEME
+static void brightnessTick() {
+    applyAutoDim();
+    themeDayNightTick();
+}
+
+// WiFi CONNECTION CHECK — configuration screens stay up, others fall back to the clock
+static void wifiWatchTick() {
+    if ( WiFi.status() == WL_CONNECTED ) {
+        return;
     }
+    if ( currentState != WIFICONFIG && currentState != KEYBOARD && currentState != SSID_INPUT && currentState != CUSTOMCITYINPUT && currentState != CUSTOMCOUNTRYINPUT &&
+            currentState != SETTINGS && currentState != WEATHERCONFIG && currentState != REGIONALCONFIG && currentState != GRAPHICSCONFIG &&
+            currentState != FIRMWARE_SETTINGS && currentState != COUNTRYSELECT && currentState != CITYSELECT && currentState != LOCATIONCONFIRM &&
+            currentState != COUNTRYLOOKUPCONFIRM && currentState != CITYLOOKUPCONFIRM ) {
+        currentState = CLOCK;
+    }
+    if ( !schedArmed( reconnectJob ) ) {
+        schedEvery( reconnectJob, WIFI_RECONNECT_INTERVAL, 0 );
+    }
+}
 
-    // 1. WiFi CONNECTION CHECK
-    if ( WiFi.status() != WL_CONNECTED ) {
-        if ( currentState != WIFICONFIG && currentState != KEYBOARD && currentState != SSID_INPUT && currentState != CUSTOMCITYINPUT && currentState != CUSTOMCOUNTRYINPUT &&
-                currentState != SETTINGS && currentState != WEATHERCONFIG && currentState != REGIONALCONFIG && currentState != GRAPHICSCONFIG &&
-                currentState != FIRMWARE_SETTINGS && currentState != COUNTRYSELECT && currentState != CITYSELECT && currentState != LOCATIONCONFIRM &&
-                currentState != COUNTRYLOOKUPCONFIRM && currentState != CITYLOOKUPCONFIRM ) {
-            currentState = CLOCK;
+static void reconnectTick() {
+    if ( WiFi.status() == WL_CONNECTED ) {
+        schedCancel( reconnectJob );
+        return;
+    }
+    log_i( "WIFI: Attempting reconnect..." );
+    WiFi.reconnect();
+}
+
+// INACTIVITY TIMEOUT — re-armed by every touch; back to CLOCK from any settings/setup screen
+static void inactivityTick() {
+    if ( currentState != CLOCK ) {
+        currentState = CLOCK;
+        lastSec      = -1;
+    }
+}
+
+// CLOCK LOGIC — runs just after each second starts while the clock is up
+static void clockTick() {
+    if ( currentState != CLOCK || themeFadeActive() ) {
+        return;     // loop() arms it again on the way back, or once the fade is done
+    }
+    struct tm ti;
+    if ( !getLocalTime( &ti ) ) {
+        schedAfter( clockJob, 1000 );
+        return;
+    }
+    if ( ti.tm_sec != lastSec ) {
+        if ( lastSec == -1 ) {
+            // Loading screen is still showing from setup().
+            // Do all HTTP work first so it stays visible throughout,
+            // then build the clock display in one pass — no flicker.
+            forceClockRedraw = true;
+            handleNamedayUpdate();
+            handleHolidayUpdate();
+
+            if ( lastWeatherUpdate == 0 && cityName != "" ) {
+                weatherCity = cityName;
+                fetchWeatherData();
+                lastWeatherUpdate = millis();
+            }
+
+            // Now clear and paint the final layout
+            vlistEnd();     // Back from a list screen: its row sprite is not needed
+            dmaSync();
+            fillBackground( 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT );
+
+            updateMoonWidget();
+            compositorInvalidateAll();  // Every widget repaints on this loop's flush
         }
 
-        static unsigned long lastReconnectAttempt = 0;
-        if ( millis() - lastReconnectAttempt > WIFI_RECONNECT_INTERVAL ) {
-            log_i( "WIFI: Attempting reconnect..." );
-            WiFi.reconnect();
-            lastReconnectAttempt = millis();
+        updateDateWidgets( &ti );
+        updateStatusWidgets();
+        if ( !sweepMode || isDigitalClock ) {
+            updateHands( ti.tm_hour, ti.tm_min, ti.tm_sec );
         }
+        lastHour          = ti.tm_hour;
+        lastMin           = ti.tm_min;
+        lastSec           = ti.tm_sec;
+        clockRedrawQueued = false;
+    }
+
+    // Leave the rest of the day-change handler unchanged.
+    if ( ti.tm_mday != lastDay ) {
+        lastDay = ti.tm_mday;
+        handleNamedayUpdate();
+        handleHolidayUpdate();
+        updateDateWidgets( &ti );
+        updateMoonWidget();         // Moon phase follows the date
+    }
+
+    // Smooth-sweep analog hands render at their own frame rate; digital
+    // clock digits animate for a few frames after they change
+    if ( sweepMode && !isDigitalClock && !schedArmed( sweepJob ) ) {
+        schedEvery( sweepJob, SWEEP_FRAME_MS, 0 );
+    }
+    if ( isDigitalClock && !schedArmed( digitJob ) ) {
+        schedEvery( digitJob, DIGIT_FRAME_MS, 0 );
     }
 
-    // 2. TOUCH HANDLING
-    if ( ts.touched() ) {
-        if ( millis() - lastTouchTime < TOUCH_DEBOUNCE_MS ) {
-            return;
+    struct timeval tv;
+    gettimeofday( &tv, nullptr );
+    schedAfter( clockJob, 1000 - tv.tv_usec / 1000 + CLOCK_TICK_SLACK_MS );
+}
+
+static void sweepTick() {
+    if ( currentState != CLOCK || !sweepMode || isDigitalClock ) {
+        schedCancel( sweepJob );
+        return;
+    }
+    if ( !themeFadeActive() ) {
+        struct timeval tv;
+        gettimeofday( &tv, nullptr );
+        updateHandsSweep( tv );
+    }
+}
+
+// Digital clock digit transitions; stops with the last frame
+static void digitTick() {
+    if ( themeFadeActive() ) {
+        return;     // The fade owns the screen
+    }
+    if ( currentState != CLOCK || !isDigitalClock || !digitsAnimate() ) {
+        schedCancel( digitJob );
+    }
+}
+
+// WEATHER REFRESH — on the clock screen, WEATHER_UPDATE_INTERVAL after the
+// last fetch (which the first clock draw or a city change may have made)
+static void weatherTick() {
+    if ( millis() - lastWeatherUpdate > WEATHER_UPDATE_INTERVAL && currentState == CLOCK &&
+            WiFi.status() == WL_CONNECTED && cityName != "" ) {
+        fetchWeatherData();
+        lastWeatherUpdate = millis();
+    }
+    unsigned long age = millis() - lastWeatherUpdate;
+    schedAfter( weatherJob, age > WEATHER_UPDATE_INTERVAL ? JOB_RETRY_MS : WEATHER_UPDATE_INTERVAL + 1 - age );
+}
+
+// OTA version check (at startup and every X hours)
+static void versionTick() {
+    if ( !isUpdating && WiFi.status() == WL_CONNECTED &&
+            ( lastVersionCheck == 0 || millis() - lastVersionCheck > VERSION_CHECK_INTERVAL ) ) {
+        checkForUpdate();
+
+        // Debug: Display what we loaded
+        if ( updateAvailable ) {
+            log_i( "[OTA] Update check complete: v%s url=%s", availableVersion.c_str(), downloadURL.c_str() );
         }
-        lastTouchTime = millis();
 
-        // If auto-dim has darkened the screen, any touch restores brightness first
-        if ( isDimmed ) {
-            backlightCancelDim();
+        // If an update is available, mark the icon dirty (painted on the next CLOCK flush)
+        if ( updateAvailable && currentState == CLOCK ) {
+            updateStatusWidgets();
         }
 
-        TS_Point p = ts.getPoint();
-        // Cal values already encode orientation (flipped set has min/max reversed)
-        int x = map( p.x, touchXMin, touchXMax, 0, SCREEN_WIDTH  );
-        int y = map( p.y, touchYMin, touchYMax, 0, SCREEN_HEIGHT );
-        x = constrain( x, 0, SCREEN_WIDTH - 1 );
-        y = constrain( y, 0, SCREEN_HEIGHT - 1 );
+        // If an update is available and mode is AUTO
+        if ( updateAvailable && otaInstallMode == 0 ) {
+            log_i( "[OTA] Auto-update mode - starting update..." );
+            dmaSync();  // OTA progress screen draws straight to tft
+            performOTAUpdate();
+        }
+    }
+    // A check that could not run or failed (lastVersionCheck not set) is retried
+    unsigned long age = millis() - lastVersionCheck;
+    bool          due = lastVersionCheck == 0 || age > VERSION_CHECK_INTERVAL;
+    schedAfter( versionJob, due ? JOB_RETRY_MS : VERSION_CHECK_INTERVAL + 1 - age );
+}
 
-        handleTouch( x, y );
+// Worst loop() pass and worst touch handler, logged every LOOP_STATS_INTERVAL
+// with the job stats. A pass is one wake: network fetches and OTA checks show
+// up in it, the touch figure is the handlers alone. An idle pass ran no job
+// and had no touch event.
+//
+// Handlers return once they have drawn; animations run from jobs (list
+// scrolls in vlist.cpp, theme fades in theme_fade.cpp). These still block
+// by design and so set the worst-handler figure when used:
+// - theme swatch: the crossfade's full-screen read-back (themeFade());
+// - Regional SYNC, city / country lookups, Firmware CHECK NOW: HTTP round
+//   trips (syncRegion(), lookup*Geonames(), checkForUpdate());
+// - Settings → WiFi Setup: the network scan (scanWifiNetworks());
+// - Settings → Calibrate: the calibration, which waits for its taps;
+// - Firmware INSTALL: the OTA update, which ends in a restart.
+static uint32_t passes = 0, idlePasses = 0, worstPass = 0, worstTouch = 0;
+static int      worstTouchState = -1;
+
+static void loopStatsPoll( uint32_t passUs, uint32_t touchUs, int touchState, bool idle ) {
+    passes++;
+    idlePasses += idle;
+    worstPass   = max( worstPass, passUs );
+    if ( touchUs > worstTouch ) {
+        worstTouch      = touchUs;
+        worstTouchState = touchState;
     }
+}
 
-    // 3. INACTIVITY TIMEOUT — return to CLOCK after 3 min of no touch while in any settings/setup screen
-    if ( currentState != CLOCK && millis() - lastTouchTime > SETTINGS_INACTIVITY_TIMEOUT ) {
-        currentState = CLOCK;
-        lastSec      = -1;
+static void loopStatsTick() {
+    log_i( "[LOOP] %lu passes (%lu idle), worst %lu us; worst touch handler %lu us (screen %d)",
+           ( unsigned long )passes, ( unsigned long )idlePasses, ( unsigned long )worstPass,
+           ( unsigned long )worstTouch, worstTouchState );
+    passes = idlePasses = worstPass = worstTouch = 0;
+    worstTouchState = -1;
+    schedStatsLog();
+}
+
+
+// Every dispatched touch restarts the inactivity timeout and wakes a dimmed
+// screen; handlers draw straight to tft, over a finished theme fade
+static void touchDispatchBegin() {
+    lastTouchTime = millis();
+    schedAfter( inactivityJob, SETTINGS_INACTIVITY_TIMEOUT );
+    if ( isDimmed ) {
+        backlightCancelDim();
     }
+    dmaSync();
+    themeFadeFinish();
+}
 
-    // 4. CLOCK AND WEATHER LOGIC
-    if ( currentState == CLOCK ) {
-        struct tm ti;
-        if ( getLocalTime( &ti ) ) {
-            if ( ti.tm_sec != lastSec ) {
-                if ( lastSec == -1 ) {
-                    // Loading screen is still showing from setup().
-                    // Do all HTTP work first so it stays visible throughout,
-                    // then build the clock display in one pass — no flicker.
-                    forceClockRedraw = true;
-                    handleNamedayUpdate();
-                    handleHolidayUpdate();
-
-                    if ( lastWeatherUpdate == 0 && cityName != "" ) {
-                        weatherCity = cityName;
-                        fetchWeatherData();
-                        lastWeatherUpdate = millis();
-                    }
-
-                    // Now clear and paint the final layout
-                    tft.fillScreen( getBgColor() );
-                    if ( themeMode == THEME_BLUE ) {
-                        fillGradientVertical( 0, 0, 320, 240, blueDark, blueLight );
-                    }
-                    else if ( themeMode == THEME_YELLOW ) {
-                        fillGradientVertical( 0, 0, 320, 240, yellowDark, yellowLight );
-                    }
-
-                    drawWeatherSection();
-                    drawDateAndWeek( &ti );
-                    drawSettingsIcon( TFT_SKYBLUE );
-                    drawWifiIndicator();
-                    drawUpdateIndicator();
-                }
-
-                updateHands( ti.tm_hour, ti.tm_min, ti.tm_sec );
-                lastHour = ti.tm_hour;
-                lastMin  = ti.tm_min;
-                lastSec  = ti.tm_sec;
-            }
+// The TOUCH_UP that ends a press in a scrolling list, whatever the debounce;
+// returns the handler time
+static uint32_t touchRelease( const TouchEvent &ev ) {
+    dmaSync();
+    themeFadeFinish();
+    uint32_t t0 = micros();
+    handleTouch( ev.x, ev.y, TOUCH_UP );
+    return micros() - t0;
+}
 
-            // Leave the rest of the day-change handler unchanged.
-            if ( ti.tm_mday != lastDay ) {
-                lastDay = ti.tm_mday;
-                handleNamedayUpdate();
-                handleHolidayUpdate();
-                drawDateAndWeek( &ti );
-                drawSettingsIcon( TFT_SKYBLUE );
-                drawWifiIndicator();
-                drawUpdateIndicator();
+void loop() {
+    uint32_t passStart  = micros();
+    uint32_t touchUs    = 0;
+    int      touchState = -1;      // Screen the handler ran on
+    bool     events     = false;
+
+    // 1. TOUCH HANDLING — drain the touch task's queue. On the clock and
+    // settings screens a press acts on release (tap or long press), so a
+    // swipe can page between them; elsewhere a TOUCH_DOWN is dispatched as
+    // such (the keyboard acts on it), else the newest held position, and a
+    // press in a scrolling list is followed to its TOUCH_UP.
+    static GestureTracker gestures;
+    TouchEvent ev, press, release;
+    Gesture    g, swipe;
+    uint32_t   swipeUs = 0;
+    bool       pressed = false, released = false, releaseFirst = false;
+    bool       swiped  = false, longPress = false;
+    bool       paging  = touchPagesBySwipe();
+    while ( touchNextEvent( ev ) ) {
+        events          = true;
+        bool recognised = gestureFeed( gestures, ev, g );
+        if ( !paging ) {
+            if ( ev.type == TOUCH_UP ) {
+                release      = ev;
+                released     = true;
+                releaseFirst = !pressed;    // Ends a press dispatched on an earlier pass
             }
-        }
-        if ( millis() - lastWeatherUpdate > WEATHER_UPDATE_INTERVAL ) {
-            if ( WiFi.status() == WL_CONNECTED && cityName != "" ) {
-                fetchWeatherData();
-                drawWeatherSection();
-                lastWeatherUpdate = millis();
+            else if ( !( pressed && press.type == TOUCH_DOWN ) ) {
+                press   = ev;
+                pressed = true;
             }
         }
+        else if ( recognised && ( g.type == GESTURE_TAP || g.type == GESTURE_LONG_PRESS ) ) {
+            press     = ev;     // Time of the event that completed the gesture
+            press.x   = g.x;
+            press.y   = g.y;
+            pressed   = true;
+            longPress = g.type == GESTURE_LONG_PRESS;
+        }
+        else if ( recognised && g.type == GESTURE_SWIPE ) {
+            swipe   = g;
+            swipeUs = ev.us;
+            swiped  = true;
+        }
+    }
+    if ( swiped ) {
+        touchDispatchBegin();
+        touchState  = currentState;
+        uint32_t t0 = micros();
+        handleSwipe( swipe.dir );
+        touchUs = micros() - t0;
+        touchBenchDispatched( swipeUs, touchState );
     }
-    // OTA version check (at startup and every X hours)
-    if ( !isUpdating && WiFi.status() == WL_CONNECTED ) {
-        if ( lastVersionCheck == 0 || ( millis() - lastVersionCheck > VERSION_CHECK_INTERVAL ) ) {
-            checkForUpdate();
-
-            // Debug: Display what we loaded
-            if ( updateAvailable ) {
-                log_i( "[OTA] Update check complete: v%s url=%s", availableVersion.c_str(), downloadURL.c_str() );
+    else {
+        if ( released && releaseFirst && vlistPressed() ) {
+            touchState = currentState;
+            touchUs   += touchRelease( release );
+        }
+        // The on-screen keyboard acts on TOUCH_DOWN alone, so typing is not held to the
+        // debounce, and a list drag follows every move; a handler's touchHoldOff()
+        // applies to every other press
+        if ( pressed && ( vlistPressed() || ( !touchHeldOff() && ( kbActive() || millis() - lastTouchTime >= TOUCH_DEBOUNCE_MS ) ) ) ) {
+            touchDispatchBegin();
+            touchState  = currentState;
+            uint32_t t0 = micros();
+            if ( longPress ) {
+                handleLongPress( press.x, press.y );
             }
-
-            // If an update is available, force icon redraw
-            if ( updateAvailable && currentState == CLOCK ) {
-                drawUpdateIndicator();  // Show icon immediately
+            else {
+                handleTouch( press.x, press.y, press.type );
             }
+            touchUs += micros() - t0;
+            touchBenchDispatched( press.us, touchState );
+        }
+        if ( released && !releaseFirst && vlistPressed() ) {
+            touchState = currentState;
+            touchUs   += touchRelease( release );
+        }
+    }
 
-            // If an update is available and mode is AUTO
-            if ( updateAvailable && otaInstallMode == 0 ) {
-                log_i( "[OTA] Auto-update mode - starting update..." );
-                performOTAUpdate();
-            }
+    // 2. DUE JOBS — clock, weather, WiFi, OTA check, modal timers, ...
+    int ran = schedRun();
+
+    // 3. CLOCK — its job starts on the way (back) to the clock screen, and
+    // again at once when a handler or job asked for a full repaint. A theme
+    // fade owns the screen while it plays; its end asks for that repaint.
+    if ( currentState == CLOCK && !themeFadeActive() ) {
+        if ( !schedArmed( clockJob ) || ( lastSec == -1 && !clockRedrawQueued ) ) {
+            schedAfter( clockJob, 0 );
+            clockRedrawQueued = lastSec == -1;
         }
+        // Repaint whatever the widgets above marked dirty — one pass per merged region
+        compositorFlush();
     }
-    delay( 20 );
+    else if ( currentState != CLOCK ) {
+        releaseClockSprites();      // No-op once freed; the analog clock recreates them
+    }
+
+    // Draw statistics — no-op unless built with GFX_STATS
+    gfxStatsPoll( currentState );
+    touchBenchPassDone();   // Touch-to-pixel of a replayed press handled this pass
+    loopStatsPoll( micros() - passStart, touchUs, touchState, !events && ran == 0 );
+    schedSleep();           // Until the next job is due or the touch task posts an event
 }
 
 
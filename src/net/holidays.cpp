@@ -7,19 +7,17 @@
 #include <time.h>
 
 #include "../util/constants.h"
+#include "../data/app_state.h"
 #include "../net/location.h"
 
 // ── Globals defined here ───────────────────────────────────────────────────
-String todayHoliday   = "";
 int    lastHolidayDay  = -1;
-bool   holidayValid    = false;
 
 // ── External globals owned by main.cpp ────────────────────────────────────
 extern String lookupISOCode;     // ISO 3166-1 alpha-2, set by lookupCountryEmbedded/REST
 extern String selectedCountry;   // Used for one-time ISO fallback when NVS has no isoCode
 extern Preferences prefs;        // Shared NVS handle defined in main.cpp
 extern int    lookupGmtOffset;   // UTC offset in seconds (from timezone detect)
-extern bool   forceClockRedraw;
 
 // ── Internal helpers ───────────────────────────────────────────────────────
 
@@ -197,10 +195,9 @@ void handleHolidayUpdate() {
 
     String name = fetchTodayHoliday( isoCode, offsetHours );
 
-    if ( name != todayHoliday ) {
-        todayHoliday = name;
-        holidayValid = !name.isEmpty();
-        forceClockRedraw = true;
-        log_d( "[HOLIDAY] Updated: '%s' (valid=%d)", todayHoliday.c_str(), holidayValid );
+    if ( name != app.holiday.name ) {
+        app.holiday.valid = !name.isEmpty();
+        appSet( app.holiday.name, name, APP_HOLIDAY );
+        log_d( "[HOLIDAY] Updated: '%s' (valid=%d)", name.c_str(), app.holiday.valid );
     }
 }
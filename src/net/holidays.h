@@ -10,15 +10,14 @@
 //      → 200 = holiday today, 204 = not a holiday, 404 = unsupported country
 //   2. Only if 200: fetch PublicHolidays/{year}/{cc} and locate today's
 //      localName from the array.
-//   3. Cache the result in todayHoliday for the rest of the day.
+//   3. Cache the result in app.holiday for the rest of the day.
 //
 // Works alongside the Czech static nameday table — both can display
 // simultaneously for CZ (nameday every day + holiday on ~13 days/year).
 
 // ── State variables (defined in holidays.cpp) ─────────────────────────────
-extern String todayHoliday;    // localName for today's holiday, or ""
+// Today's holiday is app.holiday (data/app_state.h): localName, or "".
 extern int    lastHolidayDay;  // tm_mday of the last check (-1 = never)
-extern bool   holidayValid;    // true when todayHoliday holds a real name
 
 // ── Functions ──────────────────────────────────────────────────────────────
 
@@ -28,7 +27,7 @@ extern bool   holidayValid;    // true when todayHoliday holds a real name
 // Performs up to two HTTPS requests; call from a WiFi-connected context only.
 String fetchTodayHoliday( const String &isoCode, int utcOffsetHours );
 
-// Call once per loop iteration (or on demand) to refresh todayHoliday.
+// Call once per loop iteration (or on demand) to refresh app.holiday.
 // Uses lookupISOCode (set by lookupCountryEmbedded/lookupCountryRESTAPI) → fetchTodayHoliday().
-// Updates once per day; sets forceClockRedraw = true when value changes.
+// Updates once per day; a new value notifies APP_HOLIDAY subscribers.
 void handleHolidayUpdate();
@@ -6,6 +6,7 @@
 #include <Update.h>
 #include <TFT_eSPI.h>
 
+#include "../ui/gfx_stats.h"
 #include "../util/constants.h"
 #include "../data/app_state.h"   // ScreenState enum
 
@@ -20,7 +21,7 @@ extern bool           isUpdating;
 extern int            updateProgress;
 extern String         updateStatus;
 extern ScreenState    currentState;
-extern TFT_eSPI       tft;
+extern DisplayTFT     tft;
 
 // UI function defined in main.cpp (Phase 3 will move it to ui/screen_firmware)
 void drawFirmwareScreen();
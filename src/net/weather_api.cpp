@@ -26,22 +26,6 @@ extern int         lookupDstOffset;
 extern const char *ntpServer;
 extern int         lastDay;
 
-extern float       currentTemp;
-extern int         currentHumidity;
-extern int         weatherCode;
-extern float       currentWindSpeed;
-extern int         currentWindDirection;
-extern int         currentPressure;
-
-extern ForecastData forecast[ 2 ];
-extern String       forecastDay1Name;
-extern String       forecastDay2Name;
-
-extern String       sunriseTime;
-extern String       sunsetTime;
-
-extern bool         initialWeatherFetched;
-
 // ---------------------------------------------------------------------------
 
 String getWeatherDesc( int code ) {
@@ -195,9 +179,9 @@ void fetchWeatherData() {
     if ( timeinfo ) {
         const char *dayAbbr[] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
         int tomorrowWday = ( timeinfo->tm_wday + 1 ) % 7;
-        forecastDay1Name = dayAbbr[ tomorrowWday ];
+        appSet( app.weather.forecastDay[ 0 ], dayAbbr[ tomorrowWday ], APP_WX_FORECAST );
         int afterTomorrowWday = ( timeinfo->tm_wday + 2 ) % 7;
-        forecastDay2Name = dayAbbr[ afterTomorrowWday ];
+        appSet( app.weather.forecastDay[ 1 ], dayAbbr[ afterTomorrowWday ], APP_WX_FORECAST );
     }
 
     String weatherUrl = "https://api.open-meteo.com/v1/forecast?latitude=" + String( lat, 4 ) + "&longitude=" + String( lon, 4 ) +
@@ -213,44 +197,45 @@ void fetchWeatherData() {
         DeserializationError error = deserializeJson( doc, payload );
 
         if ( !error ) {
-            currentTemp = doc[ "current" ][ "temperature_2m" ];
-            currentHumidity = doc[ "current" ][ "relative_humidity_2m" ];
-            weatherCode = doc[ "current" ][ "weather_code" ];
-            currentWindSpeed = doc[ "current" ][ "wind_speed_10m" ];
-            currentWindDirection = doc[ "current" ][ "wind_direction_10m" ];
-
-            forecast[ 0 ].code = doc[ "daily" ][ "weather_code" ][ 1 ];
-            forecast[ 0 ].tempMax = doc[ "daily" ][ "temperature_2m_max" ][ 1 ];
-            forecast[ 0 ].tempMin = doc[ "daily" ][ "temperature_2m_min" ][ 1 ];
-            forecast[ 1 ].code = doc[ "daily" ][ "weather_code" ][ 2 ];
-            forecast[ 1 ].tempMax = doc[ "daily" ][ "temperature_2m_max" ][ 2 ];
-            forecast[ 1 ].tempMin = doc[ "daily" ][ "temperature_2m_min" ][ 2 ];
+            // Each field notifies its widgets only if the value changed
+            WeatherState &wx = app.weather;
+            appSet( wx.temp, doc[ "current" ][ "temperature_2m" ].as<float>(), APP_WX_NOW );
+            appSet( wx.humidity, doc[ "current" ][ "relative_humidity_2m" ].as<int>(), APP_WX_DETAILS );
+            appSet( wx.code, doc[ "current" ][ "weather_code" ].as<int>(), APP_WX_NOW );
+            appSet( wx.windSpeed, doc[ "current" ][ "wind_speed_10m" ].as<float>(), APP_WX_DETAILS );
+            appSet( wx.windDir, doc[ "current" ][ "wind_direction_10m" ].as<int>(), APP_WX_DETAILS );
+
+            for ( int i = 0; i < 2; i++ ) {
+                appSet( wx.forecast[ i ].code, doc[ "daily" ][ "weather_code" ][ i + 1 ].as<int>(), APP_WX_FORECAST );
+                appSet( wx.forecast[ i ].tempMax, doc[ "daily" ][ "temperature_2m_max" ][ i + 1 ].as<float>(), APP_WX_FORECAST );
+                appSet( wx.forecast[ i ].tempMin, doc[ "daily" ][ "temperature_2m_min" ][ i + 1 ].as<float>(), APP_WX_FORECAST );
+            }
 
             // Sunrise/Sunset processing
             if ( doc[ "daily" ][ "sunrise" ].size() > 0 ) {
                 String sunriseRaw = doc[ "daily" ][ "sunrise" ][ 0 ].as<String>();
                 int tPos = sunriseRaw.indexOf( 'T' );
                 if ( tPos > 0 ) {
-                    sunriseTime = sunriseRaw.substring( tPos + 1, tPos + 6 );
+                    appSet( wx.sunrise, sunriseRaw.substring( tPos + 1, tPos + 6 ), APP_WX_SUN );
                 }
             }
             if ( doc[ "daily" ][ "sunset" ].size() > 0 ) {
                 String sunsetRaw = doc[ "daily" ][ "sunset" ][ 0 ].as<String>();
                 int tPos = sunsetRaw.indexOf( 'T' );
                 if ( tPos > 0 ) {
-                    sunsetTime = sunsetRaw.substring( tPos + 1, tPos + 6 );
+                    appSet( wx.sunset, sunsetRaw.substring( tPos + 1, tPos + 6 ), APP_WX_SUN );
                 }
             }
 
             // Pressure processing
             if ( doc[ "current" ][ "pressure_msl" ] ) {
-                currentPressure = doc[ "current" ][ "pressure_msl" ].as<int>();
+                appSet( wx.pressure, doc[ "current" ][ "pressure_msl" ].as<int>(), APP_WX_DETAILS );
             }
             else {
-                currentPressure = 1013;
+                appSet( wx.pressure, 1013, APP_WX_DETAILS );
             }
 
-            initialWeatherFetched = true;
+            appSet( wx.fetched, true, APP_WX_FETCHED );
             log_i( "[WEATHER] Data fetched successfully" );
         }
         else {
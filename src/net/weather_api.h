@@ -8,6 +8,6 @@ String getWeatherDesc( int code );
 // Returns a compass bearing abbreviation (N/NE/E/… ) for a wind direction in degrees
 String getWindDir( int deg );
 
-// Fetches weather data from Open-Meteo (geocoding + forecast) and updates all
-// global weather state variables.  Calls detectTimezoneFromCoords internally.
+// Fetches weather data from Open-Meteo (geocoding + forecast) and updates
+// app.weather, notifying the changed fields.  Calls detectTimezoneFromCoords internally.
 void fetchWeatherData();
@@ -1,8 +1,15 @@
 #include "clock_face.h"
+#include "compositor.h"
+#include "digit_atlas.h"
+#include "dma_push.h"
+#include "gfx_stats.h"
 #include "theme.h"
 #include "icons.h"
 
 #include <TFT_eSPI.h>
+#include <WiFi.h>
+#include <esp_heap_caps.h>
+#include <sys/time.h>
 #include <time.h>
 
 #include "../data/app_state.h"
@@ -10,12 +17,13 @@
 #include "../net/holidays.h"
 #include "../util/moon.h"
 #include "../util/constants.h"
+#include "../util/trig.h"
 #include "../net/weather_api.h"
 
 // ---------------------------------------------------------------------------
 // Externs – defined in main.cpp
 // ---------------------------------------------------------------------------
-extern TFT_eSPI tft;
+extern DisplayTFT tft;
 
 // Clock layout
 extern const int clockX;
@@ -28,50 +36,71 @@ extern bool      forceClockRedraw;
 
 // Display/format state
 extern bool isDigitalClock;
+extern bool sweepMode;
 extern bool is12hFormat;
-extern bool isWhiteTheme;
-extern int  themeMode;
 
 // City/region
 extern String cityName;
 extern String selectedCountry;
 
-// Weather data
-extern bool  initialWeatherFetched;
-extern int   weatherCode;
-extern float currentTemp;
-extern int   currentHumidity;
-extern float currentWindSpeed;
-extern int   currentWindDirection;
-extern int   currentPressure;
-extern bool  weatherUnitF;
-extern bool  weatherUnitMph;
-extern bool  weatherUnitInHg;
-extern String sunriseTime;
-extern String sunsetTime;
-extern ForecastData forecast[ 2 ];
-extern String forecastDay1Name;
-extern String forecastDay2Name;
+// Weather, units, holiday and nameday are in AppState (data/app_state.h)
 extern int    moonPhaseVal;
+extern ScreenState currentState;
+
+// OTA
+extern bool updateAvailable;
 
 // Bitmap icons (defined in main.cpp)
 extern const unsigned char icon_sunrise[];
 extern const unsigned char icon_sunset[];
 
-// DEGTORAD
-static constexpr float DEGTORAD_CF = ( float )( PI / 180.0 );
-
 // ---------------------------------------------------------------------------
 // Clock-face sprite  — 140×140 px, rendered off-screen then pushed atomically
 // so no intermediate state (tick erase → ticks redraw → hand redraw) is visible.
+// Pushes go out by DMA (dma_push.h); the next frame renders while it transfers.
+//
+// In tick mode the sprite is 4 bpp (9.8 KB instead of 39 KB): the dial only
+// uses the CLK_* palette entries, expanded to RGB565 during the push, with
+// entry 0 following the gradient background row by row. Sweep mode draws
+// anti-aliased hands, which need true colour, so there it stays 16 bpp. Both
+// sprites are freed while the analog clock is not on screen.
 // ---------------------------------------------------------------------------
-static TFT_eSprite clockSprite( &tft );
+enum ClockColor : uint8_t {
+    CLK_BG,         // Per row, from getBgColorAt()
+    CLK_FG,         // Border, numerals, hour / minute hands
+    CLK_TICK,       // Minute ticks
+    CLK_SEC,        // Second hand
+    CLK_HUB,        // Centre cap
+    CLK_COLORS
+};
+
+static DisplaySprite clockSprite( &tft );
 static bool        spriteCreated = false;
 static int         spriteX = 0, spriteY = 0;  // top-left of sprite on screen
 static int         sCX = 0,     sCY = 0;       // clock centre in sprite coords
 
+static void clockPalette( uint16_t *pal ) {
+    pal[ CLK_BG ]   = getBgColorAt( spriteY );
+    pal[ CLK_FG ]   = getTextColor();
+    pal[ CLK_TICK ] = theme().tick;
+    pal[ CLK_SEC ]  = getSecHandColor();
+    pal[ CLK_HUB ]  = TFT_LIGHTGREY;
+}
+
+// Colour argument for spr: the palette index at 4 bpp, the colour itself at 16
+static inline uint16_t clockInk( TFT_eSprite &spr, ClockColor index, uint16_t color ) {
+    return spr.getColorDepth() == 4 ? ( uint16_t )index : color;
+}
+
+static void logClockHeap( [[maybe_unused]] const char *what ) {
+    log_i( "[CLOCK] Sprites %s: clock %d bpp, free heap %u, low-water %u", what, clockSprite.getColorDepth(),
+           ( unsigned )heap_caps_get_free_size( MALLOC_CAP_8BIT ),
+           ( unsigned )heap_caps_get_minimum_free_size( MALLOC_CAP_8BIT ) );
+}
+
 static void createClockSprite() {
-    if ( spriteCreated ) {
+    int depth = sweepMode ? 16 : 4;
+    if ( spriteCreated && clockSprite.getColorDepth() == depth ) {
         return;
     }
     int sz  = ( radius + 3 ) * 2;          // e.g. 140 for radius=67
@@ -79,9 +108,147 @@ static void createClockSprite() {
     spriteY = clockY - ( radius + 3 );     // 15
     sCX     = radius + 3;                  // 70  (centre inside sprite)
     sCY     = radius + 3;                  // 70
-    clockSprite.setColorDepth( 16 );
+    clockSprite.deleteSprite();            // Tick ↔ sweep switch changes the depth
+    clockSprite.setColorDepth( depth );
     clockSprite.createSprite( sz, sz );
-    spriteCreated = true;
+    spriteCreated    = true;
+    forceClockRedraw = true;
+    logClockHeap( "created" );
+}
+
+// ---------------------------------------------------------------------------
+// Dial cache — border, ticks and numerals rendered once into a second sprite
+// of the same size. Each tick copies it into clockSprite and draws only the
+// hands. The cache is always 4 bpp and holds palette indices, so theme and
+// background changes only change the palette; it is rebuilt when the radius
+// changes. A 16-bit clockSprite (sweep) gets it expanded on the copy.
+// ---------------------------------------------------------------------------
+static DisplaySprite dialSprite( &tft );
+static bool        dialValid = false;     // false → rebuild (or cache unavailable)
+static bool        dialFailed = false;    // allocation failed once; draw the dial each tick
+static int         dialRadius = 0;
+
+// Renders the static part of the analog dial into spr (same geometry as clockSprite)
+static void drawDial( TFT_eSprite &spr ) {
+    uint16_t fgColor = clockInk( spr, CLK_FG, getTextColor() );
+
+    if ( spr.getColorDepth() == 4 ) {
+        spr.fillSprite( CLK_BG );
+    }
+    else {
+        fillSpriteBackground( spr, spriteY );  // Gradient rows behind the dial
+    }
+
+    // Outer border circle
+    spr.drawCircle( sCX, sCY, radius + 2, fgColor );
+
+    // Tick marks
+    uint16_t tickColor = clockInk( spr, CLK_TICK, theme().tick );
+    for ( int i = 0; i < 60; i++ ) {
+        int32_t  ang   = ( i * 6 - 90 ) * TRIG_DIV;
+        int      r1    = ( i % 5 == 0 ) ? ( radius - 10 ) : ( radius - 5 );
+        uint16_t tkcol = ( i % 5 == 0 ) ? fgColor : tickColor;
+        spr.drawLine( polarX( sCX, radius, ang ), polarY( sCY, radius, ang ),
+                      polarX( sCX, r1, ang ),     polarY( sCY, r1, ang ),
+                      tkcol );
+    }
+
+    // Hour numerals
+    spr.setFreeFont( &FreeSans9pt7b );
+    spr.setTextDatum( MC_DATUM );
+    spr.setTextColor( fgColor );
+    for ( int n = 1; n <= 12; n++ ) {
+        int32_t ang = ( n * 30 - 90 ) * TRIG_DIV;
+        spr.drawString( String( n ), polarX( sCX, radius - 22, ang ), polarY( sCY, radius - 22, ang ) );
+    }
+    spr.setFreeFont( NULL );
+}
+
+// Makes sure dialSprite holds the dial, rebuilding it if the radius changed.
+// Returns false if no cache is available.
+static bool ensureDialCache() {
+    if ( dialValid && dialRadius != radius ) {
+        dialValid = false;
+    }
+
+    if ( !dialValid && !dialFailed ) {
+        if ( !dialSprite.created() ) {
+            dialSprite.setColorDepth( 4 );
+            if ( dialSprite.createSprite( clockSprite.width(), clockSprite.height() ) == nullptr ) {
+                log_w( "[CLOCK] Dial cache allocation failed — drawing dial every tick" );
+                dialFailed = true;
+            }
+        }
+        if ( !dialFailed ) {
+            [[maybe_unused]] uint32_t t0 = micros();   // Log only
+            drawDial( dialSprite );
+            dialRadius = radius;
+            dialValid  = true;
+            log_i( "[CLOCK] Dial cache rebuilt in %lu us", ( unsigned long )( micros() - t0 ) );
+        }
+    }
+    return dialValid;
+}
+
+// Copies one rectangle (sprite coords) of the cached dial into clockSprite:
+// whole rows at 4 bpp, expanded through the palette at 16 bpp
+static void restoreDialRect( const Rect &r ) {
+    const uint8_t *src    = ( const uint8_t * )dialSprite.getPointer();
+    int            stride = ( dialSprite.width() + 1 ) / 2;
+    if ( clockSprite.getColorDepth() == 4 ) {
+        memcpy( ( uint8_t * )clockSprite.getPointer() + r.y * stride, src + r.y * stride, ( size_t )r.h * stride );
+        return;
+    }
+
+    uint16_t pal[ CLK_COLORS ];
+    clockPalette( pal );
+    for ( int i = 0; i < CLK_COLORS; i++ ) {
+        pal[ i ] = ( uint16_t )( ( pal[ i ] >> 8 ) | ( pal[ i ] << 8 ) );  // Sprite byte order
+    }
+    int       w   = clockSprite.width();
+    uint16_t *dst = ( uint16_t * )clockSprite.getPointer();
+    for ( int row = r.y; row < r.y + r.h; row++ ) {
+        uint16_t bg = getBgColorAt( spriteY + row );
+        pal[ CLK_BG ] = ( uint16_t )( ( bg >> 8 ) | ( bg << 8 ) );
+        const uint8_t *line = src + row * stride;
+        for ( int x = r.x; x < r.x + r.w; x++ ) {
+            uint8_t idx = ( x & 1 ) ? ( line[ x >> 1 ] & 0x0F ) : ( line[ x >> 1 ] >> 4 );
+            dst[ row * w + x ] = pal[ idx < CLK_COLORS ? idx : ( uint8_t )CLK_BG ];
+        }
+    }
+}
+
+// Copies the cached dial into clockSprite (or draws it directly without a cache)
+static void renderDialBackground() {
+    if ( ensureDialCache() ) {
+        restoreDialRect( { 0, 0, ( int16_t )clockSprite.width(), ( int16_t )clockSprite.height() } );
+    }
+    else {
+        drawDial( clockSprite );
+    }
+}
+
+// Sets the 4-bit clockSprite palette from the theme and pushes a rectangle of it
+static void pushClockRect( int x, int y, int w, int h ) {
+    if ( clockSprite.getColorDepth() == 4 ) {
+        uint16_t pal[ CLK_COLORS ];
+        clockPalette( pal );
+        clockSprite.createPalette( pal, CLK_COLORS );
+    }
+    dmaPushSprite( clockSprite, x, y, w, h, spriteX + x, spriteY + y, getBgColorAt );
+    compositorCountPixels( ( uint32_t )w * h );
+}
+
+void releaseClockSprites() {
+    if ( !spriteCreated && !dialSprite.created() ) {
+        return;
+    }
+    clockSprite.deleteSprite();     // DMA reads the staging buffers, never the sprite
+    dialSprite.deleteSprite();
+    spriteCreated = false;
+    dialValid     = false;
+    dialFailed    = false;
+    logClockHeap( "freed" );
 }
 
 void drawClockStatic() {
@@ -91,16 +258,16 @@ void drawClockStatic() {
 
     // Draw minute and hour tick marks
     for ( int i = 0; i < 60; i++ ) {
-        float ang = ( i * 6 - 90 ) * DEGTORAD_CF;
+        int32_t ang = ( i * 6 - 90 ) * TRIG_DIV;
         int r1 = ( i % 5 == 0 ) ? ( radius - 10 ) : ( radius - 5 );
         uint16_t color;
         if ( i % 5 == 0 ) {
             color = getTextColor();
         }
         else {
-            color = ( themeMode == THEME_YELLOW ) ? 0x0010 : TFT_DARKGREY;
+            color = theme().tick;
         }
-        tft.drawLine( clockX + cos( ang ) * radius, clockY + sin( ang ) * radius, clockX + cos( ang ) * r1, clockY + sin( ang ) * r1, color );
+        tft.drawLine( polarX( clockX, radius, ang ), polarY( clockY, radius, ang ), polarX( clockX, r1, ang ), polarY( clockY, r1, ang ), color );
     }
 
     // Draw numbers 1-12
@@ -109,15 +276,16 @@ void drawClockStatic() {
     tft.setFreeFont( &FreeSans9pt7b );
 
     for ( int h = 1; h <= 12; h++ ) {
-        float angle = ( h * 30 - 90 ) * DEGTORAD_CF;
-        int x = clockX + cos( angle ) * ( radius - 22 );
-        int y = clockY + sin( angle ) * ( radius - 22 );
+        int32_t angle = ( h * 30 - 90 ) * TRIG_DIV;
+        int x = polarX( clockX, radius - 22, angle );
+        int y = polarY( clockY, radius - 22, angle );
         tft.drawString( String( h ), x, y );
     }
 }
 
 void drawClockFace() {
-    tft.fillScreen( getBgColor() );
+    GFX_SCOPE( "clock-bg" );
+    fillBackground( 0, 0, 320, 240 );
     if ( !isDigitalClock ) {
         createClockSprite();   // allocate sprite (no-op if already done)
         tft.drawCircle( clockX, clockY, radius + 2, getTextColor() );
@@ -126,81 +294,111 @@ void drawClockFace() {
     forceClockRedraw = true;
 }
 
-void drawDateAndWeek( const struct tm *ti ) {
-    uint16_t dateColor = getTextColor();
-    if ( themeMode == THEME_YELLOW ) {
-        dateColor = TFT_BLACK;
+// ---------------------------------------------------------------------------
+// Date block — right column below the clock. One compositor widget per text
+// line so a holiday fetch or city change repaints a single 165×18 strip
+// instead of the whole 165×80 block.
+// ---------------------------------------------------------------------------
+static int wDate    = -1;
+static int wWeek    = -1;
+static int wCity    = -1;
+static int wHoliday = -1;
+
+static String   dateLine;
+static String   weekLine;
+static String   cityLine;
+static String   holidayLine;
+static uint16_t holidayLineColor = TFT_RED;
+
+static uint16_t dateTextColor() {
+    return theme().dateText;
+}
+
+static void drawDateLine() {
+    tft.setFreeFont( NULL );
+    tft.setTextDatum( MC_DATUM );
+    tft.setTextColor( dateTextColor() );
+    tft.drawString( dateLine, clockX, 175, 2 );
+}
+
+static void drawWeekLine() {
+    tft.setFreeFont( NULL );
+    tft.setTextDatum( MC_DATUM );
+    tft.setTextColor( dateTextColor() );
+    tft.drawString( weekLine, clockX, 193, 2 );
+}
+
+static void drawCityLine() {
+    if ( cityLine == "" ) {
+        return;
     }
+    tft.setFreeFont( NULL );
+    tft.setTextDatum( MC_DATUM );
+    tft.setTextColor( theme().cityText );
+    tft.drawString( cityLine, clockX, 211, 2 );
+}
 
+static void drawHolidayLine() {
+    if ( holidayLine == "" ) {
+        return;
+    }
     tft.setFreeFont( NULL );
-    tft.setTextColor( dateColor, getBgColor() );
     tft.setTextDatum( MC_DATUM );
+    tft.setTextColor( holidayLineColor );
+    tft.drawString( holidayLine, clockX, 227, 1 );
+}
+
+// Invalidates a widget when the text (or input key) it shows has changed.
+static void setWidgetText( int id, String &cached, const String &text ) {
+    if ( text != cached ) {
+        cached = text;
+        compositorInvalidate( id );
+    }
+}
 
-    tft.fillRect( 155, 160, 165, 80, getBgColor() );
+// Holiday line takes priority; nameday shown only for Czech Republic when no holiday
+static void updateHolidayLine() {
+    String   line  = "";
+    uint16_t color = holidayLineColor;
+    if ( app.holiday.valid && app.holiday.name.length() > 0 ) {
+        line  = app.holiday.name;
+        color = theme().holiday;
+    }
+    else if ( app.nameday.valid && selectedCountry == "Czech Republic" ) {
+        line  = "Nameday: " + app.nameday.name;
+        color = theme().nameday;
+    }
+    if ( color != holidayLineColor ) {
+        holidayLineColor = color;
+        compositorInvalidate( wHoliday );
+    }
+    setWidgetText( wHoliday, holidayLine, line );
+}
 
+void updateDateWidgets( const struct tm *ti ) {
     char dateBuf[ 30 ];
     strftime( dateBuf, sizeof( dateBuf ), "%B %d, %Y", ti );
-    tft.drawString( String( dateBuf ), clockX, 175, 2 );
+    setWidgetText( wDate, dateLine, String( dateBuf ) );
 
-    int weekNum = 0;
     char weekBuf[ 20 ];
     strftime( weekBuf, sizeof( weekBuf ), "%V", ti );
-    weekNum = atoi( weekBuf );
+    int weekNum = atoi( weekBuf );
 
     const char *dayNames[] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
-    String dayStr = String( dayNames[ ti->tm_wday ] );
-    String weekStr = "Week " + String( weekNum ) + ", " + dayStr;
-    tft.drawString( weekStr, clockX, 193, 2 );
-
-    if ( cityName != "" ) {
-        if ( themeMode == THEME_YELLOW ) {
-            tft.setTextColor( 0x0220, getBgColor() ); // Dark green
-        }
-        else {
-            tft.setTextColor( TFT_SKYBLUE, getBgColor() );
-        }
-        tft.drawString( cityName, clockX, 211, 2 );
-    }
+    setWidgetText( wWeek, weekLine, "Week " + String( weekNum ) + ", " + String( dayNames[ ti->tm_wday ] ) );
 
-    // Holiday line takes priority; nameday shown only for Czech Republic when no holiday
-    if ( holidayValid && todayHoliday.length() > 0 ) {
-        uint16_t holidayColor;
-        if ( themeMode == THEME_YELLOW ) {
-            holidayColor = 0x0220;                                  // dark green on yellow bg
-        }
-        else {
-            holidayColor = isWhiteTheme ? TFT_DARKGREEN : TFT_RED;  // red on dark themes
-        }
-        tft.setTextColor( holidayColor, getBgColor() );
-        tft.drawString( todayHoliday, clockX, 227, 1 );
-    }
-    else if ( namedayValid && todayNameday != "--" && selectedCountry == "Czech Republic" ) {
-        uint16_t namedayColor;
-        if ( themeMode == THEME_YELLOW ) {
-            namedayColor = 0x0220;
-        }
-        else {
-            namedayColor = isWhiteTheme ? TFT_DARKGREEN : TFT_ORANGE;
-        }
-        tft.setTextColor( namedayColor, getBgColor() );
-        tft.drawString( "Nameday: " + todayNameday, clockX, 227, 1 );
-    }
-    else {
-        // Clear the line if neither applies (e.g. country changed)
-        tft.fillRect( 155, 220, 165, 17, getBgColor() );
-    }
+    setWidgetText( wCity, cityLine, cityName );
+    updateHolidayLine();    // Also on APP_HOLIDAY / APP_NAMEDAY; here for country and theme changes
 }
 
-void drawDigitalClock( int h, int m, int s ) {
-    uint16_t clockColor = getTextColor();
-    uint16_t bgColor = getBgColor();
+// Seconds are rendered off-screen over the row gradient and pushed in one write,
+// so the digits change in place without a flat box or an erase flash.
+static DisplaySprite secSprite( &tft );
+static bool        secSpriteFailed = false;
 
-    if ( themeMode == THEME_BLUE ) {
-        clockColor = TFT_WHITE;
-    }
-    if ( themeMode == THEME_YELLOW ) {
-        clockColor = TFT_BLACK;
-    }
+void drawDigitalClock( int h, int m, int s ) {
+    GFX_SCOPE( "clock-digital" );
+    uint16_t clockColor = theme().digits;
 
     int displayH = h;
     bool isPM = false;
@@ -227,31 +425,65 @@ void drawDigitalClock( int h, int m, int s ) {
         sprintf( timeStr, "%02d:%02d", displayH, m ); // leading zero in 24h
     }
 
-    // Compute font 7 metrics once — used for layout of all elements below.
-    int fh7      = tft.fontHeight( 7 );
-    int maxTimeW = tft.textWidth( "12:59", 7 );
-
-    tft.setTextDatum( MC_DATUM );
-    tft.setTextColor( clockColor, bgColor );
+    // Font 7 metrics, measured once — used for layout of all elements below.
+    static int fh7      = 0;
+    static int maxTimeW = 0;
+    bool       atlasOk  = digitAtlasReady();
+    if ( fh7 == 0 ) {
+        fh7      = atlasOk ? digitAtlasHeight() : tft.fontHeight( 7 );
+        maxTimeW = atlasOk ? digitAtlasTextWidth( "12:59" ) : tft.textWidth( "12:59", 7 );
+    }
 
-    // Redraw HH:MM only when the string changes (or a full redraw is forced).
-    // This avoids clearing + redrawing the main time every second, which causes flicker.
+    // HH:MM is touched only when the string changes (or a full redraw is forced).
+    // With the glyph atlas, changed digits animate cell by cell (digitsAnimate()
+    // runs from the loop); a new string length relays the whole line out.
     static char prevTimeStr[ 6 ] = "";
-    if ( forceClockRedraw || strcmp( timeStr, prevTimeStr ) != 0 ) {
-        tft.fillRect( clockX - maxTimeW / 2, clockY - fh7 / 2, maxTimeW, fh7, bgColor );
-        tft.drawString( timeStr, clockX, clockY, 7 );
+    bool        relayout         = forceClockRedraw || strlen( timeStr ) != strlen( prevTimeStr );
+    if ( relayout || strcmp( timeStr, prevTimeStr ) != 0 ) {
+        if ( atlasOk && !relayout ) {
+            digitsUpdate( timeStr, clockColor );
+        }
+        else {
+            fillBackground( clockX - maxTimeW / 2, clockY - fh7 / 2, maxTimeW, fh7 );
+            if ( atlasOk ) {
+                digitsDrawAll( timeStr, clockX, clockY, clockColor );
+            }
+            else {
+                tft.setTextDatum( MC_DATUM );
+                tft.setTextColor( clockColor );
+                tft.drawString( timeStr, clockX, clockY, 7 );
+            }
+        }
         strncpy( prevTimeStr, timeStr, sizeof( prevTimeStr ) );
     }
+    dmaSync();      // Atlas cells may still be in flight; the lines below draw to tft directly
 
-    // Seconds in font 4 (26 px). Use per-glyph bg fill (setTextColor with bg colour) so
-    // the old glyph pixels are overwritten in-place — no separate fillRect needed, no flash.
-    // SS is always exactly 2 digits so width never changes.
+    // Seconds in font 4 (26 px). SS is always exactly 2 digits so width never changes.
     // clockY + 45 keeps a safe gap below HH:MM without overlapping it.
     int secY = clockY + 45;
     char secStr[ 3 ];
     sprintf( secStr, "%02d", s );
-    tft.setTextColor( getSecHandColor(), bgColor );
-    tft.drawString( secStr, clockX, secY, 4 );
+    if ( !secSprite.created() && !secSpriteFailed ) {
+        secSprite.setColorDepth( 16 );
+        if ( secSprite.createSprite( tft.textWidth( "88", 4 ) + 4, tft.fontHeight( 4 ) ) == nullptr ) {
+            log_w( "[CLOCK] Seconds sprite allocation failed — drawing direct" );
+            secSpriteFailed = true;
+        }
+    }
+    if ( secSprite.created() ) {
+        int sx = clockX - secSprite.width() / 2;
+        int sy = secY - secSprite.height() / 2;
+        fillSpriteBackground( secSprite, sy );
+        secSprite.setTextDatum( MC_DATUM );
+        secSprite.setTextColor( getSecHandColor() );
+        secSprite.drawString( secStr, secSprite.width() / 2, secSprite.height() / 2, 4 );
+        secSprite.pushSprite( sx, sy );
+    }
+    else {
+        // Per-glyph bg fill overwrites the old digits in place (flat colour of the row)
+        tft.setTextColor( getSecHandColor(), getBgColorAt( secY ) );
+        tft.drawString( secStr, clockX, secY, 4 );
+    }
 
     // AM/PM indicator — only in 12h mode.
     // Fixed X: 4 px to the right of the widest time string ("12:59"), so the dot never
@@ -266,8 +498,8 @@ void drawDigitalClock( int h, int m, int s ) {
     const int pmY   = clockY + fh7 / 2 - circR;
     static bool prevIsPM = !isPM;  // initialise to opposite so first call always draws
     if ( forceClockRedraw || isPM != prevIsPM ) {
-        tft.fillCircle( circX, amY, circR, bgColor );
-        tft.fillCircle( circX, pmY, circR, bgColor );
+        fillBackground( circX - circR, amY - circR, 2 * circR + 1, 2 * circR + 1 );
+        fillBackground( circX - circR, pmY - circR, 2 * circR + 1, 2 * circR + 1 );
         if ( is12hFormat ) {
             tft.fillCircle( circX, isPM ? pmY : amY, circR, TFT_ORANGE );
         }
@@ -278,103 +510,253 @@ void drawDigitalClock( int h, int m, int s ) {
 }
 
 void updateHands( int h, int m, int s ) {
+    GFX_SCOPE( "clock-analog" );
     if ( isDigitalClock ) {
+        releaseClockSprites();
+        dmaSync();          // Digital clock draws straight to tft
         drawDigitalClock( h, m, s );
         return;
     }
 
     createClockSprite();   // no-op after first call; safe even if drawClockFace() skipped
 
-    uint16_t bgColor       = getBgColor();
+    uint16_t mainHandColor = clockInk( clockSprite, CLK_FG, getTextColor() );
+    uint16_t secColor      = clockInk( clockSprite, CLK_SEC, getSecHandColor() );
+
+    uint32_t renderStart = micros();
+
+    // ── Cached dial + hands rendered into sprite, then pushed in one write (no flicker) ──
+    renderDialBackground();
+
+    // Hands (deci-degrees; hour hand advances 0.5° per minute)
+    int32_t hA = ( ( h % 12 ) * 30 - 90 ) * TRIG_DIV + m * ( TRIG_DIV / 2 );
+    int32_t mA = ( m * 6 - 90 ) * TRIG_DIV;
+    int32_t sA = ( s * 6 - 90 ) * TRIG_DIV;
+
+    int hx = polarX( sCX, radius - 35, hA );
+    int hy = polarY( sCY, radius - 35, hA );
+    int mx = polarX( sCX, radius - 20, mA );
+    int my = polarY( sCY, radius - 20, mA );
+    int sx = polarX( sCX, radius - 14, sA );
+    int sy = polarY( sCY, radius - 14, sA );
+
+    clockSprite.drawLine( sCX, sCY, hx, hy, mainHandColor );
+    clockSprite.drawLine( sCX, sCY, mx, my, mainHandColor );
+    clockSprite.drawLine( sCX, sCY, sx, sy, secColor );
+    clockSprite.fillCircle( sCX, sCY, 3, clockInk( clockSprite, CLK_HUB, TFT_LIGHTGREY ) );
+
+    // Per-tick render time (dial copy + hands, excluding SPI), averaged per minute
+    static uint32_t renderSum = 0, renderMax = 0, renderCount = 0;
+    uint32_t renderUs = micros() - renderStart;
+    renderSum += renderUs;
+    renderMax  = max( renderMax, renderUs );
+    if ( ++renderCount == 60 ) {
+        log_d( "[CLOCK] Dial render avg %lu us, max %lu us (cache %s)",
+               ( unsigned long )( renderSum / renderCount ), ( unsigned long )renderMax,
+               dialValid ? "on" : "off" );
+        renderSum = renderMax = renderCount = 0;
+    }
+
+    // Push only the damaged part of the sprite: bounding box of the hands drawn
+    // now united with the hands drawn last time (which must be erased). The
+    // rest of the dial is unchanged on screen. A forced redraw pushes it all.
+    Rect hands = {
+        ( int16_t )( min( min( sCX - 3, hx ), min( mx, sx ) ) ),
+        ( int16_t )( min( min( sCY - 3, hy ), min( my, sy ) ) ),
+        0, 0
+    };
+    hands.w = max( max( sCX + 3, hx ), max( mx, sx ) ) - hands.x + 1;
+    hands.h = max( max( sCY + 3, hy ), max( my, sy ) ) - hands.y + 1;
+
+    static Rect prevHands = { 0, 0, 0, 0 };
+    if ( forceClockRedraw || prevHands.w == 0 ) {
+        // Whole sprite, no intermediate state on screen
+        pushClockRect( 0, 0, clockSprite.width(), clockSprite.height() );
+        forceClockRedraw = false;
+    }
+    else {
+        Rect d = rectUnion( hands, prevHands );
+        pushClockRect( d.x, d.y, d.w, d.h );
+    }
+    prevHands = hands;
+}
+
+// ---------------------------------------------------------------------------
+// Sweep mode — the second hand moves continuously (driven at SWEEP_FRAME_MS
+// from loop()). Hands are anti-aliased wedges. Each frame restores only the
+// rectangles the moving hands touched from the dial cache, redraws the hands
+// clipped to those rectangles and pushes just them.
+// ---------------------------------------------------------------------------
+struct WedgeHand {
+    float    ax, ay;    // Base (tail end)
+    float    bx, by;    // Tip
+    float    ar, br;    // Base / tip half-widths
+    uint16_t color;
+};
+
+static WedgeHand makeHand( int32_t ang, int len, int tail, float ar, float br, uint16_t color ) {
+    float c = icos( ang ) / ( float )Q15_ONE;
+    float s = isin( ang ) / ( float )Q15_ONE;
+    return { sCX - c * tail, sCY - s * tail, sCX + c * len, sCY + s * len, ar, br, color };
+}
+
+// Sprite-space bounds of a hand including its anti-aliased fringe
+static Rect handBounds( const WedgeHand &hd ) {
+    float m  = max( hd.ar, hd.br ) + 2.0f;
+    int   x0 = ( int )floorf( min( hd.ax, hd.bx ) - m );
+    int   y0 = ( int )floorf( min( hd.ay, hd.by ) - m );
+    int   x1 = ( int )ceilf( max( hd.ax, hd.bx ) + m );
+    int   y1 = ( int )ceilf( max( hd.ay, hd.by ) + m );
+    x0 = max( x0, 0 );
+    y0 = max( y0, 0 );
+    x1 = min( x1, ( int )clockSprite.width() );
+    y1 = min( y1, ( int )clockSprite.height() );
+    return { ( int16_t )x0, ( int16_t )y0, ( int16_t )( x1 - x0 ), ( int16_t )( y1 - y0 ) };
+}
+
+static void drawSweepHands( const WedgeHand *hands, int count ) {
+    for ( int i = 0; i < count; i++ ) {
+        clockSprite.drawWedgeLine( hands[ i ].ax, hands[ i ].ay, hands[ i ].bx, hands[ i ].by,
+                                   hands[ i ].ar, hands[ i ].br, hands[ i ].color );
+    }
+    clockSprite.fillSmoothCircle( sCX, sCY, 3, TFT_LIGHTGREY );
+}
+
+void updateHandsSweep( const struct timeval &tv ) {
+    GFX_SCOPE( "clock-sweep" );
+    if ( isDigitalClock ) {
+        return;
+    }
+    createClockSprite();
+
+    struct tm lt;
+    localtime_r( &tv.tv_sec, &lt );
+
+    uint32_t frameStart = micros();
+
     uint16_t mainHandColor = getTextColor();
     uint16_t secColor      = getSecHandColor();
 
-    // ── Render full clock face into sprite then push in one write (no flicker) ──
-    clockSprite.fillSprite( bgColor );
-
-    // Outer border circle
-    clockSprite.drawCircle( sCX, sCY, radius + 2, mainHandColor );
+    // Angles in deci-degrees with sub-second precision. The minute hand moves
+    // 0.1° per second and the hour hand 0.1° every 12 s, so they rarely need repainting.
+    int32_t secMs = lt.tm_sec * 1000 + tv.tv_usec / 1000;
+    int32_t sA    = secMs * 3 / 50 - 900;
+    int32_t mA    = lt.tm_min * 60 + secMs / 1000 - 900;
+    int32_t hA    = ( lt.tm_hour % 12 ) * 300 + lt.tm_min * 5 + secMs / 12000 - 900;
+
+    WedgeHand hands[ 3 ] = {
+        makeHand( hA, radius - 35, 0,  3.0f, 1.2f, mainHandColor ),
+        makeHand( mA, radius - 20, 0,  2.2f, 0.8f, mainHandColor ),
+        makeHand( sA, radius - 14, 12, 1.2f, 0.5f, secColor )
+    };
+    int32_t     angles[ 3 ] = { hA, mA, sA };
+    const Rect  hub         = { ( int16_t )( sCX - 5 ), ( int16_t )( sCY - 5 ), 11, 11 };
+
+    static Rect    prevBox[ 3 ];
+    static int32_t prevAngle[ 3 ];
+
+    bool cached = ensureDialCache();
+    bool full   = forceClockRedraw || !cached || prevBox[ 2 ].w == 0;
+
+    if ( full ) {
+        renderDialBackground();
+        drawSweepHands( hands, 3 );
+        pushClockRect( 0, 0, clockSprite.width(), clockSprite.height() );
+        forceClockRedraw = false;
+    }
+    else {
+        // Damage: old ∪ new bounds of every hand that moved, merged when overlapping
+        Rect damage[ 3 ];
+        int  n = 0;
+        for ( int i = 0; i < 3; i++ ) {
+            if ( angles[ i ] == prevAngle[ i ] ) {
+                continue;
+            }
+            Rect r = rectUnion( rectUnion( prevBox[ i ], handBounds( hands[ i ] ) ), hub );
+            bool merged = false;
+            for ( int j = 0; j < n && !merged; j++ ) {
+                if ( rectsIntersect( damage[ j ], r ) ) {
+                    damage[ j ] = rectUnion( damage[ j ], r );
+                    merged = true;
+                }
+            }
+            if ( !merged ) {
+                damage[ n++ ] = r;
+            }
+        }
 
-    // Tick marks
-    for ( int i = 0; i < 60; i++ ) {
-        float    ang   = ( i * 6 - 90 ) * DEGTORAD_CF;
-        int      r1    = ( i % 5 == 0 ) ? ( radius - 10 ) : ( radius - 5 );
-        uint16_t tkcol = ( i % 5 == 0 )
-                         ? mainHandColor
-                         : ( ( themeMode == THEME_YELLOW ) ? ( uint16_t )0x0010 : ( uint16_t )TFT_DARKGREY );
-        clockSprite.drawLine(
-            sCX + ( int )( cos( ang ) * radius ), sCY + ( int )( sin( ang ) * radius ),
-            sCX + ( int )( cos( ang ) * r1     ), sCY + ( int )( sin( ang ) * r1     ),
-            tkcol );
+        for ( int j = 0; j < n; j++ ) {
+            const Rect &r = damage[ j ];
+            restoreDialRect( r );
+            clockSprite.setViewport( r.x, r.y, r.w, r.h, false );
+            drawSweepHands( hands, 3 );
+            clockSprite.resetViewport();
+            pushClockRect( r.x, r.y, r.w, r.h );
+        }
     }
 
-    // Hour numerals
-    clockSprite.setFreeFont( &FreeSans9pt7b );
-    clockSprite.setTextDatum( MC_DATUM );
-    clockSprite.setTextColor( mainHandColor );
-    for ( int n = 1; n <= 12; n++ ) {
-        float ang = ( n * 30 - 90 ) * DEGTORAD_CF;
-        clockSprite.drawString( String( n ),
-                                sCX + ( int )( cos( ang ) * ( radius - 22 ) ),
-                                sCY + ( int )( sin( ang ) * ( radius - 22 ) ) );
-    }
-    clockSprite.setFreeFont( NULL );
-
-    // Hands
-    float hA = ( ( h % 12 ) + ( m / 60.0f ) ) * 30.0f - 90.0f;
-    float mA = m * 6.0f  - 90.0f;
-    float sA = s * 6.0f  - 90.0f;
-
-    clockSprite.drawLine( sCX, sCY,
-                          sCX + ( int )( cos( hA * DEGTORAD_CF ) * ( radius - 35 ) ),
-                          sCY + ( int )( sin( hA * DEGTORAD_CF ) * ( radius - 35 ) ),
-                          mainHandColor );
-    clockSprite.drawLine( sCX, sCY,
-                          sCX + ( int )( cos( mA * DEGTORAD_CF ) * ( radius - 20 ) ),
-                          sCY + ( int )( sin( mA * DEGTORAD_CF ) * ( radius - 20 ) ),
-                          mainHandColor );
-    clockSprite.drawLine( sCX, sCY,
-                          sCX + ( int )( cos( sA * DEGTORAD_CF ) * ( radius - 14 ) ),
-                          sCY + ( int )( sin( sA * DEGTORAD_CF ) * ( radius - 14 ) ),
-                          secColor );
-    clockSprite.fillCircle( sCX, sCY, 3, TFT_LIGHTGREY );
-
-    // Push sprite — single SPI burst, no intermediate state on screen
-    clockSprite.pushSprite( spriteX, spriteY );
-}
-
-void drawWeatherSection() {
-    uint16_t bg = getBgColor();
-    uint16_t txt = getTextColor();
-    uint16_t txtContrast = TFT_SKYBLUE;
+    for ( int i = 0; i < 3; i++ ) {
+        prevBox[ i ]   = handBounds( hands[ i ] );
+        prevAngle[ i ] = angles[ i ];
+    }
 
-    if ( themeMode == THEME_BLUE ) {
-        txtContrast = TFT_YELLOW;
+    // Frame rate and CPU share of the sweep renderer (render + SPI push), per minute
+    static uint32_t      frames = 0, busyUs = 0;
+    static unsigned long windowStart = 0;
+    busyUs += micros() - frameStart;
+    frames++;
+    unsigned long now = millis();
+    if ( windowStart == 0 ) {
+        windowStart = now;
     }
-    else if ( themeMode == THEME_YELLOW ) {
-        txtContrast = TFT_BLACK;
+    else if ( now - windowStart >= 60000UL ) {
+        [[maybe_unused]] unsigned long elapsed = now - windowStart;
+        log_i( "[CLOCK] Sweep %lu.%lu fps, %lu us/frame, CPU load %lu%%",
+               ( unsigned long )( frames * 1000UL / elapsed ), ( unsigned long )( frames * 10000UL / elapsed % 10 ),
+               ( unsigned long )( busyUs / frames ), ( unsigned long )( busyUs / ( elapsed * 10UL ) ) );
+        frames      = 0;
+        busyUs      = 0;
+        windowStart = now;
     }
+}
 
-    tft.fillRect( 0, 0, 155, 95, bg );
-    tft.fillRect( 0, 105, 155, 100, bg );
-    tft.fillRect( 0, 206, 155, 34, bg );
+// ---------------------------------------------------------------------------
+// Weather column — split into five widgets that each repaint only when the
+// values they display change (a 30-min refresh usually touches one or two).
+// ---------------------------------------------------------------------------
+static int wWxNow      = -1;
+static int wWxDetails  = -1;
+static int wWxSun      = -1;
+static int wWxForecast = -1;
+static int wWxMoon     = -1;
+
+static String keyWxMoon;
+static bool   moonValid = false;
+static int    moonBucket = 0;      // Continuous phase for the icon (moonCycleBucket)
+
+static uint16_t weatherContrastColor() {
+    return theme().weatherText;
+}
 
-    if ( !initialWeatherFetched ) {
-        tft.setTextColor( txt, bg );
-        tft.setTextDatum( MC_DATUM );
-        tft.drawString( "Loading...", 75, 120 );
+static float displayTemp( float c ) {
+    return app.units.tempF ? ( c * 9.0 / 5.0 + 32 ) : c;
+}
+
+// --- 1. Current temperature with icon ---
+static void drawWxNow() {
+    if ( !app.weather.fetched ) {
         return;
     }
+    const WeatherState &wx = app.weather;
+    uint16_t txtContrast = weatherContrastColor();
 
-    // --- 1. Current temperature with icon ---
-    drawWeatherIconVector( weatherCode, 5, 15 );
+    drawWeatherIconVector( wx.code, 5, 15 );
     tft.setTextDatum( TL_DATUM );
-    tft.setTextColor( txtContrast, bg );
+    tft.setTextColor( txtContrast );
     tft.setFreeFont( &FreeSansBold18pt7b );
 
-    float dispTemp = weatherUnitF ? ( currentTemp * 9.0 / 5.0 + 32 ) : currentTemp;
-    String unit = weatherUnitF ? "F" : "C";
-    String tempStr = String( ( int )dispTemp );
+    String unit = app.units.tempF ? "F" : "C";
+    String tempStr = String( ( int )displayTemp( wx.temp ) );
     tft.drawString( tempStr, 45, 15 );
 
     int tempWidth = tft.textWidth( tempStr );
@@ -382,111 +764,189 @@ void drawWeatherSection() {
     tft.drawString( unit, 45 + tempWidth + 12, 15 );
 
     tft.setFreeFont( &FreeSans9pt7b );
-    tft.setTextColor( txt, bg );
-    tft.drawString( getWeatherDesc( weatherCode ), 45, 48 );
+    tft.setTextColor( getTextColor() );
+    tft.drawString( getWeatherDesc( wx.code ), 45, 48 );
+    tft.setFreeFont( NULL );
+}
 
+// --- Humidity / pressure / wind ---
+static void drawWxDetails() {
+    if ( !app.weather.fetched ) {
+        return;
+    }
+    const WeatherState &wx = app.weather;
     tft.setFreeFont( NULL );
-    tft.setTextColor( txt, bg );
+    tft.setTextColor( getTextColor() );
     tft.setCursor( 5, 75 );
-    if ( weatherUnitInHg ) {
-        float pressInHg = currentPressure * 0.02953f;
-        tft.printf( "RH: %d%%  P: %.2f inHg", currentHumidity, pressInHg );
+    if ( app.units.pressureInHg ) {
+        float pressInHg = wx.pressure * 0.02953f;
+        tft.printf( "RH: %d%%  P: %.2f inHg", wx.humidity, pressInHg );
     }
     else {
-        tft.printf( "RH: %d%%  P: %d hPa", currentHumidity, currentPressure );
+        tft.printf( "RH: %d%%  P: %d hPa", wx.humidity, wx.pressure );
     }
 
     tft.setCursor( 5, 88 );
-    if ( weatherUnitMph ) {
-        float windMph = currentWindSpeed * 0.621371;
-        tft.printf( "Wind: %.1f mph %s", windMph, getWindDir( currentWindDirection ).c_str() );
+    if ( app.units.windMph ) {
+        float windMph = wx.windSpeed * 0.621371;
+        tft.printf( "Wind: %.1f mph %s", windMph, getWindDir( wx.windDir ).c_str() );
     }
     else {
-        tft.printf( "Wind: %.1f km/h %s", currentWindSpeed, getWindDir( currentWindDirection ).c_str() );
+        tft.printf( "Wind: %.1f km/h %s", wx.windSpeed, getWindDir( wx.windDir ).c_str() );
+    }
+}
+
+// --- Sunrise/Sunset ---
+static void drawWxSun() {
+    if ( !app.weather.fetched ) {
+        return;
     }
+    tft.setFreeFont( NULL );
 
-    // --- Sunrise/Sunset ---
     tft.drawBitmap( 5, 98, icon_sunrise, 16, 16, TFT_ORANGE );
     tft.setCursor( 24, 102 );
-    tft.setTextColor( TFT_ORANGE, bg );
-    tft.print( sunriseTime );
+    tft.setTextColor( TFT_ORANGE );
+    tft.print( app.weather.sunrise );
 
     tft.drawBitmap( 85, 101, icon_sunset, 16, 16, TFT_RED );
     tft.setCursor( 104, 102 );
-    tft.setTextColor( TFT_RED, bg );
-    tft.print( sunsetTime );
+    tft.setTextColor( TFT_RED );
+    tft.print( app.weather.sunset );
+}
 
-    tft.setTextColor( txt, bg );
-    tft.drawFastHLine( 5, 120, 145, TFT_DARKGREY );
+static void drawForecastDay( const ForecastData &day, const String &dayName, int dayY ) {
+    uint16_t txtContrast = weatherContrastColor();
+    const int dayX = 70;
 
-    // --- 2. Forecast ---
-    tft.setTextColor( txt, bg );
+    drawWeatherIconVectorSmall( day.code, 8, dayY );
+    tft.setTextDatum( ML_DATUM );
     tft.setFreeFont( NULL );
+    tft.setTextColor( getTextColor() );
+    tft.drawString( dayName, dayX, dayY );
+
+    tft.setTextColor( txtContrast );
+    String tempRange = String( ( int )displayTemp( day.tempMin ) ) + "/" + String( ( int )displayTemp( day.tempMax ) );
+    tft.drawString( tempRange, dayX, dayY + 13 );
+    int degreeX = dayX + tft.textWidth( tempRange ) + 3;
+    drawDegreeCircle( degreeX, dayY + 8, 1, txtContrast );
+    tft.drawString( app.units.tempF ? "F" : "C", degreeX + 4, dayY + 13 );
+}
+
+// --- 2. Forecast ---
+static void drawWxForecast() {
+    uint16_t txt = getTextColor();
+
+    tft.setFreeFont( NULL );
+    if ( !app.weather.fetched ) {
+        tft.setTextColor( txt );
+        tft.setTextDatum( MC_DATUM );
+        tft.drawString( "Loading...", 75, 130 );
+        return;
+    }
+
+    tft.drawFastHLine( 5, 120, 145, TFT_DARKGREY );
+
+    tft.setTextDatum( TL_DATUM );
+    tft.setTextColor( txt );
     tft.drawString( "Forecast:", 5, 128 );
 
-    drawWeatherIconVectorSmall( forecast[ 0 ].code, 8, 138 );
+    drawForecastDay( app.weather.forecast[ 0 ], app.weather.forecastDay[ 0 ], 138 );
+    drawForecastDay( app.weather.forecast[ 1 ], app.weather.forecastDay[ 1 ], 170 );
+
+    tft.drawFastHLine( 5, 200, 145, TFT_DARKGREY );
+}
+
+// --- 3. Moon phase ---
+static void drawWxMoon() {
+    if ( !app.weather.fetched || !moonValid ) {
+        return;
+    }
+    uint16_t txt = getTextColor();
+
     tft.setTextDatum( ML_DATUM );
+    tft.setTextColor( txt );
     tft.setFreeFont( NULL );
-    tft.setTextColor( txt, bg );
-    int day1x = 70;
-    int day1y = 138;
-    tft.drawString( forecastDay1Name, day1x, day1y );
-
-    tft.setTextColor( txtContrast, bg );
-    float fMin1 = weatherUnitF ? ( forecast[ 0 ].tempMin * 9.0 / 5.0 + 32 ) : forecast[ 0 ].tempMin;
-    float fMax1 = weatherUnitF ? ( forecast[ 0 ].tempMax * 9.0 / 5.0 + 32 ) : forecast[ 0 ].tempMax;
-    String tempMin1 = String( ( int )fMin1 );
-    String tempMax1 = String( ( int )fMax1 );
-    String tempRangeOnly1 = tempMin1 + "/" + tempMax1;
-    tft.drawString( tempRangeOnly1, day1x, day1y + 13 );
-    int tempWidth1 = tft.textWidth( tempRangeOnly1 );
-    int degreeX1 = day1x + tempWidth1 + 3;
-    int degreeY1 = day1y + 8;
-    drawDegreeCircle( degreeX1, degreeY1, 1, txtContrast );
-    tft.drawString( unit, degreeX1 + 4, day1y + 13 );
-
-    drawWeatherIconVectorSmall( forecast[ 1 ].code, 8, 170 );
-    tft.setTextColor( txt, bg );
-    int day2x = 70;
-    int day2y = 170;
-    tft.drawString( forecastDay2Name, day2x, day2y );
-
-    tft.setTextColor( txtContrast, bg );
-    float fMin2 = weatherUnitF ? ( forecast[ 1 ].tempMin * 9.0 / 5.0 + 32 ) : forecast[ 1 ].tempMin;
-    float fMax2 = weatherUnitF ? ( forecast[ 1 ].tempMax * 9.0 / 5.0 + 32 ) : forecast[ 1 ].tempMax;
-    String tempMin2 = String( ( int )fMin2 );
-    String tempMax2 = String( ( int )fMax2 );
-    String tempRangeOnly2 = tempMin2 + "/" + tempMax2;
-    tft.drawString( tempRangeOnly2, day2x, day2y + 13 );
-    int tempWidth2 = tft.textWidth( tempRangeOnly2 );
-    int degreeX2 = day2x + tempWidth2 + 3;
-    int degreeY2 = day2y + 8;
-    drawDegreeCircle( degreeX2, degreeY2, 1, txtContrast );
-    tft.drawString( unit, degreeX2 + 4, day2y + 13 );
-
-    tft.setTextColor( txt, bg );
-    tft.drawFastHLine( 5, 200, 145, TFT_DARKGREY );
+    tft.drawString( "Moon Phase:", 5, 210 );
 
-    // --- 3. Moon phase ---
+    const char *phaseNames[] = {"New Moon", "Waxing Crescent", "First Quarter", "Waxing Gibbous", "Full Moon", "Waning Gibbous", "Last Quarter", "Waning Crescent"};
+    if ( moonPhaseVal >= 0 && moonPhaseVal <= 7 ) {
+        tft.drawString( phaseNames[ moonPhaseVal ], 5, 222 );
+    }
+
+    drawMoonPhaseIcon( 120, 222, 13, moonBucket, txt );
+}
+
+void updateMoonWidget() {
     struct tm ti;
     if ( getLocalTime( &ti ) ) {
-        int phase = getMoonPhase( ti.tm_year + 1900, ti.tm_mon + 1, ti.tm_mday );
-        moonPhaseVal = phase;
+        moonPhaseVal = getMoonPhase( ti.tm_year + 1900, ti.tm_mon + 1, ti.tm_mday );
+        moonBucket   = moonCycleBucket( getMoonCycle( ti.tm_year + 1900, ti.tm_mon + 1, ti.tm_mday ) );
+        moonValid    = true;
+        log_d( "[MOON] Phase: %d | Date: %d-%d-%d", moonPhaseVal, ti.tm_year + 1900, ti.tm_mon + 1, ti.tm_mday );
+    }
+    setWidgetText( wWxMoon, keyWxMoon, String( moonValid ) + "|" + String( moonPhaseVal ) + "|" + String( moonBucket ) );
+}
 
-        tft.setTextColor( txt, bg );
-        tft.setFreeFont( NULL );
-        tft.drawString( "Moon Phase:", 5, 210 );
+// ---------------------------------------------------------------------------
+// Status icons — WiFi dot, OTA arrow and settings gear. Registered last so they
+// paint over any text line that shares a merged damage region.
+// ---------------------------------------------------------------------------
+static int  wWifi         = -1;
+static int  wUpdate       = -1;
+static int  lastWifiShown = -1;
+static bool lastUpdShown  = false;
 
-        String phaseNames[] = {"New Moon", "Waxing Crescent", "First Quarter", "Waxing Gibbous", "Full Moon", "Waning Gibbous", "Last Quarter", "Waning Crescent"};
-        if ( phase >= 0 && phase <= 7 ) {
-            tft.drawString( phaseNames[ phase ], 5, 222 );
-        }
+static void drawSettingsWidget() {
+    drawSettingsIcon( TFT_SKYBLUE );
+}
 
-        int mx = 120;
-        int my = 222;
-        int r = 13;
-        drawMoonPhaseIcon( mx, my, r, phase, txt, bg );
+void updateStatusWidgets() {
+    int connected = ( WiFi.status() == WL_CONNECTED ) ? 1 : 0;
+    if ( connected != lastWifiShown ) {
+        lastWifiShown = connected;
+        compositorInvalidate( wWifi );
+    }
+    if ( updateAvailable != lastUpdShown ) {
+        lastUpdShown = updateAvailable;
+        compositorInvalidate( wUpdate );
+    }
+}
 
-        log_d( "[MOON] Phase: %d | Date: %d-%d-%d", phase, ti.tm_year + 1900, ti.tm_mon + 1, ti.tm_mday );
+// AppState listeners. Off the clock screen the widgets are not on the
+// display; coming back repaints all of them anyway.
+static void invalidateOnClock( int id ) {
+    if ( currentState == CLOCK ) {
+        compositorInvalidate( id );
+    }
+}
+
+static void holidayChanged( int ) {
+    if ( currentState == CLOCK ) {
+        updateHolidayLine();
+    }
+}
+
+void clockWidgetsInit() {
+    if ( wWxNow >= 0 ) {
+        return;
     }
+    wWxNow      = compositorAddWidget( "wx-now",      0,   0,   155, 68, drawWxNow );
+    wWxDetails  = compositorAddWidget( "wx-details",  0,   68,  155, 28, drawWxDetails );
+    wWxSun      = compositorAddWidget( "wx-sun",      0,   96,  155, 23, drawWxSun );
+    wWxForecast = compositorAddWidget( "wx-forecast", 0,   119, 155, 83, drawWxForecast );
+    wWxMoon     = compositorAddWidget( "wx-moon",     0,   202, 155, 38, drawWxMoon );
+    wDate       = compositorAddWidget( "date",        155, 166, 165, 18, drawDateLine );
+    wWeek       = compositorAddWidget( "week",        155, 184, 165, 18, drawWeekLine );
+    wCity       = compositorAddWidget( "city",        155, 202, 165, 18, drawCityLine );
+    wHoliday    = compositorAddWidget( "holiday",     155, 220, 165, 20, drawHolidayLine );
+    wWifi       = compositorAddWidget( "wifi",        301, 16,  9,   9,  drawWifiIndicator );
+    wUpdate     = compositorAddWidget( "update",      310, 14,  10,  12, drawUpdateIndicator );
+    compositorAddWidget( "settings", 292, 212, 17, 17, drawSettingsWidget );   // static, repainted only with neighbours
+
+    appSubscribe( APP_WX_NOW | APP_WX_FETCHED | APP_UNIT_TEMP, invalidateOnClock, wWxNow );
+    appSubscribe( APP_WX_DETAILS | APP_WX_FETCHED | APP_UNIT_WIND | APP_UNIT_PRESS, invalidateOnClock, wWxDetails );
+    appSubscribe( APP_WX_SUN | APP_WX_FETCHED, invalidateOnClock, wWxSun );
+    appSubscribe( APP_WX_FORECAST | APP_WX_FETCHED | APP_UNIT_TEMP, invalidateOnClock, wWxForecast );
+    appSubscribe( APP_WX_FETCHED, invalidateOnClock, wWxMoon );
+    appSubscribe( APP_HOLIDAY | APP_NAMEDAY, holidayChanged, 0 );
 }
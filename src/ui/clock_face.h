@@ -2,11 +2,21 @@
 
 #include <Arduino.h>
 #include <TFT_eSPI.h>
+#include <sys/time.h>
 #include <time.h>
 
 void drawClockStatic();
 void drawClockFace();
-void drawDateAndWeek( const struct tm *ti );
 void drawDigitalClock( int h, int m, int s );
 void updateHands( int h, int m, int s );
-void drawWeatherSection();
+void updateHandsSweep( const struct timeval &tv ); // One smooth-sweep frame of the analog clock at time tv
+void releaseClockSprites(); // Frees the analog clock sprites; recreated on the next analog frame
+
+// CLOCK-screen widgets (see compositor.h). The update functions only mark
+// widgets dirty when their content changed; drawing happens in compositorFlush().
+// Weather, unit, holiday and nameday widgets subscribe to their AppState
+// fields in clockWidgetsInit() and need no update call.
+void clockWidgetsInit();
+void updateMoonWidget();        // Moon phase follows the date
+void updateDateWidgets( const struct tm *ti );
+void updateStatusWidgets();
@@ -0,0 +1,163 @@
+#include "compositor.h"
+#include "dma_push.h"
+#include "gfx_stats.h"
+#include "theme.h"
+
+#include <TFT_eSPI.h>
+
+// ---------------------------------------------------------------------------
+// Externs – defined in main.cpp
+// ---------------------------------------------------------------------------
+extern DisplayTFT tft;
+
+// ---------------------------------------------------------------------------
+
+struct Widget {
+    const char   *name;
+    Rect          bounds;
+    WidgetDrawFn  draw;
+};
+
+static Widget widgets[ COMPOSITOR_MAX_WIDGETS ];
+static int    widgetCount = 0;
+
+static Rect   damage[ COMPOSITOR_MAX_DAMAGE ];
+static int    damageCount = 0;
+
+// SPI traffic statistics, reported once per minute
+static uint32_t      statPixels     = 0;  // Pixels written by region erase + sprite pushes
+static uint32_t      statRegions    = 0;  // Merged regions flushed
+static uint32_t      statRedraws    = 0;  // Widget draw callbacks run
+static unsigned long statWindowStart = 0;
+
+static constexpr unsigned long STATS_INTERVAL_MS = 60000UL;
+
+static int32_t rectArea( const Rect &r ) {
+    return ( int32_t )r.w * r.h;
+}
+
+// Two rects are merged when they overlap (otherwise the shared pixels would be
+// flushed twice) or when they share an edge and the union wastes no area.
+static bool shouldMerge( const Rect &a, const Rect &b ) {
+    if ( rectsIntersect( a, b ) ) {
+        return true;
+    }
+    return rectsTouch( a, b ) && rectArea( rectUnion( a, b ) ) <= rectArea( a ) + rectArea( b );
+}
+
+static void mergeDamage() {
+    bool merged = true;
+    while ( merged ) {
+        merged = false;
+        for ( int i = 0; i < damageCount && !merged; i++ ) {
+            for ( int j = i + 1; j < damageCount; j++ ) {
+                if ( shouldMerge( damage[ i ], damage[ j ] ) ) {
+                    damage[ i ] = rectUnion( damage[ i ], damage[ j ] );
+                    damage[ j ] = damage[ --damageCount ];
+                    merged = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+static void addDamage( const Rect &r ) {
+    if ( r.w <= 0 || r.h <= 0 ) {
+        return;
+    }
+    for ( int i = 0; i < damageCount; i++ ) {
+        if ( damage[ i ].x <= r.x && damage[ i ].y <= r.y &&
+                damage[ i ].x + damage[ i ].w >= r.x + r.w &&
+                damage[ i ].y + damage[ i ].h >= r.y + r.h ) {
+            return;     // Already covered
+        }
+    }
+    if ( damageCount == COMPOSITOR_MAX_DAMAGE ) {
+        // Out of slots: collapse everything into one bounding rect
+        for ( int i = 1; i < damageCount; i++ ) {
+            damage[ 0 ] = rectUnion( damage[ 0 ], damage[ i ] );
+        }
+        damage[ 0 ] = rectUnion( damage[ 0 ], r );
+        damageCount = 1;
+        return;
+    }
+    damage[ damageCount++ ] = r;
+}
+
+static void reportStats() {
+    unsigned long now = millis();
+    if ( statWindowStart == 0 ) {
+        statWindowStart = now;
+        return;
+    }
+    if ( now - statWindowStart < STATS_INTERVAL_MS ) {
+        return;
+    }
+    log_i( "[COMP] %lu px/min pushed (%lu regions, %lu widget redraws)",
+           ( unsigned long )statPixels, ( unsigned long )statRegions, ( unsigned long )statRedraws );
+    statPixels      = 0;
+    statRegions     = 0;
+    statRedraws     = 0;
+    statWindowStart = now;
+}
+
+int compositorAddWidget( const char *name, int x, int y, int w, int h, WidgetDrawFn draw ) {
+    if ( widgetCount >= COMPOSITOR_MAX_WIDGETS ) {
+        log_e( "[COMP] Widget table full, cannot add '%s'", name );
+        return -1;
+    }
+    widgets[ widgetCount ] = { name, { ( int16_t )x, ( int16_t )y, ( int16_t )w, ( int16_t )h }, draw };
+    return widgetCount++;
+}
+
+void compositorInvalidate( int id ) {
+    if ( id < 0 || id >= widgetCount ) {
+        return;
+    }
+    addDamage( widgets[ id ].bounds );
+}
+
+void compositorInvalidateRect( int x, int y, int w, int h ) {
+    addDamage( { ( int16_t )x, ( int16_t )y, ( int16_t )w, ( int16_t )h } );
+}
+
+void compositorInvalidateAll() {
+    for ( int i = 0; i < widgetCount; i++ ) {
+        addDamage( widgets[ i ].bounds );
+    }
+}
+
+void compositorFlush() {
+    reportStats();
+    if ( damageCount == 0 ) {
+        return;
+    }
+    mergeDamage();
+    dmaSync();      // Direct tft draws below must not interleave with a sprite DMA
+
+    for ( int d = 0; d < damageCount; d++ ) {
+        const Rect &r = damage[ d ];
+
+        // Clip every primitive to the region; keep absolute coordinates (vpDatum = false)
+        tft.setViewport( r.x, r.y, r.w, r.h, false );
+        fillBackground( r.x, r.y, r.w, r.h );
+        for ( int i = 0; i < widgetCount; i++ ) {
+            if ( rectsIntersect( widgets[ i ].bounds, r ) ) {
+                GFX_SCOPE( widgets[ i ].name );
+                widgets[ i ].draw();
+                statRedraws++;
+            }
+        }
+        tft.resetViewport();
+
+        statPixels += rectArea( r );
+        statRegions++;
+        log_d( "[COMP] Region %d,%d %dx%d", r.x, r.y, r.w, r.h );
+    }
+    damageCount = 0;
+}
+
+void compositorCountPixels( uint32_t px ) {
+    statPixels += px;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <Arduino.h>
+
+// ---------------------------------------------------------------------------
+// Dirty-rectangle compositor
+//
+// Widgets register fixed screen bounds and a draw callback. When a widget's
+// content changes it is invalidated; compositorFlush() then merges all damaged
+// rectangles that overlap and repaints each merged region exactly once:
+// erase to the (gradient-aware) theme background, then redraw every widget intersecting the region with
+// the TFT viewport clipped to it. Widgets never clear their own area and draw
+// text without a background colour so the gradient shows through.
+// ---------------------------------------------------------------------------
+
+constexpr int COMPOSITOR_MAX_WIDGETS = 16;  // Registered widgets (all screens)
+constexpr int COMPOSITOR_MAX_DAMAGE  = 12;  // Pending damage rects before collapsing to one
+
+struct Rect {
+    int16_t x, y, w, h;
+};
+
+inline bool rectsIntersect( const Rect &a, const Rect &b ) {
+    return a.x < b.x + b.w && b.x < a.x + a.w &&
+           a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+inline bool rectsTouch( const Rect &a, const Rect &b ) {
+    return a.x <= b.x + b.w && b.x <= a.x + a.w &&
+           a.y <= b.y + b.h && b.y <= a.y + a.h;
+}
+
+inline Rect rectUnion( const Rect &a, const Rect &b ) {
+    int x0 = min( a.x, b.x );
+    int y0 = min( a.y, b.y );
+    int x1 = max( a.x + a.w, b.x + b.w );
+    int y1 = max( a.y + a.h, b.y + b.h );
+    return { ( int16_t )x0, ( int16_t )y0, ( int16_t )( x1 - x0 ), ( int16_t )( y1 - y0 ) };
+}
+
+typedef void ( *WidgetDrawFn )();
+
+// Registers a widget and returns its id (-1 if the table is full).
+int  compositorAddWidget( const char *name, int x, int y, int w, int h, WidgetDrawFn draw );
+
+// Marks a widget's whole bounds as damaged.
+void compositorInvalidate( int id );
+
+// Marks an arbitrary screen rectangle as damaged.
+void compositorInvalidateRect( int x, int y, int w, int h );
+
+// Marks every registered widget as damaged (e.g. after a full-screen clear).
+void compositorInvalidateAll();
+
+// Repaints all pending damage. Cheap no-op when nothing is dirty.
+void compositorFlush();
+
+// Accounts for pixels pushed outside the compositor (e.g. sprite pushes) so
+// the per-minute SPI report covers the whole screen.
+void compositorCountPixels( uint32_t px );
@@ -0,0 +1,222 @@
+#include "digit_atlas.h"
+#include "compositor.h"
+#include "dma_push.h"
+#include "gfx_stats.h"
+#include "theme.h"
+
+#include "../util/constants.h"
+
+// ---------------------------------------------------------------------------
+// Externs – defined in main.cpp
+// ---------------------------------------------------------------------------
+extern DisplayTFT tft;
+extern int        digitTransition;
+
+// ---------------------------------------------------------------------------
+
+static const char ATLAS_CHARS[] = "0123456789:";
+static constexpr int ATLAS_GLYPHS = sizeof( ATLAS_CHARS ) - 1;
+static constexpr int MAX_CELLS    = 5;      // "HH:MM"
+
+static DisplaySprite atlas( &tft );        // 1 bpp, glyphs side by side
+static DisplaySprite cellSprite( &tft );   // 16 bpp, one cell at a time
+static bool          atlasFailed = false;
+static int           atlasH      = 0;
+static int           atlasStride = 0;      // Bytes per atlas row
+static int           glyphX[ ATLAS_GLYPHS ];
+static int           glyphW[ ATLAS_GLYPHS ];
+
+struct DigitCell {
+    int16_t x, y;
+    uint8_t from, to;   // Glyph indices
+    uint8_t frame;      // DIGIT_ANIM_FRAMES = settled
+};
+
+static DigitCell cells[ MAX_CELLS ];
+static int       cellCount  = 0;
+static uint16_t  digitColor = TFT_WHITE;
+
+static int glyphIndex( char c ) {
+    const char *p = strchr( ATLAS_CHARS, c );
+    return ( p != nullptr && c != '\0' ) ? ( int )( p - ATLAS_CHARS ) : 0;
+}
+
+static uint16_t swap16( uint16_t c ) {
+    return ( c >> 8 ) | ( c << 8 );
+}
+
+bool digitAtlasReady() {
+    if ( atlas.created() ) {
+        return true;
+    }
+    if ( atlasFailed ) {
+        return false;
+    }
+
+    [[maybe_unused]] uint32_t t0 = micros();   // Log only
+    int width = 0;
+    for ( int i = 0; i < ATLAS_GLYPHS; i++ ) {
+        char s[ 2 ] = { ATLAS_CHARS[ i ], '\0' };
+        glyphX[ i ] = width;
+        glyphW[ i ] = tft.textWidth( s, 7 );
+        width      += glyphW[ i ];
+    }
+    atlasH = tft.fontHeight( 7 );
+
+    atlas.setColorDepth( 1 );
+    cellSprite.setColorDepth( 16 );
+    if ( atlas.createSprite( width, atlasH ) == nullptr ||
+            cellSprite.createSprite( glyphW[ 0 ], atlasH ) == nullptr ) {
+        log_w( "[DIGITS] Atlas allocation failed — drawing font 7 directly" );
+        atlas.deleteSprite();
+        cellSprite.deleteSprite();
+        atlasFailed = true;
+        return false;
+    }
+    atlasStride = ( width + 7 ) / 8;    // 1-bpp sprites pad rows to whole bytes
+
+    atlas.fillSprite( TFT_BLACK );
+    atlas.setTextColor( TFT_WHITE );
+    atlas.setTextDatum( TL_DATUM );
+    for ( int i = 0; i < ATLAS_GLYPHS; i++ ) {
+        char s[ 2 ] = { ATLAS_CHARS[ i ], '\0' };
+        atlas.drawString( s, glyphX[ i ], 0, 7 );
+    }
+    log_i( "[DIGITS] Atlas %dx%d (%d B) built in %lu us", width, atlasH,
+           atlasStride * atlasH, ( unsigned long )( micros() - t0 ) );
+    return true;
+}
+
+int digitAtlasHeight() {
+    return atlasH;
+}
+
+int digitAtlasTextWidth( const char *text ) {
+    int w = 0;
+    for ( ; *text; text++ ) {
+        w += glyphW[ glyphIndex( *text ) ];
+    }
+    return w;
+}
+
+// Copies the set pixels of one atlas row into a byte-swapped sprite row
+static void blitRow( uint16_t *dst, int glyph, int srcRow, uint16_t fgSwapped ) {
+    if ( srcRow < 0 || srcRow >= atlasH ) {
+        return;
+    }
+    const uint8_t *bits = ( const uint8_t * )atlas.getPointer() + srcRow * atlasStride;
+    int            gx   = glyphX[ glyph ];
+    for ( int x = 0; x < glyphW[ glyph ]; x++ ) {
+        int ax = gx + x;
+        if ( bits[ ax >> 3 ] & ( 0x80 >> ( ax & 7 ) ) ) {
+            dst[ x ] = fgSwapped;
+        }
+    }
+}
+
+// Renders a cell at its current frame into cellSprite and pushes it.
+//   Slide: the old glyph scrolls up and out while the new one rises from below.
+//   Flip:  split-flap — the old top half folds down onto the hinge revealing the
+//          new top, then the new bottom half unfolds over the old bottom.
+static void renderCell( const DigitCell &c ) {
+    const int n    = DIGIT_ANIM_FRAMES;
+    const int h    = atlasH;
+    const int half = h / 2;
+    const int w    = min( max( glyphW[ c.from ], glyphW[ c.to ] ), ( int )cellSprite.width() );
+    uint16_t  fg   = swap16( digitColor );
+    uint16_t *px   = ( uint16_t * )cellSprite.getPointer();
+    int       sw   = cellSprite.width();
+    bool      anim = c.frame < n && c.from != c.to;
+
+    for ( int y = 0; y < h; y++ ) {
+        uint16_t *row = px + y * sw;
+        uint16_t  bg  = swap16( getBgColorAt( c.y + y ) );
+        for ( int x = 0; x < w; x++ ) {
+            row[ x ] = bg;
+        }
+
+        int glyph = c.to;
+        int src   = y;
+        if ( anim && digitTransition == DIGIT_FX_SLIDE ) {
+            int off = h * c.frame / n;
+            if ( y + off < h ) {
+                glyph = c.from;
+                src   = y + off;
+            }
+            else {
+                src = y + off - h;
+            }
+        }
+        else if ( anim && digitTransition == DIGIT_FX_FLIP ) {
+            if ( 2 * c.frame < n ) {
+                int flap = half - half * 2 * c.frame / n;     // Old top flap, shrinking
+                if ( y >= half ) {
+                    glyph = c.from;
+                }
+                else if ( y >= half - flap ) {
+                    glyph = c.from;
+                    src   = half - ( half - y ) * half / flap;
+                }
+            }
+            else {
+                int flap = ( h - half ) * ( 2 * c.frame - n ) / n; // New bottom flap, growing
+                if ( y >= half + flap ) {
+                    glyph = c.from;
+                }
+                else if ( y >= half ) {
+                    src = half + ( y - half ) * ( h - half ) / flap;
+                }
+            }
+        }
+        blitRow( row, glyph, src, fg );
+    }
+
+    dmaPushSprite( cellSprite, 0, 0, w, h, c.x, c.y );
+    compositorCountPixels( ( uint32_t )w * h );
+}
+
+void digitsDrawAll( const char *text, int cx, int cy, uint16_t color ) {
+    digitColor = color;
+    cellCount  = min( ( int )strlen( text ), MAX_CELLS );
+
+    int x = cx - digitAtlasTextWidth( text ) / 2;
+    for ( int i = 0; i < cellCount; i++ ) {
+        int g = glyphIndex( text[ i ] );
+        cells[ i ] = { ( int16_t )x, ( int16_t )( cy - atlasH / 2 ), ( uint8_t )g, ( uint8_t )g, DIGIT_ANIM_FRAMES };
+        renderCell( cells[ i ] );
+        x += glyphW[ g ];
+    }
+}
+
+void digitsUpdate( const char *text, uint16_t color ) {
+    digitColor = color;
+    for ( int i = 0; i < cellCount && text[ i ]; i++ ) {
+        int g = glyphIndex( text[ i ] );
+        if ( g == cells[ i ].to ) {
+            continue;
+        }
+        cells[ i ].from = cells[ i ].to;   // A transition still running snaps to its target
+        cells[ i ].to   = g;
+        if ( digitTransition == DIGIT_FX_NONE ) {
+            cells[ i ].frame = DIGIT_ANIM_FRAMES;
+            renderCell( cells[ i ] );
+        }
+        else {
+            cells[ i ].frame = 0;
+        }
+    }
+}
+
+bool digitsAnimate() {
+    GFX_SCOPE( "digits-fx" );
+    bool active = false;
+    for ( int i = 0; i < cellCount; i++ ) {
+        if ( cells[ i ].frame >= DIGIT_ANIM_FRAMES ) {
+            continue;
+        }
+        cells[ i ].frame++;
+        renderCell( cells[ i ] );
+        active |= cells[ i ].frame < DIGIT_ANIM_FRAMES;
+    }
+    return active;
+}
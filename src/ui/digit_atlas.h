@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// ---------------------------------------------------------------------------
+// Digital clock HH:MM renderer
+//
+// The font-7 glyphs "0123456789:" are rendered once into a 1-bpp atlas sprite.
+// Each character of the time string is a cell; when a cell's character changes
+// it animates (see DIGIT_FX_* in constants.h) by blitting atlas rows into a
+// small 16-bit cell sprite over the row background. Only changed cells are
+// pushed, one DMA block per cell per frame.
+// ---------------------------------------------------------------------------
+
+// Builds the atlas on first use. False when the sprites could not be allocated
+// (callers then fall back to tft.drawString).
+bool digitAtlasReady();
+
+// Cached font-7 metrics
+int digitAtlasHeight();
+int digitAtlasTextWidth( const char *text );
+
+// Lays text out centred on (cx, cy) and draws every cell without animation.
+// The caller erases the area first.
+void digitsDrawAll( const char *text, int cx, int cy, uint16_t color );
+
+// Starts a transition on each cell whose character differs from the text
+// shown. Text of a different length must go through digitsDrawAll().
+void digitsUpdate( const char *text, uint16_t color );
+
+// Advances running transitions by one frame; returns true while any is active.
+bool digitsAnimate();
@@ -0,0 +1,342 @@
+#include "display_list.h"
+#include "gfx_stats.h"
+#include "theme.h"
+
+// ---------------------------------------------------------------------------
+// Externs – defined in main.cpp
+// ---------------------------------------------------------------------------
+extern DisplayTFT tft;
+
+// ---------------------------------------------------------------------------
+
+// Opcode in the low byte of the first word; the high byte carries a small
+// immediate (role, font, datum, radius, ref or slot index)
+enum DlOp : uint8_t {
+    DL_END,
+    DL_PEN,             // color
+    DL_PEN_ROLE,        // imm = role
+    DL_INK,             // color
+    DL_INK_ROLE,        // imm = role
+    DL_PAPER,           // color
+    DL_PAPER_ROLE,      // imm = role
+    DL_FONT,            // imm = font number
+    DL_FREE_FONT,       // imm = ref
+    DL_DATUM,           // imm = datum
+    DL_FILL_SCREEN,
+    DL_CLEAR,
+    DL_FILL_RECT,       // x y w h
+    DL_DRAW_RECT,       // x y w h
+    DL_FILL_RRECT,      // imm = r; x y w h
+    DL_DRAW_RRECT,      // imm = r; x y w h
+    DL_FILL_CIRCLE,     // imm = r; x y
+    DL_DRAW_CIRCLE,     // imm = r; x y
+    DL_TEXT,            // imm = ref; x y
+    DL_TEXT_SLOT,       // imm = slot; x y
+    DL_CALL,            // imm = ref
+    DL_IF,              // imm = slot; words to skip when the flag is false
+    DL_JUMP             // words to skip
+};
+
+// ---------------------------------------------------------------------------
+// Recording
+// ---------------------------------------------------------------------------
+
+static void emit( DisplayList &dl, DlOp op, uint8_t imm, std::initializer_list<int> args = {} ) {
+    if ( dl.size + 1 + args.size() > DL_MAX_WORDS ) {
+        dl.overflow = true;
+        return;
+    }
+    dl.code[ dl.size++ ] = op | ( imm << 8 );
+    for ( int a : args ) {
+        dl.code[ dl.size++ ] = ( uint16_t )a;
+    }
+}
+
+static uint8_t addRef( DisplayList &dl, DlRef ref ) {
+    if ( dl.refCount == DL_MAX_REFS ) {
+        dl.overflow = true;
+        return 0;
+    }
+    dl.refs[ dl.refCount ] = ref;
+    return dl.refCount++;
+}
+
+// Same callback → same slot, so a value used twice is still one slot
+static uint8_t addSlot( DisplayList &dl, DlTextFn text, DlFlagFn flag ) {
+    for ( int i = 0; i < dl.slotCount; i++ ) {
+        if ( dl.slots[ i ].text == text && dl.slots[ i ].flag == flag ) {
+            return i;
+        }
+    }
+    if ( dl.slotCount == DL_MAX_SLOTS ) {
+        dl.overflow = true;
+        return 0;
+    }
+    dl.slots[ dl.slotCount ] = { text, flag };
+    return dl.slotCount++;
+}
+
+static uint8_t roleIndex( uint16_t ThemePalette::*role ) {
+    static const ThemePalette probe = {};
+    return ( uint8_t )( &( probe.*role ) - &probe.bg );
+}
+
+void dlBegin( DisplayList &dl ) {
+    dl.size      = 0;
+    dl.refCount  = 0;
+    dl.slotCount = 0;
+    dl.depth     = 0;
+    dl.recorded  = false;
+    dl.overflow  = false;
+}
+
+bool dlEnd( DisplayList &dl ) {
+    emit( dl, DL_END, 0 );
+    if ( dl.depth != 0 ) {
+        dl.overflow = true;     // Unbalanced dlIf
+    }
+    if ( dl.overflow ) {
+        log_e( "[DLIST] List overflow or unbalanced dlIf (%u words, %u refs, %u slots)",
+               dl.size, dl.refCount, dl.slotCount );
+        dl.size = 0;
+        return false;
+    }
+    dl.recorded = true;
+    log_d( "[DLIST] Recorded %u words, %u refs, %u slots", dl.size, dl.refCount, dl.slotCount );
+    return true;
+}
+
+void dlPen( DisplayList &dl, uint16_t color ) {
+    emit( dl, DL_PEN, 0, { color } );
+}
+
+void dlPenRole( DisplayList &dl, uint16_t ThemePalette::*role ) {
+    emit( dl, DL_PEN_ROLE, roleIndex( role ) );
+}
+
+void dlInk( DisplayList &dl, uint16_t color ) {
+    emit( dl, DL_INK, 0, { color } );
+}
+
+void dlInkRole( DisplayList &dl, uint16_t ThemePalette::*role ) {
+    emit( dl, DL_INK_ROLE, roleIndex( role ) );
+}
+
+void dlPaper( DisplayList &dl, uint16_t color ) {
+    emit( dl, DL_PAPER, 0, { color } );
+}
+
+void dlPaperRole( DisplayList &dl, uint16_t ThemePalette::*role ) {
+    emit( dl, DL_PAPER_ROLE, roleIndex( role ) );
+}
+
+void dlFont( DisplayList &dl, uint8_t font ) {
+    emit( dl, DL_FONT, font );
+}
+
+void dlFreeFont( DisplayList &dl, const GFXfont *font ) {
+    DlRef ref;
+    ref.font = font;
+    emit( dl, DL_FREE_FONT, addRef( dl, ref ) );
+}
+
+void dlDatum( DisplayList &dl, uint8_t datum ) {
+    emit( dl, DL_DATUM, datum );
+}
+
+void dlFillScreen( DisplayList &dl ) {
+    emit( dl, DL_FILL_SCREEN, 0 );
+}
+
+void dlClear( DisplayList &dl ) {
+    emit( dl, DL_CLEAR, 0 );
+}
+
+void dlFillRect( DisplayList &dl, int x, int y, int w, int h ) {
+    emit( dl, DL_FILL_RECT, 0, { x, y, w, h } );
+}
+
+void dlDrawRect( DisplayList &dl, int x, int y, int w, int h ) {
+    emit( dl, DL_DRAW_RECT, 0, { x, y, w, h } );
+}
+
+void dlFillRoundRect( DisplayList &dl, int x, int y, int w, int h, int r ) {
+    emit( dl, DL_FILL_RRECT, r, { x, y, w, h } );
+}
+
+void dlDrawRoundRect( DisplayList &dl, int x, int y, int w, int h, int r ) {
+    emit( dl, DL_DRAW_RRECT, r, { x, y, w, h } );
+}
+
+void dlFillCircle( DisplayList &dl, int x, int y, int r ) {
+    emit( dl, DL_FILL_CIRCLE, r, { x, y } );
+}
+
+void dlDrawCircle( DisplayList &dl, int x, int y, int r ) {
+    emit( dl, DL_DRAW_CIRCLE, r, { x, y } );
+}
+
+void dlText( DisplayList &dl, const char *text, int x, int y ) {
+    DlRef ref;
+    ref.str = text;
+    emit( dl, DL_TEXT, addRef( dl, ref ), { x, y } );
+}
+
+void dlTextSlot( DisplayList &dl, DlTextFn text, int x, int y ) {
+    emit( dl, DL_TEXT_SLOT, addSlot( dl, text, nullptr ), { x, y } );
+}
+
+void dlCall( DisplayList &dl, DlCallFn fn ) {
+    DlRef ref;
+    ref.call = fn;
+    emit( dl, DL_CALL, addRef( dl, ref ) );
+}
+
+// Jump operands are patched once the block length is known
+void dlIf( DisplayList &dl, DlFlagFn flag ) {
+    emit( dl, DL_IF, addSlot( dl, nullptr, flag ), { 0 } );
+    if ( dl.depth == DL_MAX_NEST ) {
+        dl.overflow = true;
+        return;
+    }
+    dl.open[ dl.depth++ ] = dl.size - 1;
+}
+
+void dlElse( DisplayList &dl ) {
+    if ( dl.depth == 0 ) {
+        dl.overflow = true;
+        return;
+    }
+    emit( dl, DL_JUMP, 0, { 0 } );
+    uint16_t at      = dl.open[ dl.depth - 1 ];
+    dl.code[ at ]    = dl.size - at - 1;    // False branch starts after the jump
+    dl.open[ dl.depth - 1 ] = dl.size - 1;
+}
+
+void dlEndIf( DisplayList &dl ) {
+    if ( dl.depth == 0 ) {
+        dl.overflow = true;
+        return;
+    }
+    uint16_t at   = dl.open[ --dl.depth ];
+    dl.code[ at ] = dl.size - at - 1;
+}
+
+// ---------------------------------------------------------------------------
+// Replay
+// ---------------------------------------------------------------------------
+
+void dlReplay( const DisplayList &dl ) {
+    GFX_SCOPE( "dlReplay" );
+    const uint16_t *roles    = &activeTheme.bg;
+    const uint16_t *pc       = dl.code;
+    uint16_t        pen      = TFT_WHITE;
+    uint16_t        ink      = TFT_WHITE;
+    uint8_t         font     = 1;
+    bool            freeFont = false;
+    char            buf[ DL_TEXT_MAX ];
+
+    if ( !dl.recorded ) {
+        return;
+    }
+    for ( ;; ) {
+        uint8_t op  = *pc & 0xFF;
+        uint8_t imm = *pc >> 8;
+        pc++;
+        switch ( op ) {
+            case DL_END:
+                return;
+            case DL_PEN:
+                pen = *pc++;
+                break;
+            case DL_PEN_ROLE:
+                pen = roles[ imm ];
+                break;
+            case DL_INK:
+                ink = *pc++;
+                tft.setTextColor( ink );
+                break;
+            case DL_INK_ROLE:
+                ink = roles[ imm ];
+                tft.setTextColor( ink );
+                break;
+            case DL_PAPER:
+                tft.setTextColor( ink, *pc++ );
+                break;
+            case DL_PAPER_ROLE:
+                tft.setTextColor( ink, roles[ imm ] );
+                break;
+            case DL_FONT:
+                font     = imm;
+                freeFont = false;
+                tft.setFreeFont( NULL );
+                break;
+            case DL_FREE_FONT:
+                freeFont = true;
+                tft.setFreeFont( dl.refs[ imm ].font );
+                break;
+            case DL_DATUM:
+                tft.setTextDatum( imm );
+                break;
+            case DL_FILL_SCREEN:
+                tft.fillScreen( pen );
+                break;
+            case DL_CLEAR:
+                fillBackground( 0, 0, tft.width(), tft.height() );
+                break;
+            case DL_FILL_RECT:
+                tft.fillRect( ( int16_t )pc[ 0 ], ( int16_t )pc[ 1 ], ( int16_t )pc[ 2 ], ( int16_t )pc[ 3 ], pen );
+                pc += 4;
+                break;
+            case DL_DRAW_RECT:
+                tft.drawRect( ( int16_t )pc[ 0 ], ( int16_t )pc[ 1 ], ( int16_t )pc[ 2 ], ( int16_t )pc[ 3 ], pen );
+                pc += 4;
+                break;
+            case DL_FILL_RRECT:
+                tft.fillRoundRect( ( int16_t )pc[ 0 ], ( int16_t )pc[ 1 ], ( int16_t )pc[ 2 ], ( int16_t )pc[ 3 ], imm, pen );
+                pc += 4;
+                break;
+            case DL_DRAW_RRECT:
+                tft.drawRoundRect( ( int16_t )pc[ 0 ], ( int16_t )pc[ 1 ], ( int16_t )pc[ 2 ], ( int16_t )pc[ 3 ], imm, pen );
+                pc += 4;
+                break;
+            case DL_FILL_CIRCLE:
+                tft.fillCircle( ( int16_t )pc[ 0 ], ( int16_t )pc[ 1 ], imm, pen );
+                pc += 2;
+                break;
+            case DL_DRAW_CIRCLE:
+                tft.drawCircle( ( int16_t )pc[ 0 ], ( int16_t )pc[ 1 ], imm, pen );
+                pc += 2;
+                break;
+            case DL_TEXT:
+            case DL_TEXT_SLOT: {
+                const char *s = dl.refs[ imm ].str;
+                if ( op == DL_TEXT_SLOT ) {
+                    buf[ 0 ] = '\0';
+                    dl.slots[ imm ].text( buf, sizeof( buf ) );
+                    s = buf;
+                }
+                if ( freeFont ) {
+                    tft.drawString( s, ( int16_t )pc[ 0 ], ( int16_t )pc[ 1 ] );
+                }
+                else {
+                    tft.drawString( s, ( int16_t )pc[ 0 ], ( int16_t )pc[ 1 ], font );
+                }
+                pc += 2;
+                break;
+            }
+            case DL_CALL:
+                dl.refs[ imm ].call();
+                break;
+            case DL_IF:
+                pc += 1 + ( dl.slots[ imm ].flag() ? 0 : *pc );
+                break;
+            case DL_JUMP:
+                pc += 1 + *pc;
+                break;
+            default:
+                log_e( "[DLIST] Bad opcode %u at word %d", op, ( int )( pc - 1 - dl.code ) );
+                return;
+        }
+    }
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#include "theme.h"
+
+// ---------------------------------------------------------------------------
+// Display lists for the static settings screens
+//
+// A screen is recorded once into a compact list of 16-bit words (opcode +
+// operands) and then replayed by a small interpreter on every redraw, so the
+// layout code, String building and font switching run only once. Whatever
+// changes between redraws goes through slots: text slots call a function for
+// the string, flag slots pick a branch (dlIf / dlElse / dlEndIf). Colours can
+// be palette roles, resolved at replay, so a list survives theme changes.
+//
+// State follows the TFT's own model: a pen colour for shapes, and ink / paper
+// (text colour and optional background), font and datum that persist until
+// changed, so a recording mirrors the direct drawing code call for call and
+// replay produces the same pixels.
+// ---------------------------------------------------------------------------
+
+constexpr int DL_MAX_WORDS = 320;   // Code words per list
+constexpr int DL_MAX_REFS  = 40;    // Strings, fonts and callbacks per list
+constexpr int DL_MAX_SLOTS = 8;     // Text + flag slots per list
+constexpr int DL_MAX_NEST  = 4;     // dlIf depth
+constexpr int DL_TEXT_MAX  = 40;    // Text slot buffer, including the terminator
+
+typedef void ( *DlTextFn )( char *buf, size_t len );
+typedef bool ( *DlFlagFn )();
+typedef void ( *DlCallFn )();
+
+union DlRef {
+    const char    *str;
+    const GFXfont *font;
+    DlCallFn       call;
+};
+
+struct DlSlot {
+    DlTextFn text;
+    DlFlagFn flag;
+};
+
+struct DisplayList {
+    uint16_t code[ DL_MAX_WORDS ];
+    DlRef    refs[ DL_MAX_REFS ];
+    DlSlot   slots[ DL_MAX_SLOTS ];
+    uint16_t size;
+    uint8_t  refCount, slotCount;
+    uint16_t open[ DL_MAX_NEST ];   // Recording: pending dlIf / dlElse jumps
+    uint8_t  depth;
+    bool     recorded;
+    bool     overflow;
+};
+
+// --- Recording ---
+void dlBegin( DisplayList &dl );
+bool dlEnd( DisplayList &dl );              // false (and logged) if the list overflowed
+
+void dlPen( DisplayList &dl, uint16_t color );                      // Shapes
+void dlPenRole( DisplayList &dl, uint16_t ThemePalette::*role );
+void dlInk( DisplayList &dl, uint16_t color );                      // Text; clears the paper
+void dlInkRole( DisplayList &dl, uint16_t ThemePalette::*role );
+void dlPaper( DisplayList &dl, uint16_t color );                    // Text background, after dlInk
+void dlPaperRole( DisplayList &dl, uint16_t ThemePalette::*role );
+void dlFont( DisplayList &dl, uint8_t font );
+void dlFreeFont( DisplayList &dl, const GFXfont *font );
+void dlDatum( DisplayList &dl, uint8_t datum );
+
+void dlFillScreen( DisplayList &dl );       // Solid, in the pen colour
+void dlClear( DisplayList &dl );            // Theme background, gradient-aware
+void dlFillRect( DisplayList &dl, int x, int y, int w, int h );
+void dlDrawRect( DisplayList &dl, int x, int y, int w, int h );
+void dlFillRoundRect( DisplayList &dl, int x, int y, int w, int h, int r );
+void dlDrawRoundRect( DisplayList &dl, int x, int y, int w, int h, int r );
+void dlFillCircle( DisplayList &dl, int x, int y, int r );
+void dlDrawCircle( DisplayList &dl, int x, int y, int r );
+void dlText( DisplayList &dl, const char *text, int x, int y );    // text must outlive the list
+void dlTextSlot( DisplayList &dl, DlTextFn text, int x, int y );
+void dlCall( DisplayList &dl, DlCallFn fn );                        // Escape hatch (icons)
+
+void dlIf( DisplayList &dl, DlFlagFn flag );
+void dlElse( DisplayList &dl );
+void dlEndIf( DisplayList &dl );
+
+// --- Replay ---
+void dlReplay( const DisplayList &dl );
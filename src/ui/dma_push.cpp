@@ -0,0 +1,133 @@
+#include "dma_push.h"
+
+#include <esp_heap_caps.h>
+
+// ---------------------------------------------------------------------------
+// Externs – defined in main.cpp
+// ---------------------------------------------------------------------------
+extern DisplayTFT tft;
+
+// ---------------------------------------------------------------------------
+
+static uint16_t *stage[ 2 ]    = { nullptr, nullptr };
+static int       stageIdx      = 0;
+static bool      dmaReady      = false;
+static bool      inTransaction = false;
+
+// Sprite and staging buffers hold panel (big-endian) byte order
+static inline uint16_t swap565( uint16_t c ) {
+    return ( uint16_t )( ( c >> 8 ) | ( c << 8 ) );
+}
+
+static void loadPalette( DisplaySprite &spr, uint16_t *lut ) {
+    for ( int i = 0; i < 16; i++ ) {
+        lut[ i ] = swap565( spr.getPaletteColor( i ) );
+    }
+}
+
+// Expands `rows` rows of a 4-bit sprite, starting at sprite row sy (screen
+// row ty), into dst. Rows are byte-aligned; even x is the high nibble.
+static void expandRows( DisplaySprite &spr, uint16_t *lut, DmaRowColorFn rowColor0,
+                        int sx, int sy, int sw, int rows, int ty, uint16_t *dst ) {
+    const uint8_t *img    = ( const uint8_t * )spr.getPointer();
+    int            stride = ( spr.width() + 1 ) / 2;
+    for ( int r = 0; r < rows; r++ ) {
+        if ( rowColor0 != nullptr ) {
+            lut[ 0 ] = swap565( rowColor0( ty + r ) );
+        }
+        const uint8_t *line = img + ( sy + r ) * stride;
+        uint16_t      *out  = dst + r * sw;
+        for ( int x = sx; x < sx + sw; x++ ) {
+            uint8_t b = line[ x >> 1 ];
+            *out++    = lut[ ( x & 1 ) ? ( b & 0x0F ) : ( b >> 4 ) ];
+        }
+    }
+}
+
+// Blocking fallback for 4-bit sprites, one expanded row at a time
+static void pushPaletted( DisplaySprite &spr, int sx, int sy, int sw, int sh, int tx, int ty, DmaRowColorFn rowColor0 ) {
+    uint16_t lut[ 16 ];
+    uint16_t line[ TFT_HEIGHT > TFT_WIDTH ? TFT_HEIGHT : TFT_WIDTH ];
+    loadPalette( spr, lut );
+    sw = min( sw, ( int )( sizeof( line ) / sizeof( line[ 0 ] ) ) );
+    tft.startWrite();
+    for ( int r = 0; r < sh; r++ ) {
+        expandRows( spr, lut, rowColor0, sx, sy + r, sw, 1, ty + r, line );
+        tft.pushRect( tx, ty + r, sw, 1, line );
+    }
+    tft.endWrite();
+}
+
+void dmaPushInit() {
+    if ( dmaReady ) {
+        return;
+    }
+    for ( int i = 0; i < 2; i++ ) {
+        stage[ i ] = ( uint16_t * )heap_caps_malloc( DMA_STAGE_PIXELS * sizeof( uint16_t ), MALLOC_CAP_DMA );
+    }
+    if ( stage[ 0 ] == nullptr || stage[ 1 ] == nullptr || !tft.initDMA() ) {
+        log_w( "[DMA] Unavailable — sprite pushes stay blocking" );
+        for ( int i = 0; i < 2; i++ ) {
+            heap_caps_free( stage[ i ] );
+            stage[ i ] = nullptr;
+        }
+        return;
+    }
+    dmaReady = true;
+    log_i( "[DMA] Enabled, 2 × %u byte staging buffers", ( unsigned )( DMA_STAGE_PIXELS * sizeof( uint16_t ) ) );
+}
+
+void dmaPushSprite( DisplaySprite &spr, int sx, int sy, int sw, int sh, int tx, int ty,
+                    DmaRowColorFn rowColor0 ) {
+    int depth = spr.getColorDepth();
+    if ( !dmaReady || ( depth != 16 && depth != 4 ) || sw <= 0 || sh <= 0 ) {
+        dmaSync();
+        if ( depth == 4 && sw > 0 && sh > 0 ) {
+            pushPaletted( spr, sx, sy, sw, sh, tx, ty, rowColor0 );
+        }
+        else {
+            spr.pushSprite( tx, ty, sx, sy, sw, sh );
+        }
+        return;
+    }
+
+    if ( !inTransaction ) {
+        tft.startWrite();
+        inTransaction = true;
+    }
+
+    // 16-bit sprite pixels are stored byte-swapped already — copy them out row
+    // by row into a contiguous staging block, in chunks that fit one buffer.
+    // 4-bit pixels are looked up in the palette on the way.
+    const uint16_t *src       = ( const uint16_t * )spr.getPointer();
+    int             spw       = spr.width();
+    int             chunkRows = max( 1, DMA_STAGE_PIXELS / sw );
+    uint16_t        lut[ 16 ];
+    if ( depth == 4 ) {
+        loadPalette( spr, lut );
+    }
+    for ( int row = 0; row < sh; row += chunkRows ) {
+        int       rows = min( chunkRows, sh - row );
+        uint16_t *buf  = stage[ stageIdx ];
+        if ( depth == 4 ) {
+            expandRows( spr, lut, rowColor0, sx, sy + row, sw, rows, ty + row, buf );
+        }
+        else {
+            for ( int r = 0; r < rows; r++ ) {
+                memcpy( buf + r * sw, src + ( sy + row + r ) * spw + sx, sw * sizeof( uint16_t ) );
+            }
+        }
+        // Waits for the previous transfer (the other buffer), then queues this one
+        tft.pushImageDMA( tx, ty + row, sw, rows, buf );
+        stageIdx ^= 1;
+    }
+}
+
+void dmaSync() {
+    if ( !inTransaction ) {
+        return;
+    }
+    tft.dmaWait();
+    tft.endWrite();
+    inTransaction = false;
+}
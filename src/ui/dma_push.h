@@ -0,0 +1,39 @@
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#include "gfx_stats.h"
+
+// ---------------------------------------------------------------------------
+// Asynchronous sprite push over the TFT's HSPI DMA channel
+//
+// dmaPushSprite() copies a sprite rectangle into one of two DMA staging
+// buffers and queues it; the CPU returns immediately and can render the next
+// frame while the previous one is still on the wire. The staging buffers
+// alternate, so filling one never touches the one in flight.
+//
+// 4-bpp sprites are expanded through their palette while they are copied into
+// the staging buffer, so a palette sprite costs a quarter of the RAM and
+// nothing extra on the wire. Palette entry 0 can follow the screen row
+// (rowColor0), which lets a sprite carry the gradient background as one index.
+//
+// The SPI transaction stays open between pushes. Anything that draws to tft
+// directly must call dmaSync() first.
+// ---------------------------------------------------------------------------
+
+constexpr int DMA_STAGE_PIXELS = 140 * 32;  // Pixels per staging buffer (2 × 8960 bytes)
+
+// Call once after tft.init(). Falls back to blocking pushes if DMA is unavailable.
+void dmaPushInit();
+
+typedef uint16_t ( *DmaRowColorFn )( int y );     // Screen row → RGB565
+
+// Pushes sprite rect (sx, sy, sw, sh) to the screen at (tx, ty) without waiting
+// for the transfer to finish. 16-bit and 4-bit sprites; for 4-bit sprites
+// rowColor0, if given, replaces palette entry 0 on every screen row.
+void dmaPushSprite( DisplaySprite &spr, int sx, int sy, int sw, int sh, int tx, int ty,
+                    DmaRowColorFn rowColor0 = nullptr );
+
+// Waits for any transfer in flight and closes the SPI transaction.
+void dmaSync();
@@ -0,0 +1,91 @@
+#include "gesture.h"
+
+// ---------------------------------------------------------------------------
+
+static void fill( const GestureTracker &g, GestureType type, Gesture &out ) {
+    out.type = type;
+    out.dir  = SWIPE_LEFT;
+    // Taps and long presses stay within the drag slop: the latest filtered
+    // position has settled furthest from the landing
+    bool last = type != GESTURE_SWIPE && type != GESTURE_DRAG_END;
+    out.x    = last ? g.x : g.x0;
+    out.y    = last ? g.y : g.y0;
+    out.dx   = g.x - g.x0;
+    out.dy   = g.y - g.y0;
+    out.vx   = ( int16_t )constrain( g.vx, -32767, 32767 );
+    out.vy   = ( int16_t )constrain( g.vy, -32767, 32767 );
+}
+
+void gestureReset( GestureTracker &g ) {
+    memset( &g, 0, sizeof( g ) );
+}
+
+bool gestureFeed( GestureTracker &g, const TouchEvent &ev, Gesture &out ) {
+    switch ( ev.type ) {
+        case TOUCH_DOWN:
+            gestureReset( g );
+            g.active = true;
+            g.x0 = g.x = ev.x;
+            g.y0 = g.y = ev.y;
+            g.t0 = g.t = ev.us;
+            return false;
+
+        case TOUCH_MOVE: {
+            if ( !g.active ) {
+                return false;   // Press began before this tracker was listening
+            }
+            uint32_t dt = ev.us - g.t;
+            if ( dt > 0 ) {
+                // Half-weight average of the per-sample velocity
+                int32_t ivx = ( int32_t )( ( int64_t )( ev.x - g.x ) * 1000000 / dt );
+                int32_t ivy = ( int32_t )( ( int64_t )( ev.y - g.y ) * 1000000 / dt );
+                g.vx += ( ivx - g.vx ) / 2;
+                g.vy += ( ivy - g.vy ) / 2;
+            }
+            g.x = ev.x;
+            g.y = ev.y;
+            g.t = ev.us;
+
+            if ( !g.dragging && ( abs( g.x - g.x0 ) > GESTURE_DRAG_SLOP || abs( g.y - g.y0 ) > GESTURE_DRAG_SLOP ) ) {
+                g.dragging = true;
+            }
+            if ( g.dragging ) {
+                fill( g, GESTURE_DRAG, out );
+                return true;
+            }
+            if ( !g.longFired && ev.us - g.t0 >= GESTURE_LONG_MS * 1000 ) {
+                g.longFired = true;
+                fill( g, GESTURE_LONG_PRESS, out );
+                return true;
+            }
+            return false;
+        }
+
+        case TOUCH_UP:
+        default: {
+            if ( !g.active ) {
+                return false;
+            }
+            g.active = false;
+            if ( !g.dragging ) {
+                // A slow release without a long press is still a tap (the
+                // release debounce adds its own delay to ev.us)
+                if ( g.longFired || g.t - g.t0 > GESTURE_TAP_MS * 1000 ) {
+                    return false;
+                }
+                fill( g, GESTURE_TAP, out );
+                return true;
+            }
+
+            fill( g, GESTURE_DRAG_END, out );
+            bool horizontal = abs( out.dx ) >= abs( out.dy );
+            int  dist       = horizontal ? out.dx : out.dy;
+            int  speed      = horizontal ? out.vx : out.vy;
+            if ( abs( dist ) >= GESTURE_SWIPE_DIST && abs( speed ) >= GESTURE_SWIPE_SPEED && ( dist > 0 ) == ( speed > 0 ) ) {
+                out.type = GESTURE_SWIPE;
+                out.dir  = horizontal ? ( dist < 0 ? SWIPE_LEFT : SWIPE_RIGHT ) : ( dist < 0 ? SWIPE_UP : SWIPE_DOWN );
+            }
+            return true;
+        }
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "../hal/touch.h"
+
+// ---------------------------------------------------------------------------
+// Gesture recognizer over the filtered touch events (hal/touch.h)
+//
+// A press is a tap until it travels GESTURE_DRAG_SLOP px, then a drag. Held
+// in place for GESTURE_LONG_MS it fires a long press once. A drag released
+// faster than GESTURE_SWIPE_SPEED along its main axis, and at least
+// GESTURE_SWIPE_DIST px along it, is a swipe; otherwise it ends as a drag with
+// its release velocity (lists use that to fling).
+//
+// Velocity is a smoothed per-sample estimate in px/s. The TOUCH_UP event
+// carries no motion (it comes after the release debounce), so the velocity at
+// release is the one of the last moves.
+// ---------------------------------------------------------------------------
+
+constexpr int      GESTURE_DRAG_SLOP   = 8;     // px before a press becomes a drag
+constexpr uint32_t GESTURE_TAP_MS      = 400;   // Longest press that is still a tap
+constexpr uint32_t GESTURE_LONG_MS     = 700;   // Hold time for a long press
+constexpr int      GESTURE_SWIPE_SPEED = 400;   // px/s at release
+constexpr int      GESTURE_SWIPE_DIST  = 40;    // px along the main axis
+
+enum GestureType : uint8_t {
+    GESTURE_TAP,
+    GESTURE_LONG_PRESS,
+    GESTURE_SWIPE,
+    GESTURE_DRAG,           // Each move once dragging
+    GESTURE_DRAG_END        // Released without enough speed for a swipe
+};
+
+enum SwipeDir : uint8_t {
+    SWIPE_LEFT,
+    SWIPE_RIGHT,
+    SWIPE_UP,
+    SWIPE_DOWN
+};
+
+struct Gesture {
+    GestureType type;
+    SwipeDir    dir;        // GESTURE_SWIPE
+    int16_t     x, y;       // Latest filtered position; the press position for swipes / drag ends
+    int16_t     dx, dy;     // Travel since the press
+    int16_t     vx, vy;     // px/s
+};
+
+struct GestureTracker {
+    bool     active;        // Between TOUCH_DOWN and TOUCH_UP
+    bool     dragging;
+    bool     longFired;
+    int16_t  x0, y0;        // Press position
+    int16_t  x, y;          // Last position
+    uint32_t t0, t;         // Press / last sample, micros()
+    int32_t  vx, vy;        // px/s, smoothed
+};
+
+void gestureReset( GestureTracker &g );
+
+// Feeds one event; returns true with out filled when it completes a gesture
+bool gestureFeed( GestureTracker &g, const TouchEvent &ev, Gesture &out );
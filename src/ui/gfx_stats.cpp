@@ -0,0 +1,350 @@
+#include "gfx_stats.h"
+
+#ifdef GFX_STATS
+
+// ---------------------------------------------------------------------------
+
+struct GfxTagStats {
+    const char *tag;
+    uint32_t    calls[ GFX_PRIM_COUNT ];
+    uint32_t    pixels;
+    uint32_t    windows;
+    uint32_t    primUs;     // Time inside outermost primitive calls
+    uint32_t    scopes;     // GFX_SCOPE entries
+    uint32_t    scopeUs;    // Inclusive time inside those scopes
+};
+
+static const char *PRIM_NAMES[ GFX_PRIM_COUNT ] = {
+    "px", "hline", "vline", "line", "rect", "rrect", "circle", "tri", "smooth", "text", "bitmap", "image"
+};
+
+static constexpr int MAX_DEPTH = 8;         // Nested primitive calls tracked for leaf detection
+
+static GfxTagStats   table[ GFX_STATS_MAX_TAGS ];
+static int           tagCount    = 0;
+static uint32_t      droppedTags = 0;
+static const char   *curTag      = "untagged";
+static int           curSlot     = -1;      // -1 = look up curTag on first use
+static int           depth       = 0;
+static bool          childSeen[ MAX_DEPTH ];
+static unsigned long windowStart = 0;
+static int           lastScreen  = -1;
+
+static int slotFor( const char *tag ) {
+    for ( int i = 0; i < tagCount; i++ ) {
+        if ( table[ i ].tag == tag || strcmp( table[ i ].tag, tag ) == 0 ) {
+            return i;
+        }
+    }
+    if ( tagCount == GFX_STATS_MAX_TAGS ) {
+        droppedTags++;
+        return -1;
+    }
+    memset( &table[ tagCount ], 0, sizeof( GfxTagStats ) );
+    table[ tagCount ].tag = tag;
+    return tagCount++;
+}
+
+static GfxTagStats *current() {
+    if ( curSlot < 0 ) {
+        curSlot = slotFor( curTag );
+    }
+    return curSlot >= 0 ? &table[ curSlot ] : nullptr;
+}
+
+// ---------------------------------------------------------------------------
+
+GfxCall::GfxCall( GfxPrim kind, uint32_t estPixels ) : kind( kind ), pixels( estPixels ), t0( 0 ) {
+    depth++;
+    if ( depth < MAX_DEPTH ) {
+        childSeen[ depth ] = false;
+    }
+    if ( depth > 1 && depth - 1 < MAX_DEPTH ) {
+        childSeen[ depth - 1 ] = true;
+    }
+    if ( depth == 1 ) {
+        t0 = micros();
+    }
+}
+
+GfxCall::~GfxCall() {
+    GfxTagStats *s = current();
+    if ( s != nullptr ) {
+        if ( depth == 1 ) {
+            s->calls[ kind ]++;
+            s->primUs += micros() - t0;
+        }
+        // Leaves carry the window/pixel cost; composites defer to their parts
+        if ( depth >= MAX_DEPTH || !childSeen[ depth ] ) {
+            s->windows++;
+            s->pixels += pixels;
+        }
+    }
+    depth--;
+}
+
+GfxScope::GfxScope( const char *tag ) : prevTag( curTag ), prevSlot( curSlot ), t0( micros() ) {
+    curTag  = tag;
+    curSlot = -1;
+}
+
+GfxScope::~GfxScope() {
+    GfxTagStats *s = current();
+    if ( s != nullptr ) {
+        s->scopes++;
+        s->scopeUs += micros() - t0;
+    }
+    curTag  = prevTag;
+    curSlot = prevSlot;
+}
+
+// ---------------------------------------------------------------------------
+// Report
+// ---------------------------------------------------------------------------
+
+static void report( unsigned long elapsed, int screen ) {
+    if ( tagCount == 0 ) {
+        return;
+    }
+
+    // Most expensive tags first
+    int order[ GFX_STATS_MAX_TAGS ];
+    for ( int i = 0; i < tagCount; i++ ) {
+        order[ i ] = i;
+    }
+    for ( int i = 0; i < tagCount; i++ ) {
+        for ( int j = i + 1; j < tagCount; j++ ) {
+            const GfxTagStats &a = table[ order[ i ] ];
+            const GfxTagStats &b = table[ order[ j ] ];
+            if ( max( b.scopeUs, b.primUs ) > max( a.scopeUs, a.primUs ) ) {
+                int t      = order[ i ];
+                order[ i ] = order[ j ];
+                order[ j ] = t;
+            }
+        }
+    }
+
+    log_i( "[GFX] ---- %lu ms on screen %d ----", elapsed, screen );
+    for ( int i = 0; i < tagCount; i++ ) {
+        const GfxTagStats &s = table[ order[ i ] ];
+        char     mix[ 112 ] = "";
+        int      n          = 0;
+        uint32_t calls      = 0;
+        for ( int k = 0; k < GFX_PRIM_COUNT; k++ ) {
+            if ( s.calls[ k ] == 0 ) {
+                continue;
+            }
+            calls += s.calls[ k ];
+            if ( n < ( int )sizeof( mix ) ) {
+                n += snprintf( mix + n, sizeof( mix ) - n, "%s%s %lu", n ? ", " : "", PRIM_NAMES[ k ], ( unsigned long )s.calls[ k ] );
+            }
+        }
+        log_i( "[GFX] %-24s %4lu x %7lu us | %5lu calls %7lu px %5lu win %7lu us | %s",
+               s.tag, ( unsigned long )s.scopes, ( unsigned long )s.scopeUs,
+               ( unsigned long )calls, ( unsigned long )s.pixels, ( unsigned long )s.windows,
+               ( unsigned long )s.primUs, mix );
+    }
+    if ( droppedTags > 0 ) {
+        log_w( "[GFX] Tag table full — %lu scopes not counted", ( unsigned long )droppedTags );
+    }
+}
+
+void gfxStatsPoll( int screen ) {
+    unsigned long now = millis();
+    if ( windowStart == 0 ) {
+        windowStart = now;
+        lastScreen  = screen;
+        return;
+    }
+    if ( screen == lastScreen && now - windowStart < GFX_STATS_INTERVAL_MS ) {
+        return;
+    }
+    report( now - windowStart, lastScreen );
+    tagCount    = 0;
+    droppedTags = 0;
+    curSlot     = -1;
+    windowStart = now;
+    lastScreen  = screen;
+}
+
+// ---------------------------------------------------------------------------
+// ProfiledTFT
+// ---------------------------------------------------------------------------
+
+static uint32_t discArea( int32_t r ) {
+    return ( uint32_t )( r * r * 355 / 113 );
+}
+
+static uint32_t lineLength( float ax, float ay, float bx, float by ) {
+    return ( uint32_t )max( fabsf( bx - ax ), fabsf( by - ay ) ) + 1;
+}
+
+void ProfiledTFT::drawPixel( int32_t x, int32_t y, uint32_t color ) {
+    GfxCall c( GFX_PIXEL, 1 );
+    TFT_eSPI::drawPixel( x, y, color );
+}
+
+void ProfiledTFT::drawChar( int32_t x, int32_t y, uint16_t ch, uint32_t color, uint32_t bg, uint8_t size ) {
+    GfxCall c( GFX_TEXT, 48u * size * size );
+    TFT_eSPI::drawChar( x, y, ch, color, bg, size );
+}
+
+void ProfiledTFT::drawLine( int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color ) {
+    GfxCall c( GFX_LINE, lineLength( xs, ys, xe, ye ) );
+    TFT_eSPI::drawLine( xs, ys, xe, ye, color );
+}
+
+void ProfiledTFT::drawFastVLine( int32_t x, int32_t y, int32_t h, uint32_t color ) {
+    GfxCall c( GFX_VLINE, max( h, ( int32_t )0 ) );
+    TFT_eSPI::drawFastVLine( x, y, h, color );
+}
+
+void ProfiledTFT::drawFastHLine( int32_t x, int32_t y, int32_t w, uint32_t color ) {
+    GfxCall c( GFX_HLINE, max( w, ( int32_t )0 ) );
+    TFT_eSPI::drawFastHLine( x, y, w, color );
+}
+
+void ProfiledTFT::fillRect( int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color ) {
+    GfxCall c( GFX_RECT, ( uint32_t )max( w, ( int32_t )0 ) * max( h, ( int32_t )0 ) );
+    TFT_eSPI::fillRect( x, y, w, h, color );
+}
+
+int16_t ProfiledTFT::drawChar( uint16_t uniCode, int32_t x, int32_t y, uint8_t font ) {
+    GfxCall c( GFX_TEXT, 0 );
+    int16_t w = TFT_eSPI::drawChar( uniCode, x, y, font );
+    c.setPixels( ( uint32_t )max( w, ( int16_t )0 ) * fontHeight( font ) );
+    return w;
+}
+
+int16_t ProfiledTFT::drawChar( uint16_t uniCode, int32_t x, int32_t y ) {
+    GfxCall c( GFX_TEXT, 0 );
+    int16_t w = TFT_eSPI::drawChar( uniCode, x, y );
+    c.setPixels( ( uint32_t )max( w, ( int16_t )0 ) * fontHeight() );
+    return w;
+}
+
+void ProfiledTFT::fillScreen( uint32_t color ) {
+    GfxCall c( GFX_RECT, ( uint32_t )width() * height() );
+    TFT_eSPI::fillScreen( color );
+}
+
+void ProfiledTFT::drawRect( int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color ) {
+    GfxCall c( GFX_RECT, 2 * ( w + h ) );
+    TFT_eSPI::drawRect( x, y, w, h, color );
+}
+
+void ProfiledTFT::drawRoundRect( int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color ) {
+    GfxCall c( GFX_ROUNDRECT, 2 * ( w + h ) );
+    TFT_eSPI::drawRoundRect( x, y, w, h, radius, color );
+}
+
+void ProfiledTFT::fillRoundRect( int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color ) {
+    GfxCall c( GFX_ROUNDRECT, ( uint32_t )w * h );
+    TFT_eSPI::fillRoundRect( x, y, w, h, radius, color );
+}
+
+void ProfiledTFT::drawCircle( int32_t x, int32_t y, int32_t r, uint32_t color ) {
+    GfxCall c( GFX_CIRCLE, ( uint32_t )( r * 710 / 113 ) );
+    TFT_eSPI::drawCircle( x, y, r, color );
+}
+
+void ProfiledTFT::fillCircle( int32_t x, int32_t y, int32_t r, uint32_t color ) {
+    GfxCall c( GFX_CIRCLE, discArea( r ) );
+    TFT_eSPI::fillCircle( x, y, r, color );
+}
+
+void ProfiledTFT::drawTriangle( int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t color ) {
+    GfxCall c( GFX_TRIANGLE, lineLength( x1, y1, x2, y2 ) + lineLength( x2, y2, x3, y3 ) + lineLength( x3, y3, x1, y1 ) );
+    TFT_eSPI::drawTriangle( x1, y1, x2, y2, x3, y3, color );
+}
+
+void ProfiledTFT::fillTriangle( int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t color ) {
+    GfxCall c( GFX_TRIANGLE, ( uint32_t )abs( ( x2 - x1 ) * ( y3 - y1 ) - ( x3 - x1 ) * ( y2 - y1 ) ) / 2 );
+    TFT_eSPI::fillTriangle( x1, y1, x2, y2, x3, y3, color );
+}
+
+void ProfiledTFT::fillSmoothCircle( int32_t x, int32_t y, int32_t r, uint32_t color, uint32_t bg_color ) {
+    GfxCall c( GFX_SMOOTH, discArea( r + 1 ) );
+    TFT_eSPI::fillSmoothCircle( x, y, r, color, bg_color );
+}
+
+void ProfiledTFT::fillSmoothRoundRect( int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color, uint32_t bg_color ) {
+    GfxCall c( GFX_SMOOTH, ( uint32_t )w * h );
+    TFT_eSPI::fillSmoothRoundRect( x, y, w, h, radius, color, bg_color );
+}
+
+void ProfiledTFT::drawWideLine( float ax, float ay, float bx, float by, float wd, uint32_t fg_color, uint32_t bg_color ) {
+    GfxCall c( GFX_SMOOTH, lineLength( ax, ay, bx, by ) * ( uint32_t )( wd + 2 ) );
+    TFT_eSPI::drawWideLine( ax, ay, bx, by, wd, fg_color, bg_color );
+}
+
+void ProfiledTFT::drawWedgeLine( float ax, float ay, float bx, float by, float aw, float bw, uint32_t fg_color, uint32_t bg_color ) {
+    GfxCall c( GFX_SMOOTH, lineLength( ax, ay, bx, by ) * ( uint32_t )( 2 * max( aw, bw ) + 2 ) );
+    TFT_eSPI::drawWedgeLine( ax, ay, bx, by, aw, bw, fg_color, bg_color );
+}
+
+void ProfiledTFT::drawBitmap( int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t fgcolor ) {
+    GfxCall c( GFX_BITMAP, ( uint32_t )w * h );
+    TFT_eSPI::drawBitmap( x, y, bitmap, w, h, fgcolor );
+}
+
+void ProfiledTFT::drawBitmap( int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t fgcolor, uint16_t bgcolor ) {
+    GfxCall c( GFX_BITMAP, ( uint32_t )w * h );
+    TFT_eSPI::drawBitmap( x, y, bitmap, w, h, fgcolor, bgcolor );
+}
+
+void ProfiledTFT::pushImage( int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data ) {
+    GfxCall c( GFX_IMAGE, ( uint32_t )w * h );
+    TFT_eSPI::pushImage( x, y, w, h, data );
+}
+
+void ProfiledTFT::pushImage( int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data ) {
+    GfxCall c( GFX_IMAGE, ( uint32_t )w * h );
+    TFT_eSPI::pushImage( x, y, w, h, data );
+}
+
+void ProfiledTFT::pushImageDMA( int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t *buffer ) {
+    GfxCall c( GFX_IMAGE, ( uint32_t )w * h );
+    TFT_eSPI::pushImageDMA( x, y, w, h, data, buffer );
+}
+
+int16_t ProfiledTFT::drawString( const char *string, int32_t x, int32_t y, uint8_t font ) {
+    GfxCall c( GFX_TEXT, 0 );
+    return TFT_eSPI::drawString( string, x, y, font );
+}
+
+int16_t ProfiledTFT::drawString( const char *string, int32_t x, int32_t y ) {
+    GfxCall c( GFX_TEXT, 0 );
+    return TFT_eSPI::drawString( string, x, y );
+}
+
+int16_t ProfiledTFT::drawString( const String &string, int32_t x, int32_t y, uint8_t font ) {
+    GfxCall c( GFX_TEXT, 0 );
+    return TFT_eSPI::drawString( string, x, y, font );
+}
+
+int16_t ProfiledTFT::drawString( const String &string, int32_t x, int32_t y ) {
+    GfxCall c( GFX_TEXT, 0 );
+    return TFT_eSPI::drawString( string, x, y );
+}
+
+// ---------------------------------------------------------------------------
+// ProfiledSprite
+// ---------------------------------------------------------------------------
+
+void ProfiledSprite::pushSprite( int32_t x, int32_t y ) {
+    GfxCall c( GFX_IMAGE, ( uint32_t )width() * height() );
+    TFT_eSprite::pushSprite( x, y );
+}
+
+void ProfiledSprite::pushSprite( int32_t x, int32_t y, uint16_t transparent ) {
+    GfxCall c( GFX_IMAGE, ( uint32_t )width() * height() );
+    TFT_eSprite::pushSprite( x, y, transparent );
+}
+
+bool ProfiledSprite::pushSprite( int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh ) {
+    GfxCall c( GFX_IMAGE, ( uint32_t )sw * sh );
+    return TFT_eSprite::pushSprite( tx, ty, sx, sy, sw, sh );
+}
+
+#endif
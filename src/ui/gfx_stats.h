@@ -0,0 +1,143 @@
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// ---------------------------------------------------------------------------
+// Display-work instrumentation (build with -D GFX_STATS; on in [env:debug])
+//
+// The global display is declared as DisplayTFT and off-screen sprites as
+// DisplaySprite. With GFX_STATS these are thin subclasses that count, per tag,
+// the calls to each primitive, pixels written, address windows opened and the
+// microseconds spent inside the primitives. Tags come from GFX_SCOPE( "name" )
+// in widget/screen draw functions (the innermost scope wins) and also record
+// inclusive scope time, which covers sprite rendering on the CPU.
+//
+// Composite shapes are split by TFT_eSPI into virtual line/rect calls; those
+// leaves are what count as windows and pixels, so a fillCircle shows up as the
+// number of spans it really sent. Text glyphs and image blocks count as one
+// window each (an estimate for RLE fonts).
+//
+// Without GFX_STATS the typedefs are plain TFT_eSPI / TFT_eSprite and the
+// macros compile to nothing.
+// ---------------------------------------------------------------------------
+
+#ifdef GFX_STATS
+
+constexpr int           GFX_STATS_MAX_TAGS    = 40;      // Distinct tags tracked per report
+constexpr unsigned long GFX_STATS_INTERVAL_MS = 60000UL; // Periodic report interval
+
+enum GfxPrim : uint8_t {
+    GFX_PIXEL,
+    GFX_HLINE,
+    GFX_VLINE,
+    GFX_LINE,
+    GFX_RECT,
+    GFX_ROUNDRECT,
+    GFX_CIRCLE,
+    GFX_TRIANGLE,
+    GFX_SMOOTH,     // Anti-aliased circles / wedge and wide lines
+    GFX_TEXT,
+    GFX_BITMAP,
+    GFX_IMAGE,      // pushImage / pushImageDMA / pushSprite
+    GFX_PRIM_COUNT
+};
+
+// Records one primitive call for the lifetime of the object (use on the stack)
+class GfxCall {
+public:
+    GfxCall( GfxPrim kind, uint32_t estPixels );
+    ~GfxCall();
+    void setPixels( uint32_t px ) {
+        pixels = px;
+    }
+private:
+    GfxPrim  kind;
+    uint32_t pixels;
+    uint32_t t0;
+};
+
+// Tags all drawing in the enclosing block
+class GfxScope {
+public:
+    explicit GfxScope( const char *tag );
+    ~GfxScope();
+private:
+    const char *prevTag;
+    int         prevSlot;
+    uint32_t    t0;
+};
+
+#define GFX_SCOPE_CAT2( a, b ) a##b
+#define GFX_SCOPE_CAT( a, b )  GFX_SCOPE_CAT2( a, b )
+#define GFX_SCOPE( tag )       GfxScope GFX_SCOPE_CAT( gfxScope_, __LINE__ )( tag )
+
+class ProfiledTFT : public TFT_eSPI {
+public:
+    ProfiledTFT() : TFT_eSPI() {}
+
+    // Virtual leaves — also seen when called from inside TFT_eSPI composites
+    void    drawPixel( int32_t x, int32_t y, uint32_t color ) override;
+    void    drawChar( int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size ) override;
+    void    drawLine( int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color ) override;
+    void    drawFastVLine( int32_t x, int32_t y, int32_t h, uint32_t color ) override;
+    void    drawFastHLine( int32_t x, int32_t y, int32_t w, uint32_t color ) override;
+    void    fillRect( int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color ) override;
+    int16_t drawChar( uint16_t uniCode, int32_t x, int32_t y, uint8_t font ) override;
+    int16_t drawChar( uint16_t uniCode, int32_t x, int32_t y ) override;
+
+    // Non-virtual composites — hidden by name, so only calls made through the
+    // DisplayTFT type (every module's extern) are seen
+    using TFT_eSPI::drawPixel;
+    using TFT_eSPI::pushImage;
+    void    fillScreen( uint32_t color );
+    void    drawRect( int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color );
+    void    drawRoundRect( int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color );
+    void    fillRoundRect( int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color );
+    void    drawCircle( int32_t x, int32_t y, int32_t r, uint32_t color );
+    void    fillCircle( int32_t x, int32_t y, int32_t r, uint32_t color );
+    void    drawTriangle( int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t color );
+    void    fillTriangle( int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t color );
+    void    fillSmoothCircle( int32_t x, int32_t y, int32_t r, uint32_t color, uint32_t bg_color = 0x00FFFFFF );
+    void    fillSmoothRoundRect( int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color, uint32_t bg_color = 0x00FFFFFF );
+    void    drawWideLine( float ax, float ay, float bx, float by, float wd, uint32_t fg_color, uint32_t bg_color = 0x00FFFFFF );
+    void    drawWedgeLine( float ax, float ay, float bx, float by, float aw, float bw, uint32_t fg_color, uint32_t bg_color = 0x00FFFFFF );
+    void    drawBitmap( int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t fgcolor );
+    void    drawBitmap( int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t fgcolor, uint16_t bgcolor );
+    void    pushImage( int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data );
+    void    pushImage( int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data );
+    void    pushImageDMA( int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t *buffer = nullptr );
+    int16_t drawString( const char *string, int32_t x, int32_t y, uint8_t font );
+    int16_t drawString( const char *string, int32_t x, int32_t y );
+    int16_t drawString( const String &string, int32_t x, int32_t y, uint8_t font );
+    int16_t drawString( const String &string, int32_t x, int32_t y );
+};
+
+class ProfiledSprite : public TFT_eSprite {
+public:
+    explicit ProfiledSprite( TFT_eSPI *tft ) : TFT_eSprite( tft ) {}
+
+    // Only the screen-facing pushes are counted; sprite drawing shows up as
+    // CPU time in the enclosing GFX_SCOPE
+    void pushSprite( int32_t x, int32_t y );
+    void pushSprite( int32_t x, int32_t y, uint16_t transparent );
+    bool pushSprite( int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh );
+};
+
+typedef ProfiledTFT    DisplayTFT;
+typedef ProfiledSprite DisplaySprite;
+
+// Logs and resets the per-tag table when the screen changes or the report
+// interval elapses. Call once per loop with the current screen state.
+void gfxStatsPoll( int screen );
+
+#else
+
+typedef TFT_eSPI    DisplayTFT;
+typedef TFT_eSprite DisplaySprite;
+
+#define GFX_SCOPE( tag )
+
+inline void gfxStatsPoll( int ) {}
+
+#endif
@@ -1,6 +1,10 @@
 #include "icons.h"
+#include "gfx_stats.h"
 #include "theme.h"
+#include "weather_icons_data.h"
 #include "../util/constants.h"
+#include "../util/moon.h"
+#include "../util/trig.h"
 
 #include <WiFi.h>
 #include <TFT_eSPI.h>
@@ -8,56 +12,31 @@
 // ---------------------------------------------------------------------------
 // Externs – defined in main.cpp
 // ---------------------------------------------------------------------------
-extern TFT_eSPI  tft;
-extern bool      isWhiteTheme;
-extern int       themeMode;
-extern uint16_t  blueDark;
-extern uint16_t  yellowDark;
+extern DisplayTFT tft;
 extern bool      updateAvailable;
 
-static constexpr float DEGTORAD_ICONS = ( float )( PI / 180.0 );
-
 // ---------------------------------------------------------------------------
 
-void drawCloudVector( int x, int y, uint32_t color ) {
-    tft.fillCircle( x + 10, y + 15, 8, color );
-    tft.fillCircle( x + 18, y + 10, 10, color );
-    tft.fillCircle( x + 28, y + 15, 8, color );
-    tft.fillRoundRect( x + 10, y + 15, 20, 8, 4, color );
-}
-
-void drawWeatherIconVector( int code, int x, int y ) {
-    // Icon colors adapt to the theme
-    uint16_t cloudCol = TFT_SILVER;
-    uint16_t shadowCol = isWhiteTheme ? 0x8410 : 0x4208; // Shadow in blue/yellow theme
+// ============================================
+// WEATHER ICONS
+// ============================================
+// Rasterised at build time by scripts/gen_weather_icons.py into 4-bpp bitmaps
+// with a per-icon palette of (ink, alpha). Drawing expands the palette over the
+// row background once per row and pushes the icon as one block.
+static constexpr int WX_ICON_MAX_PIXELS = 36 * 36;
+static uint16_t wxIconBuf[ WX_ICON_MAX_PIXELS ];   // Byte-swapped, ready for pushImage
 
+static WeatherIconId weatherIconFor( int code ) {
     switch ( code ) {
-        case 0: // Clear
-            // Sun with shadow
-            tft.fillCircle( x + 16, y + 16, 10, TFT_YELLOW );
-            tft.drawCircle( x + 16, y + 16, 11, shadowCol ); // Shadow
-            for ( int i = 0; i < 360; i += 45 ) {
-                float rad = i * 0.01745;
-                tft.drawLine( x + 16 + cos( rad ) * 11, y + 16 + sin( rad ) * 11, x + 16 + cos( rad ) * 16, y + 16 + sin( rad ) * 16, TFT_YELLOW );
-            }
-            break;
-
+        case 0:
+            return WX_ICON_CLEAR;
         case 1:
         case 2:
-        case 3: // Partly cloudy
-            tft.fillCircle( x + 22, y + 10, 8, TFT_YELLOW );
-            tft.drawCircle( x + 22, y + 10, 9, shadowCol ); // Shadow
-            drawCloudVector( x, y + 5, cloudCol );
-            break;
-
+        case 3:
+            return WX_ICON_PARTLY;
         case 45:
-        case 48: // Fog
-            for ( int i = 0; i < 3; i++ ) {
-                tft.fillRoundRect( x + 4, y + 9 + ( i * 6 ), 24, 3, 2, TFT_SILVER );
-                tft.drawRoundRect( x + 4, y + 9 + ( i * 6 ), 24, 3, 2, shadowCol ); // Shadow
-            }
-            break;
-
+        case 48:
+            return WX_ICON_FOG;
         case 51:
         case 53:
         case 55:
@@ -68,285 +47,179 @@ void drawWeatherIconVector( int code, int x, int y ) {
         case 65:
         case 66:
         case 67: // Rain / freezing drizzle / freezing rain
-            drawCloudVector( x, y + 2, TFT_SILVER );
-            for ( int i = 0; i < 3; i++ ) {
-                tft.fillRoundRect( x + 10 + ( i * 6 ), y + 22, 2, 6, 1, TFT_BLUE );
-                tft.drawRoundRect( x + 10 + ( i * 6 ), y + 22, 2, 6, 1, shadowCol ); // Drop shadow
-            }
-            break;
-
+            return WX_ICON_RAIN;
         case 71:
         case 73:
         case 75:
-        case 77: // Snow
-            drawCloudVector( x, y + 2, cloudCol );
-            tft.setTextColor( TFT_SKYBLUE );
-            tft.drawString( "*", x + 12, y + 22 );
-            tft.drawString( "*", x + 22, y + 22 );
-            break;
-
+        case 77:
+            return WX_ICON_SNOW;
         case 80:
         case 81:
-        case 82: // Showers
-            tft.fillCircle( x + 22, y + 10, 7, TFT_YELLOW );
-            tft.drawCircle( x + 22, y + 10, 8, shadowCol ); // Shadow
-            drawCloudVector( x, y + 2, TFT_SILVER );
-            tft.fillRoundRect( x + 16, y + 22, 2, 6, 1, TFT_BLUE );
-            break;
-
+        case 82:
+            return WX_ICON_SHOWERS;
         case 85:
-        case 86: // Snow showers
-            tft.fillCircle( x + 22, y + 10, 7, TFT_YELLOW );
-            tft.drawCircle( x + 22, y + 10, 8, shadowCol );
-            drawCloudVector( x, y + 2, TFT_SILVER );
-            tft.setTextColor( TFT_SKYBLUE );
-            tft.drawString( "*", x + 12, y + 22 );
-            tft.drawString( "*", x + 22, y + 22 );
-            break;
-
+        case 86:
+            return WX_ICON_SNOW_SHOWERS;
         case 95:
         case 96:
-        case 99: // Storm
-            drawCloudVector( x, y + 2, shadowCol ); // Dark cloud
-            tft.drawLine( x + 18, y + 20, x + 14, y + 28, TFT_YELLOW );
-            tft.drawLine( x + 14, y + 28, x + 20, y + 28, TFT_YELLOW );
-            tft.drawLine( x + 20, y + 28, x + 16, y + 36, TFT_YELLOW );
-            break;
-
+        case 99:
+            return WX_ICON_STORM;
         default:
-            drawCloudVector( x, y + 5, TFT_SILVER );
-            break;
+            return WX_ICON_CLOUDY;
     }
 }
 
-// ============================================
-// NEW FEATURE: Reduced icons for forecast
-// ============================================
-void drawWeatherIconVectorSmall( int code, int x, int y ) {
-    // A scaled-down version for forecast, but with better proportions
-    uint16_t cloudCol = TFT_SILVER;
-    uint16_t shadowCol = isWhiteTheme ? 0x8410 : 0x4208;
-
-    switch ( code ) {
-        case 0: // Clear
-            tft.fillCircle( x + 16, y + 16, 9, TFT_YELLOW );
-            tft.drawCircle( x + 16, y + 16, 10, shadowCol );
-            for ( int i = 0; i < 360; i += 45 ) {
-                float rad = i * 0.01745;
-                tft.drawLine( x + 16 + cos( rad ) * 10, y + 16 + sin( rad ) * 10, x + 16 + cos( rad ) * 14, y + 16 + sin( rad ) * 14, TFT_YELLOW );
-            }
-            break;
-
-        case 1:
-        case 2:
-        case 3: // Partly cloudy
-            tft.fillCircle( x + 20, y + 10, 7, TFT_YELLOW );
-            tft.drawCircle( x + 20, y + 10, 8, shadowCol );
-            tft.fillCircle( x + 8, y + 14, 6, cloudCol );
-            tft.fillCircle( x + 14, y + 11, 7, cloudCol );
-            tft.fillCircle( x + 20, y + 14, 5, cloudCol );
-            tft.fillRoundRect( x + 8, y + 14, 15, 5, 2, cloudCol );
-            break;
-
-        case 45:
-        case 48: // Fog
-            for ( int i = 0; i < 3; i++ ) {
-                tft.fillRoundRect( x + 4, y + 10 + ( i * 5 ), 20, 2, 1, TFT_SILVER );
-                tft.drawRoundRect( x + 4, y + 10 + ( i * 5 ), 20, 2, 1, shadowCol );
-            }
-            break;
-
-        case 51:
-        case 53:
-        case 55:
-        case 56:
-        case 57:
-        case 61:
-        case 63:
-        case 65:
-        case 66:
-        case 67: // Rain / freezing drizzle / freezing rain
-            tft.fillCircle( x + 9, y + 13, 6, cloudCol );
-            tft.fillCircle( x + 15, y + 10, 8, cloudCol );
-            tft.fillCircle( x + 22, y + 13, 6, cloudCol );
-            tft.fillRoundRect( x + 9, y + 13, 16, 6, 3, cloudCol );
-            for ( int i = 0; i < 3; i++ ) {
-                tft.fillRoundRect( x + 10 + ( i * 5 ), y + 21, 2, 5, 1, TFT_BLUE );
-                tft.drawRoundRect( x + 10 + ( i * 5 ), y + 21, 2, 5, 1, shadowCol );
-            }
-            break;
-
-        case 71:
-        case 73:
-        case 75:
-        case 77: // Snow
-            tft.fillCircle( x + 9, y + 13, 6, cloudCol );
-            tft.fillCircle( x + 15, y + 10, 8, cloudCol );
-            tft.fillCircle( x + 22, y + 13, 6, cloudCol );
-            tft.fillRoundRect( x + 9, y + 13, 16, 6, 3, cloudCol );
-            tft.setTextColor( TFT_SKYBLUE );
-            tft.drawString( "*", x + 11, y + 21 );
-            tft.drawString( "*", x + 19, y + 21 );
-            break;
-
-        case 80:
-        case 81:
-        case 82: // Showers
-            tft.fillCircle( x + 20, y + 10, 7, TFT_YELLOW );
-            tft.drawCircle( x + 20, y + 10, 8, shadowCol );
-            tft.fillCircle( x + 8, y + 14, 6, cloudCol );
-            tft.fillCircle( x + 14, y + 11, 7, cloudCol );
-            tft.fillCircle( x + 20, y + 14, 5, cloudCol );
-            tft.fillRoundRect( x + 8, y + 14, 15, 5, 2, cloudCol );
-            tft.fillRoundRect( x + 14, y + 21, 2, 5, 1, TFT_BLUE );
-            break;
-
-        case 85:
-        case 86: // Snow showers
-            tft.fillCircle( x + 20, y + 10, 7, TFT_YELLOW );
-            tft.drawCircle( x + 20, y + 10, 8, shadowCol );
-            tft.fillCircle( x + 8, y + 14, 6, cloudCol );
-            tft.fillCircle( x + 14, y + 11, 7, cloudCol );
-            tft.fillCircle( x + 20, y + 14, 5, cloudCol );
-            tft.fillRoundRect( x + 8, y + 14, 15, 5, 2, cloudCol );
-            tft.setTextColor( TFT_SKYBLUE );
-            tft.drawString( "*", x + 14, y + 21 );
-            break;
-
-        case 95:
-        case 96:
-        case 99: // Storm
-            tft.fillCircle( x + 9, y + 13, 6, shadowCol );
-            tft.fillCircle( x + 15, y + 10, 8, shadowCol );
-            tft.fillCircle( x + 22, y + 13, 6, shadowCol );
-            tft.fillRoundRect( x + 9, y + 13, 16, 6, 3, shadowCol );
-            tft.drawLine( x + 15, y + 20, x + 12, y + 27, TFT_YELLOW );
-            tft.drawLine( x + 12, y + 27, x + 17, y + 27, TFT_YELLOW );
-            tft.drawLine( x + 17, y + 27, x + 14, y + 34, TFT_YELLOW );
-            break;
-
+// Icon colours adapt to the theme (the shadow ink)
+static uint16_t inkColor( uint8_t ink ) {
+    switch ( ink ) {
+        case WX_INK_SUN:
+            return TFT_YELLOW;
+        case WX_INK_CLOUD:
+            return TFT_SILVER;
+        case WX_INK_SHADOW:
+            return theme().cloudShadow;
+        case WX_INK_RAIN:
+            return TFT_BLUE;
         default:
-            tft.fillCircle( x + 9, y + 13, 6, cloudCol );
-            tft.fillCircle( x + 15, y + 10, 8, cloudCol );
-            tft.fillCircle( x + 22, y + 13, 6, cloudCol );
-            tft.fillRoundRect( x + 9, y + 13, 16, 6, 3, cloudCol );
-            break;
+            return TFT_SKYBLUE;
     }
 }
 
-// ============================================
-// NEW FEATURE FOR CORRECT DRAWING OF MOON PHASE
-// ============================================
-void drawMoonPhaseIcon( int mx, int my, int r, int phase, uint16_t textColor, uint16_t bgColor ) {
-    uint16_t moonBg = ( themeMode == THEME_BLUE ) ? blueDark : ( themeMode == THEME_YELLOW ) ? yellowDark : ( isWhiteTheme ? 0xDEDB : 0x3186 );
-    uint16_t moonColor = TFT_YELLOW;
-    uint16_t shadowColor = moonBg;
-
-    tft.drawCircle( mx, my, r, textColor );
-
-    switch ( phase ) {
+static void drawWeatherBitmap( const WeatherIconBitmap &icon, int x, int y ) {
+    GFX_SCOPE( "icon-weather" );
+    [[maybe_unused]] uint32_t t0 = micros();   // Log only
+    int      w  = icon.w;
+    int      h  = icon.h;
+    if ( w * h > WX_ICON_MAX_PIXELS ) {
+        log_e( "[ICON] %s is %dx%d, larger than the icon buffer", icon.name, w, h );
+        return;
+    }
+    int ox = x + icon.dx;
+    int oy = y + icon.dy;
 
-        case 0: { // NEW MOON
-            tft.fillCircle( mx, my, r - 1, shadowColor );
-            break;
-        }
+    uint16_t ink[ 16 ];
+    for ( int i = 0; i < icon.paletteSize; i++ ) {
+        ink[ i + 1 ] = inkColor( icon.palette[ i ].ink );
+    }
 
-        case 1: { // WAXING CRESCENT
-            tft.fillCircle( mx, my, r - 1, shadowColor );
-            int offset = r / 3;
-            for ( int dy = -r; dy <= r; dy++ ) {
-                int dx_max = sqrt( r * r - dy * dy );
-                int light_boundary = sqrt( r * r - dy * dy - offset * offset ) - offset;
-                if ( light_boundary < 0 ) {
-                    light_boundary = 0;
-                }
-                for ( int dx = light_boundary; dx <= dx_max; dx++ ) {
-                    tft.drawPixel( mx + dx, my + dy, moonColor );
-                }
+    // Palette expanded over the current row's background; rebuilt when the
+    // gradient colour changes, so most rows reuse the previous one
+    uint16_t lut[ 16 ] = { 0 };
+    int32_t  lutBg     = -1;
+    int      stride    = ( w + 1 ) / 2;
+    for ( int row = 0; row < h; row++ ) {
+        uint16_t bg = getBgColorAt( oy + row );
+        if ( bg != lutBg ) {
+            lut[ 0 ] = bg;
+            for ( int i = 0; i < icon.paletteSize; i++ ) {
+                uint8_t a = icon.palette[ i ].alpha;
+                lut[ i + 1 ] = ( a == 255 ) ? ink[ i + 1 ] : blendColor565( bg, ink[ i + 1 ], a, 255 );
             }
-            break;
-        }
-
-        case 2: { // FIRST QUARTER
-            tft.fillCircle( mx, my, r - 1, shadowColor );
-            for ( int dy = -r; dy <= r; dy++ ) {
-                int dx_max = sqrt( r * r - dy * dy );
-                for ( int dx = 0; dx <= dx_max; dx++ ) {
-                    tft.drawPixel( mx + dx, my + dy, moonColor );
-                }
+            for ( int i = 0; i <= icon.paletteSize; i++ ) {
+                lut[ i ] = ( lut[ i ] >> 8 ) | ( lut[ i ] << 8 );
             }
-            break;
+            lutBg = bg;
         }
-
-        case 3: { // WAXING GIBBOUS
-            tft.fillCircle( mx, my, r - 1, moonColor );
-            int offset = r / 3;
-            for ( int dy = -r; dy <= r; dy++ ) {
-                int dx_max = sqrt( r * r - dy * dy );
-                int shadow_boundary = -( sqrt( r * r - dy * dy - offset * offset ) - offset );
-                if ( shadow_boundary > 0 ) {
-                    shadow_boundary = 0;
-                }
-                for ( int dx = -dx_max; dx <= shadow_boundary; dx++ ) {
-                    tft.drawPixel( mx + dx, my + dy, shadowColor );
-                }
-            }
-            break;
+        const uint8_t *src = icon.pixels + row * stride;
+        uint16_t      *dst = wxIconBuf + row * w;
+        for ( int col = 0; col < w; col++ ) {
+            uint8_t b = src[ col >> 1 ];
+            dst[ col ] = lut[ ( col & 1 ) ? ( b & 0x0F ) : ( b >> 4 ) ];
         }
+    }
+    tft.pushImage( ox, oy, w, h, wxIconBuf );
 
-        case 4: { // FULL MOON
-            tft.fillCircle( mx, my, r - 1, moonColor );
-            break;
-        }
+    log_d( "[ICON] %s %dx%d: %lu us, %u B flash", icon.name, w, h,
+           ( unsigned long )( micros() - t0 ), ( unsigned )icon.bytes );
+}
 
-        case 5: { // WANING GIBBOUS
-            tft.fillCircle( mx, my, r - 1, moonColor );
-            int offset = r / 3;
-            for ( int dy = -r; dy <= r; dy++ ) {
-                int dx_max = sqrt( r * r - dy * dy );
-                int shadow_boundary = sqrt( r * r - dy * dy - offset * offset ) - offset;
-                if ( shadow_boundary < 0 ) {
-                    shadow_boundary = 0;
-                }
-                for ( int dx = shadow_boundary; dx <= dx_max; dx++ ) {
-                    tft.drawPixel( mx + dx, my + dy, shadowColor );
-                }
-            }
-            break;
-        }
+void drawWeatherIconVector( int code, int x, int y ) {
+    drawWeatherBitmap( WEATHER_ICONS_LARGE[ weatherIconFor( code ) ], x, y );
+}
 
-        case 6: { // LAST QUARTER
-            tft.fillCircle( mx, my, r - 1, shadowColor );
-            for ( int dy = -r; dy <= r; dy++ ) {
-                int dx_max = sqrt( r * r - dy * dy );
-                for ( int dx = -dx_max; dx <= 0; dx++ ) {
-                    tft.drawPixel( mx + dx, my + dy, moonColor );
-                }
-            }
-            break;
-        }
+void drawWeatherIconVectorSmall( int code, int x, int y ) {
+    drawWeatherBitmap( WEATHER_ICONS_SMALL[ weatherIconFor( code ) ], x, y );
+}
 
-        case 7: { // WANING CRESCENT
-            tft.fillCircle( mx, my, r - 1, shadowColor );
-            int offset = r / 3;
-            for ( int dy = -r; dy <= r; dy++ ) {
-                int dx_max = sqrt( r * r - dy * dy );
-                int light_boundary = -( sqrt( r * r - dy * dy - offset * offset ) - offset );
-                if ( light_boundary > 0 ) {
-                    light_boundary = 0;
-                }
-                for ( int dx = -dx_max; dx <= light_boundary; dx++ ) {
-                    tft.drawPixel( mx + dx, my + dy, moonColor );
-                }
-            }
-            break;
+// ============================================
+// MOON PHASE ICON
+// ============================================
+// The lit part of each row runs from the limb to the terminator, an ellipse
+// whose half-width is the limb half-width × cos( 2π · cycle ). The icon is
+// rendered as horizontal spans into a small sprite, cached per (cycle bucket,
+// theme) and pushed as one block; a redraw with the same inputs is a push only.
+static DisplaySprite moonSprite( &tft );
+static bool        moonSpriteFailed = false;
+static int         moonKeyBucket = -1, moonKeyR = -1;
+static uint16_t    moonKeyText  = 0;
+static uint32_t    moonKeyStamp = 0;
+
+// Draws the moon centred at (cx, cy) on dst; returns the number of lit pixels
+// and the disc area in discPx
+static int renderMoon( TFT_eSPI &dst, int cx, int cy, int r, int bucket, uint16_t textColor, int &discPx ) {
+    uint16_t shadowColor = theme().moonShadow;
+    uint16_t moonColor   = TFT_YELLOW;
+
+    int32_t ang    = ( int32_t )bucket * TRIG_FULL / MOON_CYCLE_BUCKETS;
+    int32_t litQ15 = ( Q15_ONE - icos( ang ) ) / 2;     // Lit share of every row
+    bool    waxing = bucket <= MOON_CYCLE_BUCKETS / 2;   // Lit from the right limb
+    int     litPx  = 0;
+    discPx = 0;
+
+    for ( int dy = -( r - 1 ); dy <= r - 1; dy++ ) {
+        int w   = circleSpan( r - 1, dy );
+        int len = 2 * w + 1;
+        int lit = q15Mul( len, litQ15 );
+        dst.drawFastHLine( cx - w, cy + dy, len, shadowColor );
+        if ( lit > 0 ) {
+            dst.drawFastHLine( waxing ? cx + w - lit + 1 : cx - w, cy + dy, lit, moonColor );
         }
+        litPx  += lit;
+        discPx += len;
+    }
+    dst.drawCircle( cx, cy, r, textColor );
+    return litPx;
+}
+
+void drawMoonPhaseIcon( int mx, int my, int r, int bucket, uint16_t textColor ) {
+    GFX_SCOPE( "icon-moon" );
+    int size = 2 * r + 1;
 
-        default: {
-            tft.drawCircle( mx, my, r, textColor );
-            break;
+    if ( !moonSprite.created() && !moonSpriteFailed ) {
+        moonSprite.setColorDepth( 16 );
+        if ( moonSprite.createSprite( size, size ) == nullptr ) {
+            log_w( "[MOON] Icon sprite allocation failed — drawing direct" );
+            moonSpriteFailed = true;
         }
     }
+    if ( moonSpriteFailed || moonSprite.width() != size ) {
+        int discPx;
+        renderMoon( tft, mx, my, r, bucket, textColor, discPx );
+        return;
+    }
+
+    uint32_t stamp = getBgStamp();
+    if ( bucket != moonKeyBucket || r != moonKeyR || textColor != moonKeyText || stamp != moonKeyStamp ) {
+        uint32_t t0 = micros();
+        fillSpriteBackground( moonSprite, my - r );
+        int discPx;
+        [[maybe_unused]] int      litPx   = renderMoon( moonSprite, r, r, r, bucket, textColor, discPx );
+        [[maybe_unused]] uint32_t tRender = micros() - t0;     // Log only
+
+        t0 = micros();
+        moonSprite.pushSprite( mx - r, my - r );
+        // The old renderer issued one drawPixel (one SPI address window) per lit or shaded pixel
+        log_d( "[MOON] Bucket %d/%d: render %lu us, push %lu us as 1 block (%d lit px, was ~%d pixel writes)",
+               bucket, MOON_CYCLE_BUCKETS, ( unsigned long )tRender, ( unsigned long )( micros() - t0 ),
+               litPx, min( litPx, discPx - litPx ) );
+
+        moonKeyBucket = bucket;
+        moonKeyR      = r;
+        moonKeyText   = textColor;
+        moonKeyStamp  = stamp;
+        return;
+    }
+    moonSprite.pushSprite( mx - r, my - r );
 }
 
 void drawWifiIndicator() {
@@ -355,15 +228,13 @@ void drawWifiIndicator() {
     tft.fillCircle( 305, 20, 4, color );
 }
 
-// Update available indicator — upward triangle + stem, offset 4 px right of WiFi circle
+// Update available indicator — upward triangle + stem, offset 4 px right of WiFi circle.
+// Drawn as a compositor widget: its footprint is erased by the compositor.
 void drawUpdateIndicator() {
     if ( !updateAvailable ) {
         return;
     }
 
-    // Erase previous icon footprint before drawing (handles redraws without a prior fillScreen)
-    tft.fillRect( 310, 14, 10, 12, getBgColor() );
-
     int iconX = 313;  // 4 px gap from WiFi circle right edge (x=309)
     int iconY = 15;   // Centres the 10px-tall icon at y=20 (matching WiFi circle centre)
 
@@ -377,12 +248,12 @@ void drawSettingsIcon( uint16_t color ) {
     int ix = 300, iy = 220;
     int rIn = 3, rMid = 6, rOut = 8;
     tft.fillCircle( ix, iy, rMid, color );
-    tft.fillCircle( ix, iy, rIn, getBgColor() );
+    tft.fillCircle( ix, iy, rIn, getBgColorAt( iy ) );
     for ( int i = 0; i < 8; i++ ) {
-        float a = i * 45 * DEGTORAD_ICONS;
-        float aL = a - 0.2;
-        float aR = a + 0.2;
-        tft.fillTriangle( ix + cos( aL ) * rMid, iy + sin( aL ) * rMid, ix + cos( aR ) * rMid, iy + sin( aR ) * rMid, ix + cos( a ) * rOut, iy + sin( a ) * rOut, color );
+        int32_t a  = i * 45 * TRIG_DIV;
+        int32_t aL = a - 115;   // ±0.2 rad ≈ ±11.5°
+        int32_t aR = a + 115;
+        tft.fillTriangle( polarX( ix, rMid, aL ), polarY( iy, rMid, aL ), polarX( ix, rMid, aR ), polarY( iy, rMid, aR ), polarX( ix, rOut, a ), polarY( iy, rOut, a ), color );
     }
 }
 
@@ -412,21 +283,7 @@ void drawArrowUp( int x, int y, uint16_t color ) {
 
 void fillGradientVertical( int x, int y, int w, int h, uint16_t colorTop, uint16_t colorBottom ) {
     for ( int i = 0; i < h; i++ ) {
-        uint8_t r1 = ( colorTop >> 11 ) & 0x1F;
-        uint8_t g1 = ( colorTop >> 5 ) & 0x3F;
-        uint8_t b1 = colorTop & 0x1F;
-
-        uint8_t r2 = ( colorBottom >> 11 ) & 0x1F;
-        uint8_t g2 = ( colorBottom >> 5 ) & 0x3F;
-        uint8_t b2 = colorBottom & 0x1F;
-
-        float ratio = ( float )i / h;
-        uint8_t r = r1 + ( r2 - r1 ) * ratio;
-        uint8_t g = g1 + ( g2 - g1 ) * ratio;
-        uint8_t b = b1 + ( b2 - b1 ) * ratio;
-
-        uint16_t color = ( r << 11 ) | ( g << 5 ) | b;
-        tft.drawFastHLine( x, y + i, w, color );
+        tft.drawFastHLine( x, y + i, w, blendColor565( colorTop, colorBottom, i, h ) );
     }
 }
 
@@ -3,11 +3,10 @@
 #include <Arduino.h>
 #include <TFT_eSPI.h>
 
-// --- Weather icon primitives ---
-void drawCloudVector( int x, int y, uint32_t color );
+// --- Weather icons (pre-rasterised, see scripts/gen_weather_icons.py) ---
 void drawWeatherIconVector( int code, int x, int y );
 void drawWeatherIconVectorSmall( int code, int x, int y );
-void drawMoonPhaseIcon( int mx, int my, int r, int phase, uint16_t textColor, uint16_t bgColor );
+void drawMoonPhaseIcon( int mx, int my, int r, int bucket, uint16_t textColor );  // bucket: moonCycleBucket()
 
 // --- Status indicators ---
 void drawWifiIndicator();
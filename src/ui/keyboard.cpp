@@ -0,0 +1,338 @@
+#include "keyboard.h"
+#include "gfx_stats.h"
+#include "theme.h"
+
+#include <TFT_eSPI.h>
+
+#include "../util/constants.h"
+#include "../util/scheduler.h"
+
+// ---------------------------------------------------------------------------
+// Externs – defined in main.cpp
+// ---------------------------------------------------------------------------
+extern DisplayTFT  tft;
+extern bool        keyboardNumbers;
+extern bool        keyboardShift;
+extern ScreenState currentState;
+
+// ---------------------------------------------------------------------------
+
+static const char *const ALPHA_ROWS[ 3 ]  = { "qwertyuiop", "asdfghjkl", "zxcvbnm" };
+static const char *const SYMBOL_ROWS[ 3 ] = { "1234567890", "!@#$%^&*(/", ")-_+=.,?" };
+
+// Layout (unchanged from the per-screen keyboards it replaces)
+static constexpr int KEY_PITCH_X = 29;
+static constexpr int KEY_PITCH_Y = 30;
+static constexpr int KEY_SIZE    = 26;
+static constexpr int KEY_TOP     = 80;
+static constexpr int SPACE_Y     = 170;
+static constexpr int SPACE_H     = 25;
+static constexpr int FN_Y        = 198;
+static constexpr int FN_H        = 35;
+static constexpr int FN_W        = 64;
+
+// Character keys are row * 10 + column; the rest follow
+enum KeyId : int {
+    KEY_NONE  = -1,
+    KEY_SPACE = 100,
+    KEY_SHIFT, KEY_NUMBERS, KEY_DEL, KEY_LEFT, KEY_RIGHT,   // Function row, left to right
+    KEY_REVEAL
+};
+
+static ScreenState   owner       = CLOCK;
+static KbConfig      cfg         = {};
+static void flashDone();
+
+static int           flashKey    = KEY_NONE;
+static SchedJob      flashJob    = { "kb-flash", flashDone };
+
+static const char *rowChars( int r ) {
+    return ( keyboardNumbers ? SYMBOL_ROWS : ALPHA_ROWS )[ r ];
+}
+
+static int rowLen( int r ) {
+    return strlen( rowChars( r ) );
+}
+
+static void keyRect( int key, int &x, int &y, int &w, int &h ) {
+    if ( key < KEY_SPACE ) {
+        x = ( key % 10 ) * KEY_PITCH_X + 2;
+        y = KEY_TOP + ( key / 10 ) * KEY_PITCH_Y;
+        w = h = KEY_SIZE;
+    }
+    else if ( key == KEY_SPACE ) {
+        x = 2;
+        y = SPACE_Y;
+        w = 316;
+        h = SPACE_H;
+    }
+    else if ( key == KEY_REVEAL ) {
+        x = 250;
+        y = 140;
+        w = 60;
+        h = 25;
+    }
+    else {
+        x = ( key - KEY_SHIFT ) * FN_W + 2;
+        y = FN_Y;
+        w = FN_W - 4;
+        h = FN_H;
+    }
+}
+
+static const char *keyLabel( int key, char *buf ) {
+    if ( key < KEY_SPACE ) {
+        char ch = rowChars( key / 10 )[ key % 10 ];
+        buf[ 0 ] = ( keyboardShift && !keyboardNumbers ) ? toupper( ch ) : ch;
+        buf[ 1 ] = '\0';
+        return buf;
+    }
+    switch ( key ) {
+        case KEY_SPACE:
+            return "Space";
+        case KEY_SHIFT:
+            return "Shift";
+        case KEY_NUMBERS:
+            return "123";
+        case KEY_DEL:
+            return "Del";
+        case KEY_LEFT:
+            return cfg.leftLabel;
+        case KEY_RIGHT:
+            return cfg.rightLabel;
+        default:
+            return cfg.masked ? "Show" : "Hide";
+    }
+}
+
+static uint16_t keyOutline( int key ) {
+    if ( key == KEY_LEFT ) {
+        return cfg.leftColor;
+    }
+    if ( key == KEY_RIGHT ) {
+        return cfg.rightColor;
+    }
+    return theme().keyBorder;
+}
+
+static uint16_t keyInk( int key ) {
+    if ( key == KEY_LEFT || key == KEY_RIGHT ) {
+        return keyOutline( key );
+    }
+    if ( key >= KEY_SHIFT && key <= KEY_DEL ) {
+        return theme().keyText;
+    }
+    return getTextColor();
+}
+
+// Everything inside the outline; a pressed key is drawn inverted
+static void drawKeyFace( int key, bool pressed ) {
+    int  x, y, w, h;
+    char buf[ 2 ];
+    keyRect( key, x, y, w, h );
+    uint16_t ink = keyInk( key );
+    tft.fillRect( x + 1, y + 1, w - 2, h - 2, pressed ? ink : getBgColor() );
+    tft.setFreeFont( &FreeSans9pt7b );
+    tft.setTextDatum( MC_DATUM );
+    tft.setTextColor( pressed ? getBgColor() : ink );
+    tft.drawString( keyLabel( key, buf ), x + w / 2, y + h / 2 + ( key < KEY_SPACE ? 2 : 1 ) );
+}
+
+static void drawKey( int key ) {
+    int x, y, w, h;
+    keyRect( key, x, y, w, h );
+    tft.drawRect( x, y, w, h, keyOutline( key ) );
+    drawKeyFace( key, false );
+}
+
+// Character key faces after Shift / 123. Rows differ in length between the
+// letter and symbol sets, so keys that appear or vanish get outlines drawn or erased.
+static void redrawCharKeys( const int oldLen[ 3 ] ) {
+    GFX_SCOPE( "kbKeys" );
+    for ( int r = 0; r < 3; r++ ) {
+        int len = rowLen( r );
+        for ( int i = 0; i < max( len, oldLen[ r ] ); i++ ) {
+            int key = r * 10 + i;
+            if ( i >= len ) {
+                int x, y, w, h;
+                keyRect( key, x, y, w, h );
+                tft.fillRect( x, y, w, h, getBgColor() );
+            }
+            else if ( i >= oldLen[ r ] ) {
+                drawKey( key );
+            }
+            else {
+                drawKeyFace( key, false );
+            }
+        }
+    }
+}
+
+static void drawField() {
+    GFX_SCOPE( "kbField" );
+    tft.fillRect( 11, 41, 298, 28, getBgColor() );
+    tft.setFreeFont( &FreeSans9pt7b );
+    tft.setTextColor( getTextColor() );
+    tft.setTextDatum( ML_DATUM );
+    if ( cfg.masked ) {
+        String stars;
+        stars.reserve( cfg.text->length() );
+        for ( unsigned i = 0; i < cfg.text->length(); i++ ) {
+            stars += '*';
+        }
+        tft.drawString( stars, 20, 55 );
+    }
+    else {
+        tft.drawString( *cfg.text, 20, 55 );
+    }
+}
+
+static void endFlash() {
+    if ( flashKey != KEY_NONE ) {
+        drawKeyFace( flashKey, false );
+        flashKey = KEY_NONE;
+    }
+}
+
+static void flash( int key ) {
+    drawKeyFace( key, true );
+    flashKey   = key;
+    schedAfter( flashJob, KB_FLASH_MS );
+}
+
+static int keyAt( int x, int y ) {
+    if ( cfg.revealKey && x >= 250 && x <= 310 && y >= 140 && y <= 165 ) {
+        return KEY_REVEAL;
+    }
+    // Character rows hit-test on the full 29 × 30 cell so there are no dead gaps
+    if ( y >= KEY_TOP && y < KEY_TOP + 3 * KEY_PITCH_Y ) {
+        int r = ( y - KEY_TOP ) / KEY_PITCH_Y;
+        int i = x / KEY_PITCH_X;
+        return i < rowLen( r ) ? r * 10 + i : KEY_NONE;
+    }
+    if ( y >= SPACE_Y && y <= SPACE_Y + SPACE_H ) {
+        return KEY_SPACE;
+    }
+    if ( y >= FN_Y && y <= FN_Y + FN_H ) {
+        return KEY_SHIFT + min( x / FN_W, 4 );
+    }
+    return KEY_NONE;
+}
+
+void kbBegin( ScreenState screen, const KbConfig &config ) {
+    GFX_SCOPE( "kbBegin" );
+    owner       = screen;
+    cfg         = config;
+    flashKey    = KEY_NONE;
+
+    tft.fillScreen( getBgColor() );
+    tft.setTextColor( getTextColor() );
+    tft.setTextDatum( MC_DATUM );
+    tft.setFreeFont( &FreeSansBold12pt7b );
+    tft.drawString( cfg.title, 160, 20 );
+
+    tft.drawRect( 10, 40, 300, 30, theme().keyText );
+    drawField();
+
+    for ( int r = 0; r < 3; r++ ) {
+        for ( int i = 0; i < rowLen( r ); i++ ) {
+            drawKey( r * 10 + i );
+        }
+    }
+    for ( int key = KEY_SPACE; key <= KEY_RIGHT; key++ ) {
+        drawKey( key );
+    }
+    if ( cfg.revealKey ) {
+        drawKey( KEY_REVEAL );
+    }
+}
+
+KbResult kbTouch( int x, int y, TouchEventType type ) {
+    // The main loop calls in for every event while the panel is held; only the
+    // press acts. A finger still down from the previous screen sends no TOUCH_DOWN.
+    if ( type != TOUCH_DOWN ) {
+        return KB_NONE;
+    }
+
+    [[maybe_unused]] uint32_t t0 = micros();   // Log only
+    endFlash();
+    int key = keyAt( x, y );
+    if ( key == KEY_NONE ) {
+        return KB_NONE;
+    }
+
+    int oldLen[ 3 ] = { rowLen( 0 ), rowLen( 1 ), rowLen( 2 ) };
+    switch ( key ) {
+        case KEY_LEFT:
+            return KB_LEFT;
+
+        case KEY_RIGHT:
+            return KB_RIGHT;
+
+        case KEY_REVEAL:
+            return KB_REVEAL;
+
+        case KEY_SHIFT:
+            keyboardShift = !keyboardShift;
+            if ( !keyboardNumbers ) {
+                redrawCharKeys( oldLen );
+            }
+            break;
+
+        case KEY_NUMBERS:
+            keyboardNumbers = !keyboardNumbers;
+            redrawCharKeys( oldLen );
+            break;
+
+        case KEY_DEL:
+            if ( cfg.text->length() > 0 ) {
+                cfg.text->remove( cfg.text->length() - 1 );
+                drawField();
+            }
+            flash( key );
+            break;
+
+        case KEY_SPACE:
+            *cfg.text += ' ';
+            drawField();
+            flash( key );
+            break;
+
+        default: {
+            char buf[ 2 ];
+            *cfg.text += keyLabel( key, buf );
+            drawField();
+            if ( cfg.oneShotShift && keyboardShift ) {
+                keyboardShift = false;
+                if ( !keyboardNumbers ) {
+                    redrawCharKeys( oldLen );
+                }
+            }
+            flash( key );
+            break;
+        }
+    }
+    log_d( "[KBD] Key to pixels %lu us", ( unsigned long )( micros() - t0 ) );
+    return KB_NONE;
+}
+
+void kbSetMasked( bool masked ) {
+    cfg.masked = masked;
+    drawField();
+    if ( cfg.revealKey ) {
+        drawKeyFace( KEY_REVEAL, false );
+    }
+}
+
+bool kbActive() {
+    return cfg.text != nullptr && currentState == owner;
+}
+
+// flashJob: restores the flashed key once KB_FLASH_MS is up
+static void flashDone() {
+    if ( !kbActive() ) {
+        flashKey = KEY_NONE;    // Screen changed under the flash
+        return;
+    }
+    endFlash();
+}
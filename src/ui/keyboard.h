@@ -0,0 +1,43 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "../data/app_state.h"
+#include "../hal/touch.h"
+
+// ---------------------------------------------------------------------------
+// On-screen keyboard shared by the WiFi password, SSID and custom city /
+// country entry screens
+//
+// kbBegin() draws the whole layout once. After that a keystroke repaints
+// only the text field, Shift / 123 repaint only the key faces, and the
+// pressed key flashes until a scheduler job (or the next press) restores it.
+// A key acts on TOUCH_DOWN only, so a held key does not repeat and two quick
+// taps are two keystrokes; typing is not held to the main loop's touch
+// debounce. Keystroke-to-pixels time is logged at debug level.
+// ---------------------------------------------------------------------------
+
+// What a press asks the owning screen to do; text editing is handled here
+enum KbResult : uint8_t {
+    KB_NONE,        // No key, a repeat of the held key, or an edit already applied
+    KB_LEFT,        // Fourth function key (Back / SRCH)
+    KB_RIGHT,       // Fifth function key (OK / BACK)
+    KB_REVEAL       // Show / Hide button (password entry only)
+};
+
+struct KbConfig {
+    const char *title;
+    String     *text;           // Edited in place
+    const char *leftLabel;
+    uint16_t    leftColor;
+    const char *rightLabel;
+    uint16_t    rightColor;
+    bool        revealKey;      // Draw the Show / Hide button
+    bool        masked;         // Field shows one '*' per character
+    bool        oneShotShift;   // Shift releases after one character
+};
+
+void     kbBegin( ScreenState owner, const KbConfig &cfg );    // Full draw; reads keyboardShift / keyboardNumbers
+KbResult kbTouch( int x, int y, TouchEventType type );    // Acts on TOUCH_DOWN
+void     kbSetMasked( bool masked );    // Repaints the field and the Show / Hide label
+bool     kbActive();                    // The keyboard is the current screen
@@ -0,0 +1,299 @@
+#include "screen_lists.h"
+#include "icons.h"
+
+#include "../data/app_state.h"
+
+// Globals defined in main.cpp
+extern float       lat;
+extern float       lon;
+extern String      cityName;
+extern bool        regionAutoMode;
+extern bool        manualDstActive;
+extern long        gmtOffset_sec;
+extern const char *FIRMWARE_VERSION;
+extern String      availableVersion;
+extern bool        updateAvailable;
+extern int         otaInstallMode;
+
+// One half of a two-way choice: the active half filled green with white text,
+// the other outlined blue with theme text. Text is centred in the button.
+static void recordChoiceHalf( DisplayList &dl, int x, int y, int w, int h, int r, const char *text, bool active,
+                              bool paper ) {
+    if ( active ) {
+        dlPen( dl, TFT_GREEN );
+        dlFillRoundRect( dl, x, y, w, h, r );
+        dlInk( dl, TFT_WHITE );
+        if ( paper ) {
+            dlPaper( dl, TFT_GREEN );
+        }
+    }
+    else {
+        dlPen( dl, TFT_BLUE );
+        dlDrawRoundRect( dl, x, y, w, h, r );
+        dlInkRole( dl, &ThemePalette::text );
+        if ( paper ) {
+            dlPaperRole( dl, &ThemePalette::bg );
+        }
+    }
+    dlText( dl, text, x + w / 2, y + h / 2 );
+}
+
+// Left / right choice driven by a flag slot (true = right half active)
+static void recordChoice( DisplayList &dl, DlFlagFn right, int x, int y, int w, int h, int r, int gap,
+                          const char *leftText, const char *rightText, bool paper ) {
+    dlIf( dl, right );
+    recordChoiceHalf( dl, x, y, w, h, r, leftText, false, paper );
+    recordChoiceHalf( dl, x + w + gap, y, w, h, r, rightText, true, paper );
+    dlElse( dl );
+    recordChoiceHalf( dl, x, y, w, h, r, leftText, true, paper );
+    recordChoiceHalf( dl, x + w + gap, y, w, h, r, rightText, false, paper );
+    dlEndIf( dl );
+}
+
+// ---------------------------------------------------------------------------
+// Weather
+// ---------------------------------------------------------------------------
+
+static bool unitF() {
+    return app.units.tempF;
+}
+
+static bool unitMph() {
+    return app.units.windMph;
+}
+
+static bool unitInHg() {
+    return app.units.pressureInHg;
+}
+
+static void weatherCityText( char *buf, size_t len ) {
+    String cityDisp = ( cityName == "" ) ? "Not set (Use Regional)" : cityName;
+    if ( cityDisp.length() > 22 ) {
+        cityDisp = cityDisp.substring( 0, 19 ) + "...";
+    }
+    snprintf( buf, len, "%s", cityDisp.c_str() );
+}
+
+static void weatherCoordText( char *buf, size_t len ) {
+    snprintf( buf, len, "Coord: %.2f, %.2f", lat, lon );
+}
+
+void recordWeatherScreen( DisplayList &dl ) {
+    dlBegin( dl );
+    dlPenRole( dl, &ThemePalette::bg );
+    dlFillScreen( dl );
+
+    // Title and city
+    dlFreeFont( dl, &FreeSans12pt7b );
+    dlInk( dl, TFT_ORANGE );
+    dlPaperRole( dl, &ThemePalette::bg );
+    dlDatum( dl, TC_DATUM );
+    dlText( dl, "Weather Settings", 160, 5 );
+    dlFreeFont( dl, &FreeSans9pt7b );
+    dlInk( dl, TFT_SKYBLUE );
+    dlPaperRole( dl, &ThemePalette::bg );
+    dlTextSlot( dl, weatherCityText, 160, 38 );
+
+    // Three unit columns
+    dlFont( dl, 1 );
+    dlDatum( dl, MC_DATUM );
+    dlInkRole( dl, &ThemePalette::text );
+    dlPaperRole( dl, &ThemePalette::bg );
+    dlText( dl, "Temperature", 50, 68 );
+    dlText( dl, "Wind speed", 160, 68 );
+    dlText( dl, "Pressure", 270, 68 );
+    recordChoice( dl, unitF, 8, 80, 38, 20, 3, 4, "C", "F", true );
+    recordChoice( dl, unitMph, 115, 80, 38, 20, 3, 4, "km/h", "mph", true );
+    recordChoice( dl, unitInHg, 222, 80, 38, 20, 3, 4, "hPa", "inHg", true );
+
+    // Coordinates + EDIT
+    dlInkRole( dl, &ThemePalette::text );
+    dlPaperRole( dl, &ThemePalette::bg );
+    dlDatum( dl, ML_DATUM );
+    dlTextSlot( dl, weatherCoordText, 8, 118 );
+    dlPen( dl, TFT_SKYBLUE );
+    dlDrawRoundRect( dl, 232, 110, 60, 16, 3 );
+    dlInk( dl, TFT_SKYBLUE );
+    dlPaperRole( dl, &ThemePalette::bg );
+    dlDatum( dl, MC_DATUM );
+    dlText( dl, "EDIT", 262, 118 );
+
+    dlInkRole( dl, &ThemePalette::text );
+    dlPaperRole( dl, &ThemePalette::bg );
+    dlText( dl, "Updates every 30 min", 160, 138 );
+
+    dlPen( dl, TFT_DARKGREY );
+    dlFillRoundRect( dl, 40, 152, 240, 16, 4 );
+    dlInk( dl, TFT_WHITE );
+    dlText( dl, "BACK TO SETTINGS", 160, 160 );
+    dlEnd( dl );
+}
+
+// ---------------------------------------------------------------------------
+// Regional
+// ---------------------------------------------------------------------------
+
+static bool regionManual() {
+    return !regionAutoMode;
+}
+
+static bool dstActive() {
+    return manualDstActive;
+}
+
+static void regionalCityText( char *buf, size_t len ) {
+    snprintf( buf, len, "%s", cityName != "" ? cityName.c_str() : "---" );
+}
+
+static void regionalTzText( char *buf, size_t len ) {
+    snprintf( buf, len, "%+ldh", gmtOffset_sec / 3600 );
+}
+
+void recordRegionalScreen( DisplayList &dl ) {
+    dlBegin( dl );
+    dlPenRole( dl, &ThemePalette::bg );
+    dlFillScreen( dl );
+    dlInkRole( dl, &ThemePalette::text );
+    dlDatum( dl, MC_DATUM );
+    dlFont( dl, 4 );
+    dlText( dl, "REGIONAL SETUP", 160, 30 );
+
+    dlFont( dl, 2 );
+    recordChoice( dl, regionManual, 105, 45, 50, 30, 4, 10, "AUTO", "MANUAL", false );
+
+    dlDatum( dl, ML_DATUM );
+    dlInkRole( dl, &ThemePalette::text );
+    dlText( dl, "City", 40, 110 );
+    dlInk( dl, TFT_SKYBLUE );
+    dlTextSlot( dl, regionalCityText, 40, 130 );
+    dlInkRole( dl, &ThemePalette::text );
+    dlText( dl, "Timezone", 40, 160 );
+    dlInk( dl, TFT_SKYBLUE );
+    dlTextSlot( dl, regionalTzText, 40, 180 );
+
+    // Manual offset +/- and DST
+    dlIf( dl, regionManual );
+    dlDatum( dl, MC_DATUM );
+    dlPen( dl, TFT_GREEN );
+    dlDrawRoundRect( dl, 120, 172, 28, 16, 3 );
+    dlInk( dl, TFT_GREEN );
+    dlText( dl, "+", 134, 180 );
+    dlDrawRoundRect( dl, 155, 172, 28, 16, 3 );
+    dlText( dl, "-", 169, 180 );
+    dlIf( dl, dstActive );
+    dlPen( dl, TFT_ORANGE );
+    dlFillRoundRect( dl, 195, 172, 72, 16, 3 );
+    dlInk( dl, TFT_WHITE );
+    dlText( dl, "DST: ON", 231, 180 );
+    dlElse( dl );
+    dlPenRole( dl, &ThemePalette::text );
+    dlDrawRoundRect( dl, 195, 172, 72, 16, 3 );
+    dlInkRole( dl, &ThemePalette::text );
+    dlText( dl, "DST: OFF", 231, 180 );
+    dlEndIf( dl );
+    dlDatum( dl, ML_DATUM );
+    dlEndIf( dl );
+
+    // SYNC / EDIT and Back keep the ink of whatever was drawn last
+    dlDatum( dl, MC_DATUM );
+    dlPen( dl, TFT_GREEN );
+    dlDrawRoundRect( dl, 40, 205, 105, 30, 6 );
+    dlIf( dl, regionManual );
+    dlText( dl, "EDIT", 92, 220 );
+    dlElse( dl );
+    dlText( dl, "SYNC", 92, 220 );
+    dlEndIf( dl );
+    dlPen( dl, TFT_RED );
+    dlDrawRoundRect( dl, 155, 205, 105, 30, 6 );
+    dlText( dl, "Back", 207, 220 );
+    dlEnd( dl );
+}
+
+// ---------------------------------------------------------------------------
+// Firmware
+// ---------------------------------------------------------------------------
+
+static bool hasNewVersion() {
+    return availableVersion != "" && updateAvailable;
+}
+
+static bool installAvailable() {
+    return updateAvailable;
+}
+
+static bool otaModeAuto() {
+    return otaInstallMode == 0;
+}
+
+static bool otaModeByUser() {
+    return otaInstallMode == 1;
+}
+
+static void availableVersionText( char *buf, size_t len ) {
+    snprintf( buf, len, "%s", availableVersion.c_str() );
+}
+
+static void drawFirmwareBack() {
+    drawArrowBack( 230, 125, TFT_RED );
+}
+
+void recordFirmwareScreen( DisplayList &dl ) {
+    dlBegin( dl );
+    dlClear( dl );
+    dlInkRole( dl, &ThemePalette::text );
+    dlDatum( dl, MC_DATUM );
+    dlFont( dl, 4 );
+    dlText( dl, "FIRMWARE", 160, 30 );
+
+    // Versions
+    dlDatum( dl, ML_DATUM );
+    dlFont( dl, 2 );
+    dlText( dl, "Current version:", 10, 60 );
+    dlInk( dl, TFT_GREEN );
+    dlText( dl, FIRMWARE_VERSION, 160, 60 );
+    dlInkRole( dl, &ThemePalette::text );
+    dlText( dl, "Available:", 10, 85 );
+    dlIf( dl, hasNewVersion );
+    dlInk( dl, TFT_ORANGE );
+    dlTextSlot( dl, availableVersionText, 160, 85 );
+    dlElse( dl );
+    dlInk( dl, TFT_DARKGREY );
+    dlText( dl, "-", 160, 85 );
+    dlEndIf( dl );
+
+    // Install mode radio buttons (Auto and By user only)
+    dlInkRole( dl, &ThemePalette::text );
+    dlText( dl, "Install mode:", 10, 120 );
+    const char *modes[ 2 ]    = { "Auto", "By user" };
+    DlFlagFn    selected[ 2 ] = { otaModeAuto, otaModeByUser };
+    for ( int i = 0; i < 2; i++ ) {
+        int btnY = 145 + i * 25;
+        dlPenRole( dl, &ThemePalette::text );
+        dlDrawCircle( dl, 20, btnY, 6 );
+        dlIf( dl, selected[ i ] );
+        dlPen( dl, TFT_GREEN );
+        dlFillCircle( dl, 20, btnY, 4 );
+        dlEndIf( dl );
+        dlInkRole( dl, &ThemePalette::text );
+        dlText( dl, modes[ i ], 35, btnY );
+    }
+
+    // Check Now / Install
+    dlDatum( dl, MC_DATUM );
+    dlIf( dl, installAvailable );
+    dlPen( dl, TFT_GREEN );
+    dlFillRoundRect( dl, 10, 190, 140, 30, 5 );
+    dlInk( dl, TFT_BLACK );
+    dlText( dl, "INSTALL", 80, 205 );
+    dlElse( dl );
+    dlPen( dl, TFT_BLUE );
+    dlFillRoundRect( dl, 10, 190, 140, 30, 5 );
+    dlInk( dl, TFT_WHITE );
+    dlText( dl, "CHECK NOW", 80, 205 );
+    dlEndIf( dl );
+
+    dlPen( dl, TFT_RED );
+    dlDrawRoundRect( dl, 230, 125, 50, 50, 4 );
+    dlCall( dl, drawFirmwareBack );
+    dlEnd( dl );
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "display_list.h"
+
+// ---------------------------------------------------------------------------
+// Display-list recordings of the Weather, Regional and Firmware screens
+//
+// screens.cpp records each list on the screen's first draw and replays it
+// after that. The recordings only read state (units, location, OTA), so they
+// build on the host too, where host/screens_direct.cpp checks every replay
+// against the direct drawing code across themes and flag states.
+// ---------------------------------------------------------------------------
+
+void recordWeatherScreen( DisplayList &dl );
+void recordRegionalScreen( DisplayList &dl );
+void recordFirmwareScreen( DisplayList &dl );
@@ -1,6 +1,12 @@
 #include "screens.h"
+#include "screen_lists.h"
+#include "gfx_stats.h"
 #include "theme.h"
+#include "theme_fade.h"
 #include "icons.h"
+#include "keyboard.h"
+#include "vlist.h"
+#include "widgets.h"
 
 #include <WiFi.h>
 #include <TFT_eSPI.h>
@@ -11,18 +17,16 @@
 #include "../data/app_state.h"
 #include "../data/city_data.h"
 #include "../data/nameday.h"
+#include "../hal/backlight.h"
+#include "../hal/touch.h"
 #include "../net/ota.h"
 
 // ---------------------------------------------------------------------------
 // Externs - defined in main.cpp
 // ---------------------------------------------------------------------------
-extern TFT_eSPI tft;
+extern DisplayTFT tft;
 extern bool     isWhiteTheme;
 extern int      themeMode;
-extern uint16_t blueLight;
-extern uint16_t blueDark;
-extern uint16_t yellowLight;
-extern uint16_t yellowDark;
 
 // Layout
 extern const int MENU_BASE_Y;
@@ -56,11 +60,8 @@ extern String    lookupCity;
 extern String    lookupTimezone;
 extern int       lookupGmtOffset;
 extern int       lookupDstOffset;
-extern float     lat;
-extern float     lon;
 extern String    cityName;
 extern String    countryName;
-extern bool      regionAutoMode;
 extern bool      manualDstActive;
 extern RecentCity recentCities[];
 extern int       recentCount;
@@ -68,17 +69,9 @@ extern String    customCityInput;
 extern String    customCountryInput;
 extern String    weatherCity;
 
-// Weather units
-extern bool weatherUnitF;
-extern bool weatherUnitMph;
-extern bool weatherUnitInHg;
-
 // OTA / firmware
-extern const char *FIRMWARE_VERSION;
-extern String      availableVersion;
 extern String      downloadURL;
 extern bool        updateAvailable;
-extern int         otaInstallMode;
 extern bool        isUpdating;
 extern int         updateProgress;
 extern String      updateStatus;
@@ -91,18 +84,10 @@ extern int  autoDimStart;
 extern int  autoDimEnd;
 extern int  autoDimLevel;
 
-// Touch calibration
-extern XPT2046_Touchscreen ts;
-extern int touchXMin;
-extern int touchXMax;
-extern int touchYMin;
-extern int touchYMax;
-extern int touchXMinF;
-extern int touchXMaxF;
-extern int touchYMinF;
-extern int touchYMaxF;
+// Display
 extern bool invertColors;
 extern bool displayFlipped;
+extern bool dayNightTheme;
 
 // State / prefs
 extern ScreenState currentState;
@@ -110,7 +95,6 @@ extern Preferences prefs;
 
 // Clock / digital clock state
 extern bool isDigitalClock;
-extern long gmtOffset_sec;
 extern int  lastSec;
 
 // Coordinate edit buffers
@@ -122,7 +106,6 @@ extern bool   coordEditingLon;
 void   applyLocation();
 bool   lookupCountryGeonames( String countryName );
 bool   lookupCityGeonames( String cityName, String countryHint );
-void   getCountryCities( String countryName, String cities[], int &count );
 String obfuscatePassword( const String &plain );
 void   syncRegion();
 
@@ -133,6 +116,7 @@ void   syncRegion();
 // Called once from setup() after WiFi connects; stays on screen while NTP
 // syncs.  The first clock render blanks and rebuilds the display when ready.
 void drawLoadingScreen() {
+    GFX_SCOPE( "drawLoadingScreen" );
     tft.fillScreen( getBgColor() );
     tft.setTextDatum( MC_DATUM );
     tft.setTextColor( getTextColor() );
@@ -141,6 +125,7 @@ void drawLoadingScreen() {
 }
 
 void drawSyncOverlay( const String &msg, bool okButton ) {
+    GFX_SCOPE( "drawSyncOverlay" );
     // Overlay box — drawn on top of the Regional screen, no fillScreen
     const int bx = 50, by = 80, bw = 220, bh = 90;
     tft.fillRoundRect( bx, by, bw, bh, 8, getBgColor() );
@@ -184,7 +169,6 @@ void showWifiResultScreen( bool success ) {
         tft.setTextDatum( MC_DATUM );
         tft.drawString( "Connection FAILED", 160, 100, 2 );
     }
-    delay( UI_SPLASH_DELAY_MS );
 }
 
 void scanWifiNetworks() {
@@ -215,9 +199,10 @@ void scanWifiNetworks() {
 
 // ---------------------------------------------------------------------------
 // Touch calibration
-// Draw a 2-point calibration procedure and save results to NVS.
-// Reads raw ADC values from XPT2046 (bypassing the current mapping) and
-// computes new TOUCH_X_MIN/MAX / TOUCH_Y_MIN/MAX via linear extrapolation.
+// Five targets (corners inset, then the centre), raw ADC readings from the
+// touch task, and a least-squares affine fit (hal/touch_cal.h) saved to NVS
+// for the current orientation. The fit's residual is shown and logged; a fit
+// worse than TOUCH_CAL_MAX_PX keeps the previous calibration.
 // ---------------------------------------------------------------------------
 static void drawCalTarget( int cx, int cy, uint16_t color ) {
     tft.drawFastHLine( cx - 12, cy,      24, color );
@@ -225,102 +210,119 @@ static void drawCalTarget( int cx, int cy, uint16_t color ) {
     tft.drawCircle( cx, cy, 5, color );
 }
 
+// Blocks until the next complete press (down → up) with enough pressure and
+// returns its raw sample from about 40 ms in, once the reading has settled
 static TS_Point waitCalTouch() {
-    // Drain any held touch first
-    while ( ts.touched() ) {
-        delay( 10 );
-    }
-    // Wait for a new touch with sufficient pressure
-    TS_Point p;
+    TouchEvent ev;
+    TS_Point   p;
+    touchFlush();   // A press still held from the previous step is not a new one
     do {
-        while ( !ts.touched() ) {
-            delay( 10 );
-        }
-        delay( 40 );   // brief settle
-        p = ts.getPoint();
+        do {
+            while ( !touchNextEvent( ev, 50 ) ) {}
+        } while ( ev.type != TOUCH_DOWN );
+        p = TS_Point( ev.rawX, ev.rawY, ev.z );
+        uint32_t downUs  = ev.us;
+        bool     settled = false;
+        do {
+            while ( !touchNextEvent( ev, 50 ) ) {}
+            if ( ev.type == TOUCH_MOVE && !settled && ev.us - downUs >= 40000 ) {
+                p       = TS_Point( ev.rawX, ev.rawY, ev.z );
+                settled = true;
+            }
+        } while ( ev.type != TOUCH_UP );
     } while ( p.z < 200 );
-    while ( ts.touched() ) {
-        delay( 10 );    // wait for release
-    }
     return p;
 }
 
+// Saved matrix for the current orientation; else the other orientation's
+// turned 180°; else the old two-point range keys, whose defaults are the
+// factory mapping
+void loadTouchCal() {
+    const char *key   = displayFlipped ? "tcalF" : "tcal";
+    const char *other = displayFlipped ? "tcal" : "tcalF";
+    TouchCal    cal;
+    prefs.begin( "sys", true );
+    if ( prefs.isKey( key ) && prefs.getBytes( key, &cal, sizeof( cal ) ) == sizeof( cal ) ) {
+        log_d( "[CAL] Loaded %s", key );
+    }
+    else if ( prefs.isKey( other ) && prefs.getBytes( other, &cal, sizeof( cal ) ) == sizeof( cal ) ) {
+        touchCalRotate180( cal );
+        log_d( "[CAL] %s derived from %s", key, other );
+    }
+    else if ( displayFlipped ) {
+        touchCalFromRange( cal, prefs.getInt( "calXMinF", 3900 ), prefs.getInt( "calXMaxF", 200 ),
+                           prefs.getInt( "calYMinF", 3900 ), prefs.getInt( "calYMaxF", 200 ) );
+    }
+    else {
+        touchCalFromRange( cal, prefs.getInt( "calXMin", 200 ), prefs.getInt( "calXMax", 3900 ),
+                           prefs.getInt( "calYMin", 200 ), prefs.getInt( "calYMax", 3900 ) );
+    }
+    prefs.end();
+    touchSetCal( cal );
+}
+
 void runTouchCalibration() {
     const uint16_t BG = TFT_BLACK;
     const uint16_t FG = TFT_WHITE;
-    const int T1X = 20,  T1Y = 20;    // target 1 screen position
-    const int T2X = 300, T2Y = 220;   // target 2 screen position
-
-    // --- Step 1 ---
-    tft.fillScreen( BG );
-    tft.setTextColor( FG, BG );
-    tft.setTextDatum( MC_DATUM );
-    tft.drawString( "Touch Calibration", 160, 80, 2 );
-    tft.drawString( "Tap the cross", 160, 110, 2 );
-    drawCalTarget( T1X, T1Y, TFT_YELLOW );
-    delay( 300 );
+    static const int16_t TX[ TOUCH_CAL_POINTS ] = { 20, 300, 300,  20, 160 };   // Target screen positions
+    static const int16_t TY[ TOUCH_CAL_POINTS ] = { 20,  20, 220, 220, 120 };
+    int16_t rawX[ TOUCH_CAL_POINTS ], rawY[ TOUCH_CAL_POINTS ];
 
-    TS_Point p1 = waitCalTouch();
-    log_d( "[CAL] Point 1 raw: x=%d y=%d", p1.x, p1.y );
-
-    // --- Step 2 ---
-    tft.fillScreen( BG );
-    tft.setTextColor( FG, BG );
-    tft.setTextDatum( MC_DATUM );
-    tft.drawString( "Touch Calibration", 160, 80, 2 );
-    tft.drawString( "Tap the cross", 160, 110, 2 );
-    drawCalTarget( T2X, T2Y, TFT_YELLOW );
-    delay( 300 );
-
-    TS_Point p2 = waitCalTouch();
-    log_d( "[CAL] Point 2 raw: x=%d y=%d", p2.x, p2.y );
-
-    // --- Compute new mapping ---
-    // Linear extrapolation so that:
-    //   map(rawAtT1, xMin, xMax, 0, 320) == T1X
-    //   map(rawAtT2, xMin, xMax, 0, 320) == T2X
-    float scaleX = ( float )( p2.x - p1.x ) / ( float )( T2X - T1X );
-    float scaleY = ( float )( p2.y - p1.y ) / ( float )( T2Y - T1Y );
-
-    int newXMin = ( int )( p1.x - T1X * scaleX );
-    int newXMax = ( int )( p1.x + ( 320 - T1X ) * scaleX );
-    int newYMin = ( int )( p1.y - T1Y * scaleY );
-    int newYMax = ( int )( p1.y + ( 240 - T1Y ) * scaleY );
-
-    log_d( "[CAL] New mapping: X %d-%d  Y %d-%d", newXMin, newXMax, newYMin, newYMax );
-
-    // --- Apply immediately ---
-    touchXMin = newXMin;
-    touchXMax = newXMax;
-    touchYMin = newYMin;
-    touchYMax = newYMax;
-
-    // --- Persist to NVS in orientation-specific keyset ---
-    prefs.begin( "sys", false );
-    if ( displayFlipped ) {
-        prefs.putInt( "calXMinF", newXMin );
-        prefs.putInt( "calXMaxF", newXMax );
-        prefs.putInt( "calYMinF", newYMin );
-        prefs.putInt( "calYMaxF", newYMax );
+    for ( int i = 0; i < TOUCH_CAL_POINTS; i++ ) {
+        tft.fillScreen( BG );
+        tft.setTextColor( FG, BG );
+        tft.setTextDatum( MC_DATUM );
+        tft.drawString( "Touch Calibration", 160, 80, 2 );
+        tft.drawString( "Tap the cross  " + String( i + 1 ) + "/" + String( TOUCH_CAL_POINTS ), 160, 110, 2 );
+        drawCalTarget( TX[ i ], TY[ i ], TFT_YELLOW );
+        delay( 300 );
+
+        TS_Point p = waitCalTouch();
+        rawX[ i ]  = p.x;
+        rawY[ i ]  = p.y;
+        log_d( "[CAL] Point %d raw: x=%d y=%d", i + 1, p.x, p.y );
+    }
+
+    // --- Fit, and keep it only if every tap agrees with it ---
+    TouchCal    cal;
+    TouchCalFit fit    = { 0, 0 };
+    bool        solved = touchCalSolve( rawX, rawY, TX, TY, TOUCH_CAL_POINTS, cal, fit );
+    bool        ok     = solved && fit.max10 <= TOUCH_CAL_MAX_PX * 10;
+    if ( ok ) {
+        log_i( "[CAL] x = %ld*rx %+ld*ry %+ld, y = %ld*rx %+ld*ry %+ld (Q16); residual rms %u.%u px, max %u.%u px",
+               ( long )cal.a, ( long )cal.b, ( long )cal.c, ( long )cal.d, ( long )cal.e, ( long )cal.f,
+               fit.rms10 / 10, fit.rms10 % 10, fit.max10 / 10, fit.max10 % 10 );
+        touchSetCal( cal );
+        prefs.begin( "sys", false );
+        prefs.putBytes( displayFlipped ? "tcalF" : "tcal", &cal, sizeof( cal ) );
+        prefs.end();
     }
     else {
-        prefs.putInt( "calXMin",  newXMin );
-        prefs.putInt( "calXMax",  newXMax );
-        prefs.putInt( "calYMin",  newYMin );
-        prefs.putInt( "calYMax",  newYMax );
+        log_w( "[CAL] Rejected: %s, residual max %u.%u px", solved ? "taps disagree" : "points degenerate",
+               fit.max10 / 10, fit.max10 % 10 );
     }
-    prefs.end();
 
     // --- Done ---
+    char residual[ 40 ];
+    if ( solved ) {
+        snprintf( residual, sizeof( residual ), "Error: %u.%u px avg, %u.%u px max",
+                  fit.rms10 / 10, fit.rms10 % 10, fit.max10 / 10, fit.max10 % 10 );
+    }
+    else {
+        snprintf( residual, sizeof( residual ), "Taps did not span the screen" );
+    }
     tft.fillScreen( BG );
-    tft.setTextColor( TFT_GREEN, BG );
+    tft.setTextColor( ok ? TFT_GREEN : TFT_RED, BG );
     tft.setTextDatum( MC_DATUM );
-    tft.drawString( "Calibration saved!", 160, 110, 2 );
-    tft.drawString( "Returning to settings...", 160, 135, 2 );
+    tft.drawString( ok ? "Calibration saved!" : "Calibration failed", 160, 95, 2 );
+    tft.setTextColor( FG, BG );
+    tft.drawString( residual, 160, 120, 2 );
+    tft.drawString( "Returning to settings...", 160, 145, 2 );
     delay( 1500 );
 }
 
 void drawCoordInputScreen() {
+    GFX_SCOPE( "drawCoordInputScreen" );
     uint16_t bg = getBgColor();
     uint16_t txt = getTextColor();
     tft.fillScreen( bg );
@@ -352,8 +354,8 @@ void drawCoordInputScreen() {
         for ( int i = 0; i < len; i++ ) {
             int btnX = i * 29 + 2;
             int btnY = 65 + r * 30;
-            tft.drawRect( btnX, btnY, 26, 26, isWhiteTheme ? TFT_DARKGREY : TFT_WHITE );
-            tft.setTextColor( isWhiteTheme ? TFT_BLACK : TFT_WHITE );
+            tft.drawRect( btnX, btnY, 26, 26, theme().keyBorder );
+            tft.setTextColor( theme().keyText );
             tft.drawString( String( rows[ r ][ i ] ), btnX + 13, btnY + 15 );
         }
     }
@@ -364,8 +366,8 @@ void drawCoordInputScreen() {
     int by = 165;
     int bh = 35;
 
-    tft.setTextColor( isWhiteTheme ? TFT_BLACK : TFT_WHITE );
-    tft.drawRect( 5, by, bw - 5, bh, isWhiteTheme ? TFT_DARKGREY : TFT_WHITE );
+    tft.setTextColor( theme().keyText );
+    tft.drawRect( 5, by, bw - 5, bh, theme().keyBorder );
     tft.drawString( "DEL", 5 + ( bw - 5 ) / 2, by + 18 );
 
     tft.setTextColor( TFT_SKYBLUE );
@@ -380,10 +382,11 @@ void drawCoordInputScreen() {
     tft.drawRect( 3 * bw + 5, by, bw - 5, bh, TFT_ORANGE );
     tft.drawString( "BACK", 3 * bw + 5 + ( bw - 5 ) / 2, by + 18 );
 
-    tft.setTextColor( isWhiteTheme ? TFT_BLACK : TFT_WHITE );
+    tft.setTextColor( theme().keyText );
 }
 
 void drawCountryLookupConfirm() {
+    GFX_SCOPE( "drawCountryLookupConfirm" );
     tft.fillScreen( getBgColor() );
     tft.setTextColor( getTextColor() );
     tft.setTextDatum( MC_DATUM );
@@ -406,6 +409,7 @@ void drawCountryLookupConfirm() {
 }
 
 void drawCityLookupConfirm() {
+    GFX_SCOPE( "drawCityLookupConfirm" );
     tft.fillScreen( getBgColor() );
     tft.setTextColor( getTextColor() );
     tft.setTextDatum( MC_DATUM );
@@ -432,230 +436,140 @@ void drawCityLookupConfirm() {
 }
 
 void drawCustomCountryInput() {
-    tft.fillScreen( getBgColor() );
-    tft.setTextColor( getTextColor() );
-    tft.setTextDatum( MC_DATUM );
-    tft.setFreeFont( &FreeSansBold12pt7b );
-    tft.drawString( "Enter Country Name", 160, 20 );
-
-    tft.drawRect( 10, 40, 300, 30, isWhiteTheme ? TFT_BLACK : TFT_WHITE );
-    tft.setFreeFont( &FreeSans9pt7b );
-    tft.setTextDatum( ML_DATUM );
-    tft.drawString( customCountryInput, 20, 55 );
-
-    tft.setFreeFont( &FreeSans9pt7b );
-    tft.setTextDatum( MC_DATUM );
-
-    const char *rows[] = {"qwertyuiop", "asdfghjkl", "zxcvbnm"};
-    if ( keyboardNumbers ) {
-        rows[ 0 ] = "1234567890";
-        rows[ 1 ] = "!@#$%^&*(/";
-        rows[ 2 ] = ")-_+=.,?";
-    }
-
-    for ( int r = 0; r < 3; r++ ) {
-        int len = strlen( rows[ r ] );
-        for ( int i = 0; i < len; i++ ) {
-            int btnX = i * 29 + 2;
-            int btnY = 80 + r * 30;
-            tft.drawRect( btnX, btnY, 26, 26, isWhiteTheme ? TFT_DARKGREY : TFT_WHITE );
-            char ch = rows[ r ][ i ];
-            if ( keyboardShift && !keyboardNumbers ) {
-                ch = toupper( ch );
-            }
-            tft.drawString( String( ch ), btnX + 13, btnY + 15 );
-        }
-    }
-
-    tft.drawRect( 2, 170, 316, 25, isWhiteTheme ? TFT_DARKGREY : TFT_WHITE );
-    tft.setTextDatum( MC_DATUM );
-    tft.drawString( "Space", 160, 183 );
-
-    int bw = 64;
-    int by = 198;
-    int bh = 35;
-    tft.setTextColor( isWhiteTheme ? TFT_BLACK : TFT_WHITE );
-
-    tft.drawRect( 0 * bw + 2, by, bw - 4, bh, isWhiteTheme ? TFT_DARKGREY : TFT_WHITE );
-    tft.drawString( "Shift", 0 * bw + bw / 2, by + 18 );
-
-    tft.drawRect( 1 * bw + 2, by, bw - 4, bh, isWhiteTheme ? TFT_DARKGREY : TFT_WHITE );
-    tft.drawString( "123", 1 * bw + bw / 2, by + 18 );
-
-    tft.drawRect( 2 * bw + 2, by, bw - 4, bh, isWhiteTheme ? TFT_DARKGREY : TFT_WHITE );
-    tft.drawString( "Del", 2 * bw + bw / 2, by + 18 );
-
-    tft.setTextColor( TFT_GREEN );
-    tft.drawRect( 3 * bw + 2, by, bw - 4, bh, TFT_GREEN );
-    tft.drawString( "SRCH", 3 * bw + bw / 2, by + 18 );
-
-    tft.setTextColor( TFT_ORANGE );
-    tft.drawRect( 4 * bw + 2, by, bw - 4, bh, TFT_ORANGE );
-    tft.drawString( "BACK", 4 * bw + bw / 2, by + 18 );
-
-    tft.setTextColor( isWhiteTheme ? TFT_BLACK : TFT_WHITE );
+    GFX_SCOPE( "drawCustomCountryInput" );
+    kbBegin( CUSTOMCOUNTRYINPUT, { "Enter Country Name", &customCountryInput,
+                                   "SRCH", TFT_GREEN, "BACK", TFT_ORANGE, false, false, true } );
 }
 
+// ---------------------------------------------------------------------------
+// Settings menu (widget tree)
 // ---------------------------------------------------------------------------
 
-int getMenuItemY( int itemIndex ) {
-    return MENU_BASE_Y + itemIndex * MENU_ITEM_SPACING;
+static const char *const SETTINGS_ITEMS[]  = { "WiFi Setup", "Weather", "Regional", "Graphics", "Firmware", "Calibrate" };
+static const uint16_t    SETTINGS_COLORS[] = { TFT_BLUE, TFT_BLUE, TFT_BLUE, TFT_BLUE, TFT_BLUE, TFT_ORANGE };
+static constexpr int     SETTINGS_COUNT    = sizeof( SETTINGS_ITEMS ) / sizeof( SETTINGS_ITEMS[ 0 ] );
+static constexpr int     SETTINGS_ROWS     = 4;     // Items that fit on screen at once
+
+enum IconButton : uint8_t { ICON_BACK, ICON_UP, ICON_DOWN };
+
+static int settingsList = -1, settingsUp = -1, settingsDown = -1;
+
+// 50 × 50 arrow / back buttons down the right edge
+static void drawIconButton( const UiWidget &w ) {
+    const Rect &b = w.bounds;
+    tft.drawRoundRect( b.x, b.y, b.w, b.h, 4, w.color );
+    switch ( w.tag ) {
+        case ICON_UP:
+            drawArrowUp( b.x, b.y, w.color );
+            break;
+        case ICON_DOWN:
+            drawArrowDown( b.x, b.y, w.color );
+            break;
+        default:
+            drawArrowBack( b.x, b.y, w.color );
+            break;
+    }
 }
 
-bool isTouchInMenuItem( int x, int y, int itemIndex ) {
-    int yPos = getMenuItemY( itemIndex );
-    return ( x >= 40 && x <= 220 && y >= yPos && y <= yPos + MENU_ITEM_HEIGHT );
+static int addIconButton( int x, int y, IconButton icon, uint16_t color, UiEventFn onTap ) {
+    int id = uiAddButton( x, y, 50, 50, nullptr, color, onTap );
+    uiGet( id ).tag  = icon;
+    uiGet( id ).draw = drawIconButton;
+    return id;
 }
 
-void drawSettingsScreen() {
-    tft.fillScreen( getBgColor() );
-    tft.setTextColor( getTextColor() );
-    tft.setTextDatum( MC_DATUM );
-    tft.drawString( "SETTINGS", 160, 30, 4 );
-
-    String menuItems[] = {"WiFi Setup", "Weather", "Regional", "Graphics", "Firmware", "Calibrate"};
-    uint16_t colors[]  = {TFT_BLUE, TFT_BLUE, TFT_BLUE, TFT_BLUE, TFT_BLUE, TFT_ORANGE};
-
-    int totalItems   = 6;
-    int visibleItems = 4;  // How many fit on screen at once
+static void settingsScroll( int delta ) {
+    menuOffset = constrain( menuOffset + delta, 0, SETTINGS_COUNT - SETTINGS_ROWS );
+    uiSetValue( settingsList, menuOffset );
+    uiSetVisible( settingsUp, menuOffset > 0 );
+    uiSetVisible( settingsDown, menuOffset < SETTINGS_COUNT - SETTINGS_ROWS );
+}
 
-    for ( int i = 0; i < totalItems; i++ ) {
-        if ( i >= menuOffset && i < menuOffset + visibleItems ) {
-            int yPos = getMenuItemY( i - menuOffset );
-            tft.drawRoundRect( 40, yPos, 180, MENU_ITEM_HEIGHT, 6, colors[ i ] );
-            tft.drawRoundRect( 39, yPos - 1, 182, MENU_ITEM_HEIGHT + 2, 6, colors[ i ] ); // Thick border!
-            tft.fillRoundRect( 41, yPos + 1, 178, MENU_ITEM_HEIGHT - 2, 5, getBgColor() ); // Fill
-            tft.drawString( menuItems[ i ], 130, yPos + 17, 2 );
-        }
-    }
+static void onSettingsUp( int, int ) {
+    settingsScroll( -1 );
+}
 
-    // Up arrow (if not at start)
-    if ( menuOffset > 0 ) {
-        tft.drawRoundRect( 230, 70, 50, 50, 4, TFT_BLUE );
-        drawArrowUp( 230, 70, TFT_BLUE );
-    }
+static void onSettingsDown( int, int ) {
+    settingsScroll( 1 );
+}
 
-    // Back button
-    tft.drawRoundRect( 230, 125, 50, 50, 4, TFT_RED );
-    drawArrowBack( 230, 125, TFT_RED );
+static void onSettingsBack( int, int ) {
+    currentState = CLOCK;
+    lastSec      = -1;
+}
 
-    // Down arrow (if more than 4 items)
-    if ( menuOffset < ( totalItems - visibleItems ) ) {
-        tft.drawRoundRect( 230, 180, 50, 50, 4, TFT_BLUE );
-        drawArrowDown( 230, 180, TFT_BLUE );
+static void onSettingsItem( int, int item ) {
+    switch ( item ) {
+        case 0: // WiFi Setup
+            currentState = WIFICONFIG;
+            scanWifiNetworks();
+            wifiOffset = 0;
+            drawInitialSetup();
+            break;
+
+        case 1: // Weather
+            currentState = WEATHERCONFIG;
+            drawWeatherScreen();
+            break;
+
+        case 2: // Regional
+            currentState = REGIONALCONFIG;
+            drawRegionalScreen();
+            break;
+
+        case 3: // Graphics
+            currentState = GRAPHICSCONFIG;
+            drawGraphicsScreen();
+            break;
+
+        case 4: // Firmware
+            currentState = FIRMWARE_SETTINGS;
+            drawFirmwareScreen();
+            break;
+
+        case 5: // Calibrate
+            runTouchCalibration();
+            menuOffset = 0;
+            drawSettingsScreen();
+            break;
     }
 }
 
-void drawWeatherScreen() {
-    uint16_t bg = getBgColor();
-    uint16_t txt = getTextColor();
-    tft.fillScreen( bg );
+void drawSettingsScreen() {
+    GFX_SCOPE( "drawSettingsScreen" );
+    uiBeginScreen( SETTINGS );
+    uiAddLabel( 60, 18, 200, 24, "SETTINGS", 4, MC_DATUM );
 
-    // ===== NADPIS =====
-    tft.setFreeFont( &FreeSans12pt7b );
-    tft.setTextColor( TFT_ORANGE, bg );
-    tft.setTextDatum( TC_DATUM );
-    tft.drawString( "Weather Settings", 160, 5 );
+    settingsList = uiAddList( 40, MENU_BASE_Y, 180, SETTINGS_ITEMS, SETTINGS_COUNT, SETTINGS_ROWS,
+                              MENU_ITEM_HEIGHT, MENU_ITEM_SPACING, onSettingsItem );
+    uiGet( settingsList ).itemColors = SETTINGS_COLORS;
 
-    // ===== MĚSTO =====
-    tft.setFreeFont( &FreeSans9pt7b );
-    tft.setTextColor( TFT_SKYBLUE, bg );
-    tft.setTextDatum( TC_DATUM );
-    String cityDisp = ( cityName == "" ) ? "Not set (Use Regional)" : cityName;
-    if ( cityDisp.length() > 22 ) {
-        cityDisp = cityDisp.substring( 0, 19 ) + "...";
-    }
-    tft.drawString( cityDisp, 160, 38 );
+    settingsUp   = addIconButton( 230, 70, ICON_UP, TFT_BLUE, onSettingsUp );
+    addIconButton( 230, 125, ICON_BACK, TFT_RED, onSettingsBack );
+    settingsDown = addIconButton( 230, 180, ICON_DOWN, TFT_BLUE, onSettingsDown );
 
-    tft.setFreeFont( NULL );
-    tft.setTextDatum( MC_DATUM );
+    settingsScroll( 0 );    // Applies menuOffset to the list and the arrows
+    uiDrawAll();
+}
 
-    // ===== 3 SLOUPCE JEDNOTEK - LABELS =====
-    tft.setTextColor( txt, bg );
-    tft.drawString( "Temperature", 50, 68, 1 );
-    tft.drawString( "Wind speed", 160, 68, 1 );
-    tft.drawString( "Pressure", 270, 68, 1 );
-
-    // ===== SLOUPEC 1: TEPLOTA =====
-    int btnH = 20;
-    int btnY = 80;
-    if ( !weatherUnitF ) {
-        tft.fillRoundRect( 8,  btnY, 38, btnH, 3, TFT_GREEN );
-        tft.setTextColor( TFT_WHITE, TFT_GREEN );
-        tft.drawString( "C", 27, btnY + 10, 1 );
-        tft.drawRoundRect( 50, btnY, 38, btnH, 3, TFT_BLUE );
-        tft.setTextColor( txt, bg );
-        tft.drawString( "F", 69, btnY + 10, 1 );
-    }
-    else {
-        tft.drawRoundRect( 8,  btnY, 38, btnH, 3, TFT_BLUE );
-        tft.setTextColor( txt, bg );
-        tft.drawString( "C", 27, btnY + 10, 1 );
-        tft.fillRoundRect( 50, btnY, 38, btnH, 3, TFT_GREEN );
-        tft.setTextColor( TFT_WHITE, TFT_GREEN );
-        tft.drawString( "F", 69, btnY + 10, 1 );
-    }
+// ---------------------------------------------------------------------------
+// Weather / Regional / Firmware (display lists from screen_lists.cpp,
+// recorded on first draw)
+// ---------------------------------------------------------------------------
 
-    // ===== COLUMN 2: WIND =====
-    tft.setTextColor( txt, bg );
-    if ( !weatherUnitMph ) {
-        tft.fillRoundRect( 115, btnY, 38, btnH, 3, TFT_GREEN );
-        tft.setTextColor( TFT_WHITE, TFT_GREEN );
-        tft.drawString( "km/h", 134, btnY + 10, 1 );
-        tft.drawRoundRect( 157, btnY, 38, btnH, 3, TFT_BLUE );
-        tft.setTextColor( txt, bg );
-        tft.drawString( "mph", 176, btnY + 10, 1 );
-    }
-    else {
-        tft.drawRoundRect( 115, btnY, 38, btnH, 3, TFT_BLUE );
-        tft.setTextColor( txt, bg );
-        tft.drawString( "km/h", 134, btnY + 10, 1 );
-        tft.fillRoundRect( 157, btnY, 38, btnH, 3, TFT_GREEN );
-        tft.setTextColor( TFT_WHITE, TFT_GREEN );
-        tft.drawString( "mph", 176, btnY + 10, 1 );
-    }
+static DisplayList weatherList, regionalList, firmwareList;
 
-    // ===== SLOUPEC 3: TLAK =====
-    tft.setTextColor( txt, bg );
-    if ( !weatherUnitInHg ) {
-        tft.fillRoundRect( 222, btnY, 38, btnH, 3, TFT_GREEN );
-        tft.setTextColor( TFT_WHITE, TFT_GREEN );
-        tft.drawString( "hPa", 241, btnY + 10, 1 );
-        tft.drawRoundRect( 264, btnY, 38, btnH, 3, TFT_BLUE );
-        tft.setTextColor( txt, bg );
-        tft.drawString( "inHg", 283, btnY + 10, 1 );
-    }
-    else {
-        tft.drawRoundRect( 222, btnY, 38, btnH, 3, TFT_BLUE );
-        tft.setTextColor( txt, bg );
-        tft.drawString( "hPa", 241, btnY + 10, 1 );
-        tft.fillRoundRect( 264, btnY, 38, btnH, 3, TFT_GREEN );
-        tft.setTextColor( TFT_WHITE, TFT_GREEN );
-        tft.drawString( "inHg", 283, btnY + 10, 1 );
+void drawWeatherScreen() {
+    GFX_SCOPE( "drawWeatherScreen" );
+    if ( !weatherList.recorded ) {
+        recordWeatherScreen( weatherList );
     }
-
-    // ===== COORDINATES + EDIT =====
-    tft.setTextColor( txt, bg );
-    tft.setTextDatum( ML_DATUM );
-    String coordStr = "Coord: " + String( lat, 2 ) + ", " + String( lon, 2 );
-    tft.drawString( coordStr, 8, 118, 1 );
-    tft.drawRoundRect( 232, 110, 60, 16, 3, TFT_SKYBLUE );
-    tft.setTextColor( TFT_SKYBLUE, bg );
-    tft.setTextDatum( MC_DATUM );
-    tft.drawString( "EDIT", 262, 118, 1 );
-
-    // ===== INFO =====
-    tft.setTextColor( txt, bg );
-    tft.drawString( "Updates every 30 min", 160, 138, 1 );
-
-    // ===== BACK BUTTON =====
-    tft.fillRoundRect( 40, 152, 240, 16, 4, TFT_DARKGREY );
-    tft.setTextColor( TFT_WHITE );
-    tft.drawString( "BACK TO SETTINGS", 160, 160, 1 );
+    dlReplay( weatherList );
 }
 
 // Repaint only the DST toggle button — avoids a full fillScreen redraw
 void drawRegionalDstButton() {
+    GFX_SCOPE( "drawRegionalDstButton" );
     uint16_t bg = getBgColor();
     tft.setTextDatum( MC_DATUM );
     tft.fillRoundRect( 195, 172, 72, 16, 3, bg );   // erase previous state
@@ -670,117 +584,6 @@ void drawRegionalDstButton() {
     tft.drawString( manualDstActive ? "DST: ON" : "DST: OFF", 231, 180, 2 );
 }
 
-void redrawAutoDimStart() {
-    const int timeX = 100;   // startX(50) + 50
-    const int timeY = 178;   // onY(175) + 3
-    tft.fillRect( timeX, timeY - 6, 35, 12, getBgColor() );
-    tft.setTextDatum( ML_DATUM );
-    tft.setTextColor( getTextColor() );
-    tft.drawString( String( autoDimStart ) + "h", timeX, timeY, 1 );
-}
-
-void redrawAutoDimEnd() {
-    const int timeX = 100;   // startX(50) + 50
-    const int timeY = 194;   // onY(175) + 3 + lineHeight(16)
-    tft.fillRect( timeX, timeY - 6, 35, 12, getBgColor() );
-    tft.setTextDatum( ML_DATUM );
-    tft.setTextColor( getTextColor() );
-    tft.drawString( String( autoDimEnd ) + "h", timeX, timeY, 1 );
-}
-
-void redrawAutoDimSection() {
-    // Clear the Auto Dim area — width capped at 195 to stay clear of the
-    // NRM/FLP control (x=200) and the back button (x=252) on the right side
-    const int areaX = 0, areaY = 150, areaW = 195, areaH = 75;
-    uint16_t bg  = getBgColor();
-    uint16_t txt = getTextColor();
-    tft.fillRect( areaX, areaY, areaW, areaH, bg );
-
-    tft.setTextDatum( ML_DATUM );
-    tft.setTextColor( txt );
-    tft.drawString( "Auto Dim", 10, 155, 2 );
-
-    // ON / OFF buttons
-    const int onX = 10, onY = 175, offX = 10, offY = 195;
-    const int btnW = 28, btnH = 16;
-    if ( autoDimEnabled ) {
-        tft.fillRoundRect( onX,  onY,  btnW, btnH, 3, TFT_GREEN );
-        tft.fillRoundRect( offX, offY, btnW, btnH, 3, TFT_BLUE );
-    }
-    else {
-        tft.fillRoundRect( onX,  onY,  btnW, btnH, 3, TFT_BLUE );
-        tft.fillRoundRect( offX, offY, btnW, btnH, 3, TFT_GREEN );
-    }
-    tft.setTextColor( TFT_WHITE );
-    tft.setTextDatum( MC_DATUM );
-    tft.drawString( "ON",  onX  + btnW / 2, onY  + btnH / 2, 1 );
-    tft.drawString( "OFF", offX + btnW / 2, offY + btnH / 2, 1 );
-
-    if ( autoDimEnabled ) {
-        const int startX = 50, startY = 178, lineH = 16, timeX = 100;
-        const int btnW16 = 16;
-        tft.setTextDatum( ML_DATUM );
-        tft.setTextColor( txt );
-        tft.drawString( "Start", startX, startY,        1 );
-        tft.drawString( String( autoDimStart ) + "h", timeX, startY, 1 );
-        int endY = startY + lineH;
-        tft.drawString( "End",   startX, endY,           1 );
-        tft.drawString( String( autoDimEnd )   + "h", timeX, endY,   1 );
-        int levelY = endY + lineH;
-        tft.drawString( "Level", startX, levelY,         1 );
-        tft.drawString( String( autoDimLevel ) + "%", timeX, levelY, 1 );
-        // redraw the +/- buttons
-        auto drawPlusBtn = [ & ]( int rx, int ry ) {
-            tft.drawRoundRect( rx, ry, btnW16, 12, 2, TFT_GREEN );
-            int cx = rx + btnW16 / 2, cy = ry + 6;
-            tft.drawFastHLine( cx - 3, cy, 7, TFT_GREEN );
-            tft.drawFastVLine( cx, cy - 3, 7, TFT_GREEN );
-        };
-        auto drawMinusBtn = [ & ]( int rx, int ry ) {
-            tft.drawRoundRect( rx, ry, btnW16, 12, 2, TFT_GREEN );
-            int cx = rx + btnW16 / 2, cy = ry + 6;
-            tft.drawFastHLine( cx - 3, cy, 7, TFT_GREEN );
-        };
-        int plusX  = timeX + 50;
-        drawPlusBtn(  plusX,      startY - 6 );
-        drawMinusBtn( plusX + 26, startY - 6 );
-        drawPlusBtn(  plusX,      endY   - 6 );
-        drawMinusBtn( plusX + 26, endY   - 6 );
-        drawPlusBtn(  plusX,      levelY - 6 );
-        drawMinusBtn( plusX + 26, levelY - 6 );
-    }
-}
-
-void redrawDigiAnaToggle() {
-    const int swX = 200, swY = 115, swW = 110, swH = 28;
-    uint16_t bg = getBgColor();
-    uint16_t activeColor = TFT_GREEN;
-    if ( themeMode == THEME_BLUE ) {
-        activeColor = blueLight;
-    }
-    if ( themeMode == THEME_YELLOW ) {
-        activeColor = yellowDark;
-    }
-    // Clear interior, keep the border rect
-    tft.fillRect( swX + 1, swY + 1, swW - 2, swH - 2, bg );
-    if ( !isDigitalClock ) {
-        tft.fillRect( swX + 2, swY + 2, ( swW / 2 ) - 2, swH - 4, activeColor );
-        tft.setTextDatum( MC_DATUM );
-        tft.setTextColor( TFT_WHITE );
-        tft.drawString( "ANA",  swX + ( swW / 4 ),     swY + ( swH / 2 ), 2 );
-        tft.setTextColor( getTextColor() );
-        tft.drawString( "DIGI", swX + ( 3 * swW / 4 ), swY + ( swH / 2 ), 2 );
-    }
-    else {
-        tft.fillRect( swX + ( swW / 2 ), swY + 2, ( swW / 2 ) - 2, swH - 4, activeColor );
-        tft.setTextDatum( MC_DATUM );
-        tft.setTextColor( getTextColor() );
-        tft.drawString( "ANA",  swX + ( swW / 4 ),     swY + ( swH / 2 ), 2 );
-        tft.setTextColor( TFT_WHITE );
-        tft.drawString( "DIGI", swX + ( 3 * swW / 4 ), swY + ( swH / 2 ), 2 );
-    }
-}
-
 // Erase the sync overlay box and restore the Regional screen content beneath it
 void clearSyncOverlay() {
     const int bx = 50, by = 80, bw = 220, bh = 90;
@@ -798,146 +601,87 @@ void clearSyncOverlay() {
 }
 
 void drawRegionalScreen() {
-    tft.fillScreen( getBgColor() );
-    tft.setTextColor( getTextColor() );
-    tft.setTextDatum( MC_DATUM );
-    tft.drawString( "REGIONAL SETUP", 160, 30, 4 );
-
-    int toggleX = 160;
-    int toggleY = 60;
-
-    if ( regionAutoMode ) {
-        tft.fillRoundRect( toggleX - 55, toggleY - 15, 50, 30, 4, TFT_GREEN );
-        tft.setTextColor( TFT_WHITE );
-        tft.drawString( "AUTO", toggleX - 30, toggleY, 2 );
-        tft.drawRoundRect( toggleX + 5, toggleY - 15, 50, 30, 4, TFT_BLUE );
-        tft.setTextColor( getTextColor() );
-        tft.drawString( "MANUAL", toggleX + 30, toggleY, 2 );
-    }
-    else {
-        tft.drawRoundRect( toggleX - 55, toggleY - 15, 50, 30, 4, TFT_BLUE );
-        tft.setTextColor( getTextColor() );
-        tft.drawString( "AUTO", toggleX - 30, toggleY, 2 );
-        tft.fillRoundRect( toggleX + 5, toggleY - 15, 50, 30, 4, TFT_GREEN );
-        tft.setTextColor( TFT_WHITE );
-        tft.drawString( "MANUAL", toggleX + 30, toggleY, 2 );
-    }
-
-    tft.setTextDatum( ML_DATUM );
-    tft.setTextColor( getTextColor() );
-    tft.drawString( "City", 40, 110, 2 );
-    tft.setTextColor( TFT_SKYBLUE );
-    tft.drawString( cityName != "" ? cityName : "---", 40, 130, 2 );
-
-    tft.setTextColor( getTextColor() );
-    tft.drawString( "Timezone", 40, 160, 2 );
-    tft.setTextColor( TFT_SKYBLUE );
-    int tzHours = gmtOffset_sec / 3600;
-    String tzStr = ( tzHours >= 0 ? "+" : "" ) + String( tzHours ) + "h";
-    tft.drawString( tzStr, 40, 180, 2 );
-    if ( !regionAutoMode ) {
-        tft.setTextDatum( MC_DATUM );
-        tft.drawRoundRect( 120, 172, 28, 16, 3, TFT_GREEN );
-        tft.setTextColor( TFT_GREEN );
-        tft.drawString( "+", 134, 180, 2 );
-        tft.drawRoundRect( 155, 172, 28, 16, 3, TFT_GREEN );
-        tft.drawString( "-", 169, 180, 2 );
-        if ( manualDstActive ) {
-            tft.fillRoundRect( 195, 172, 72, 16, 3, TFT_ORANGE );
-            tft.setTextColor( TFT_WHITE );
-        }
-        else {
-            tft.drawRoundRect( 195, 172, 72, 16, 3, getTextColor() );
-            tft.setTextColor( getTextColor() );
-        }
-        tft.drawString( manualDstActive ? "DST: ON" : "DST: OFF", 231, 180, 2 );
-        tft.setTextDatum( ML_DATUM );
+    GFX_SCOPE( "drawRegionalScreen" );
+    if ( !regionalList.recorded ) {
+        recordRegionalScreen( regionalList );
     }
+    dlReplay( regionalList );
+}
 
-    tft.setTextDatum( MC_DATUM );
-    if ( regionAutoMode ) {
-        tft.drawRoundRect( 40, 205, 105, 30, 6, TFT_GREEN );
-        tft.drawString( "SYNC", 92, 220, 2 );
+// Arrow buttons beside a virtual list, repainted whenever its scroll settles
+static void drawListArrows( int upY, int downY, uint16_t color ) {
+    tft.fillRect( 265, upY, 50, 50, getBgColor() );
+    tft.fillRect( 265, downY, 50, 50, getBgColor() );
+    if ( vlistCanScroll( -1 ) ) {
+        drawArrowUp( 265, upY, color );
     }
-    else {
-        tft.drawRoundRect( 40, 205, 105, 30, 6, TFT_GREEN );
-        tft.drawString( "EDIT", 92, 220, 2 );
+    if ( vlistCanScroll( 1 ) ) {
+        drawArrowDown( 265, downY, color );
     }
+}
 
-    tft.drawRoundRect( 155, 205, 105, 30, 6, TFT_RED );
-    tft.drawString( "Back", 207, 220, 2 );
+static const char *countryItem( int index ) {
+    return countries[ index ].name;
+}
+
+static void countryListSettled() {
+    countryOffset = vlistFirstRow();
+    drawListArrows( 45, 180, theme().listArrow );
 }
 
 void drawCountrySelection() {
+    GFX_SCOPE( "drawCountrySelection" );
     tft.fillScreen( getBgColor() );
     tft.setTextColor( getTextColor() );
     tft.setTextDatum( MC_DATUM );
     tft.drawString( "SELECT COUNTRY", 160, 30, 4 );
 
-    tft.setTextDatum( ML_DATUM );
-
-    int itemsPerScreen = 5;
-    for ( int i = countryOffset; i < countryOffset + itemsPerScreen && i < COUNTRIES_COUNT; i++ ) {
-        int idx = i - countryOffset;
-        int yPos = 70 + idx * 30;
-        String txt = String( countries[ i ].name );
-        if ( txt.length() > 20 ) {
-            txt = txt.substring( 0, 17 ) + "...";
-        }
-        tft.drawString( txt, 15, yPos, 2 );
-        tft.drawFastHLine( 10, yPos + 20, 240, TFT_DARKGREY );
-    }
+    // Five 30 px rows starting at y = 61; "Custom lookup" stays pinned below
+    vlistBegin( 10, 61, 240, 150, 30, COUNTRIES_COUNT, 20, countryItem, countryListSettled, countryOffset );
+    vlistDraw();
 
+    tft.setTextDatum( ML_DATUM );
     tft.setTextColor( TFT_BLUE );
     tft.drawString( "Custom lookup", 15, 70 + 5 * 30, 2 );
     tft.setTextColor( getTextColor() );
 
-    if ( countryOffset > 0 ) {
-        drawArrowUp( 265, 45, ( themeMode == THEME_BLUE ) ? yellowLight : TFT_BLUE );
-    }
-    if ( countryOffset + 5 < COUNTRIES_COUNT ) {
-        drawArrowDown( 265, 180, ( themeMode == THEME_BLUE ) ? yellowLight : TFT_BLUE );
-    }
+    countryListSettled();
     drawArrowBack( 265, 110, TFT_RED );
 }
 
+static const CountryEntry *cityCountry = nullptr;   // Country whose cities are listed
+
+static const char *cityItem( int index ) {
+    return cityCountry->cities[ index ].name;
+}
+
+static void cityListSettled() {
+    cityOffset = vlistFirstRow();
+    drawListArrows( 45, 180, theme().listArrow );
+}
+
 void drawCitySelection() {
+    GFX_SCOPE( "drawCitySelection" );
     tft.fillScreen( getBgColor() );
     tft.setTextColor( getTextColor() );
     tft.setTextDatum( MC_DATUM );
     tft.drawString( selectedCountry, 160, 15, 2 );
     tft.drawString( "SELECT CITY", 160, 35, 4 );
 
-    String cities[ 20 ];
-    int cityCount = 0;
-    getCountryCities( selectedCountry, cities, cityCount );
+    cityCountry = findCountry( selectedCountry );
+    vlistBegin( 10, 61, 240, 150, 30, cityCountry ? cityCountry->cityCount : 0, 20, cityItem, cityListSettled, cityOffset );
+    vlistDraw();
 
     tft.setTextDatum( ML_DATUM );
-
-    int itemsPerScreen = 5;
-    for ( int i = cityOffset; i < cityOffset + itemsPerScreen && i < cityCount; i++ ) {
-        int idx = i - cityOffset;
-        int yPos = 70 + idx * 30;
-        String txt = cities[ i ];
-        if ( txt.length() > 20 ) {
-            txt = txt.substring( 0, 17 ) + "...";
-        }
-        tft.drawString( txt, 15, yPos, 2 );
-        tft.drawFastHLine( 10, yPos + 20, 240, TFT_DARKGREY );
-    }
-
+    tft.setTextColor( getTextColor() );
     tft.drawString( "Custom lookup", 15, 70 + 5 * 30, 2 );
 
-    if ( cityOffset > 0 ) {
-        drawArrowUp( 265, 45, TFT_BLUE );
-    }
-    if ( cityOffset + 5 < cityCount ) {
-        drawArrowDown( 265, 180, TFT_BLUE );
-    }
+    cityListSettled();
     drawArrowBack( 265, 110, TFT_RED );
 }
 
 void drawLocationConfirm() {
+    GFX_SCOPE( "drawLocationConfirm" );
     tft.fillScreen( getBgColor() );
     tft.setTextColor( getTextColor() );
     tft.setTextDatum( MC_DATUM );
@@ -964,478 +708,353 @@ void drawLocationConfirm() {
 }
 
 void drawCustomCityInput() {
-    tft.fillScreen( getBgColor() );
-    tft.setTextColor( getTextColor() );
-    tft.setTextDatum( MC_DATUM );
-    tft.setFreeFont( &FreeSansBold12pt7b );
-    tft.drawString( "Enter City Name", 160, 20 );
-
-    // Input field - same design as WiFi keyboard
-    tft.drawRect( 10, 40, 300, 30, isWhiteTheme ? TFT_BLACK : TFT_WHITE );
-    tft.setFreeFont( &FreeSans9pt7b );
-    tft.setTextDatum( ML_DATUM );
-    tft.drawString( customCityInput, 20, 55 );
-
-    // Keyboard - same design as WiFi
-    tft.setFreeFont( &FreeSans9pt7b );
-    tft.setTextDatum( MC_DATUM );
-
-    const char *rows[] = {"qwertyuiop", "asdfghjkl", "zxcvbnm"};
-    if ( keyboardNumbers ) {
-        rows[ 0 ] = "1234567890";
-        rows[ 1 ] = "!@#$%^&*(/";
-        rows[ 2 ] = ")-_+=.,?";
-    }
-
-    for ( int r = 0; r < 3; r++ ) {
-        int len = strlen( rows[ r ] );
-        for ( int i = 0; i < len; i++ ) {
-            int btnX = i * 29 + 2;
-            int btnY = 80 + r * 30;
-            // Smaller squares, theme-appropriate colours (matching WiFi keyboard)
-            tft.drawRect( btnX, btnY, 26, 26, isWhiteTheme ? TFT_DARKGREY : TFT_WHITE );
-            char ch = rows[ r ][ i ];
-            if ( keyboardShift && !keyboardNumbers ) {
-                ch = toupper( ch );
-            }
-            tft.drawString( String( ch ), btnX + 13, btnY + 15 );
-        }
-    }
-
-    // Space bar
-    tft.drawRect( 2, 170, 316, 25, isWhiteTheme ? TFT_DARKGREY : TFT_WHITE );
-    tft.setTextDatum( MC_DATUM );
-    tft.drawString( "Space", 160, 183 );
-
-    // Function buttons
-    int bw = 64;
-    int by = 198;
-    int bh = 35;
-    tft.setTextColor( isWhiteTheme ? TFT_BLACK : TFT_WHITE );
-
-    // 1. Shift/CAP
-    tft.drawRect( 0 * bw + 2, by, bw - 4, bh, isWhiteTheme ? TFT_DARKGREY : TFT_WHITE );
-    tft.drawString( "Shift", 0 * bw + bw / 2, by + 18 );
-
-    // 2. 123
-    tft.drawRect( 1 * bw + 2, by, bw - 4, bh, isWhiteTheme ? TFT_DARKGREY : TFT_WHITE );
-    tft.drawString( "123", 1 * bw + bw / 2, by + 18 );
-
-    // 3. Del
-    tft.drawRect( 2 * bw + 2, by, bw - 4, bh, isWhiteTheme ? TFT_DARKGREY : TFT_WHITE );
-    tft.drawString( "Del", 2 * bw + bw / 2, by + 18 );
-
-    // 4. LOOKUP (Green - city-specific)
-    tft.setTextColor( TFT_GREEN );
-    tft.drawRect( 3 * bw + 2, by, bw - 4, bh, TFT_GREEN );
-    tft.drawString( "SRCH", 3 * bw + bw / 2, by + 18 );
-
-    // 5. BACK (Red/orange - city-specific)
-    tft.setTextColor( TFT_ORANGE );
-    tft.drawRect( 4 * bw + 2, by, bw - 4, bh, TFT_ORANGE );
-    tft.drawString( "BACK", 4 * bw + bw / 2, by + 18 );
-
-    tft.setTextColor( isWhiteTheme ? TFT_BLACK : TFT_WHITE ); // Reset colour
+    GFX_SCOPE( "drawCustomCityInput" );
+    kbBegin( CUSTOMCITYINPUT, { "Enter City Name", &customCityInput,
+                                "SRCH", TFT_GREEN, "BACK", TFT_ORANGE, false, false, true } );
 }
 
 void drawFirmwareScreen() {
-    tft.fillScreen( getBgColor() );
-
-    if ( themeMode == THEME_BLUE ) {
-        fillGradientVertical( 0, 0, 320, 240, blueDark, blueLight );
+    GFX_SCOPE( "drawFirmwareScreen" );
+    if ( !firmwareList.recorded ) {
+        recordFirmwareScreen( firmwareList );
     }
-    else if ( themeMode == THEME_YELLOW ) {
-        fillGradientVertical( 0, 0, 320, 240, yellowDark, yellowLight );
-    }
-
-    // Nadpis
-    tft.setTextColor( getTextColor() );
-    tft.setTextDatum( MC_DATUM );
-    tft.drawString( "FIRMWARE", 160, 30, 4 );
+    dlReplay( firmwareList );
+}
 
-    // Set datum for left column
-    tft.setTextDatum( ML_DATUM );
+// ---------------------------------------------------------------------------
+// Graphics settings (widget tree)
+// ---------------------------------------------------------------------------
 
-    int yPos = 60;
+static int gfxInvert = -1, gfxDayNight = -1, gfxSlider = -1, gfxPercent = -1;
+static int gfxDimOn = -1, gfxDimOff = -1, gfxDimPanel = -1;
+static int gfxDimStart = -1, gfxDimEnd = -1, gfxDimLevel = -1;
 
-    // Current version
-    tft.setTextColor( getTextColor() );
-    tft.drawString( "Current version:", 10, yPos, 2 );
-    tft.setTextColor( TFT_GREEN );
-    tft.drawString( String( FIRMWARE_VERSION ), 160, yPos, 2 );
+// Theme / invert swatch: double border, filled when selected, 3-letter caption
+static void drawSwatch( const UiWidget &w ) {
+    const Rect &b = w.bounds;
+    tft.drawRoundRect( b.x + 1, b.y + 1, b.w - 2, b.h - 2, 4, w.color );
+    tft.drawRoundRect( b.x, b.y, b.w, b.h, 4, w.color );
+    tft.fillRoundRect( b.x + 2, b.y + 2, b.w - 4, b.h - 4, 3, w.value ? w.fillColor : TFT_DARKGREY );
+    tft.setTextDatum( MC_DATUM );
+    tft.setTextColor( w.textColor );
+    tft.drawString( w.text, b.x + b.w / 2, b.y + b.h / 2 - 2, 1 );
+}
 
-    yPos += 25;
+// Auto-dim ON / OFF: green when it is the active state
+static void drawPill( const UiWidget &w ) {
+    const Rect &b = w.bounds;
+    tft.fillRoundRect( b.x, b.y, b.w, b.h, 3, w.value ? TFT_GREEN : TFT_BLUE );
+    tft.setTextDatum( MC_DATUM );
+    tft.setTextColor( TFT_WHITE );
+    tft.drawString( w.text, b.x + b.w / 2, b.y + b.h / 2, 1 );
+}
 
-    // Available version
-    tft.setTextColor( getTextColor() );
-    tft.drawString( "Available:", 10, yPos, 2 );
-    if ( availableVersion == "" || !updateAvailable ) {
-        tft.setTextColor( TFT_DARKGREY );
-        tft.drawString( "-", 160, yPos, 2 );
-    }
-    else {
-        tft.setTextColor( TFT_ORANGE );
-        tft.drawString( availableVersion, 160, yPos, 2 );
+// +/- drawn with lines so it does not depend on font metrics; tag is the step
+static void drawStepButton( const UiWidget &w ) {
+    const Rect &b  = w.bounds;
+    int         cx = b.x + b.w / 2;
+    int         cy = b.y + b.h / 2;
+    tft.drawRoundRect( b.x, b.y, b.w, b.h, 2, TFT_GREEN );
+    tft.drawFastHLine( cx - 3, cy, 7, TFT_GREEN );
+    if ( w.tag > 0 ) {
+        tft.drawFastVLine( cx, cy - 3, 7, TFT_GREEN );
     }
+}
 
-    yPos += 35;
+static void drawBigBack( const UiWidget &w ) {
+    const Rect &b = w.bounds;
+    tft.drawRoundRect( b.x, b.y, b.w, b.h, 3, TFT_RED );
+    tft.drawRoundRect( b.x + 1, b.y + 1, b.w - 2, b.h - 2, 2, TFT_RED );
+    tft.setTextColor( TFT_RED );
+    tft.setTextDatum( MC_DATUM );
+    tft.drawString( "<", b.x + b.w / 2, b.y + b.h / 2, 4 );
+}
 
-    // Install mode nadpis
-    tft.setTextColor( getTextColor() );
-    tft.drawString( "Install mode:", 10, yPos, 2 );
+static uint16_t accentColor() {
+    return theme().accent;
+}
 
-    yPos += 25;  // yPos is now 145
+static void setNumberText( int id, int value, const char *unit ) {
+    char buf[ UI_TEXT_MAX ];
+    snprintf( buf, sizeof( buf ), "%d%s", value, unit );
+    uiSetText( id, buf );
+}
 
-    // Radio buttons for install mode (Auto and By user only)
-    const char *modes[ 2 ] = {"Auto", "By user"};
-    for ( int i = 0; i < 2; i++ ) {
-        int btnY = yPos + ( i * 25 ); // 145, 170
+static void savePrefInt( const char *key, int value ) {
+    prefs.begin( "sys", false );
+    prefs.putInt( key, value );
+    prefs.end();
+}
 
-        // Radio button - circle centred on btnY
-        tft.drawCircle( 20, btnY, 6, getTextColor() );
-        if ( otaInstallMode == i ) {
-            tft.fillCircle( 20, btnY, 4, TFT_GREEN );
-        }
+static void savePrefBool( const char *key, bool value ) {
+    prefs.begin( "sys", false );
+    prefs.putBool( key, value );
+    prefs.end();
+}
 
-        // Text - correctly aligned with circle
-        // ML_DATUM = Middle Left, so y is vertical centre of text
-        // Circle is centred on btnY, text also centred on btnY
-        tft.setTextColor( getTextColor() );
-        tft.drawString( modes[ i ], 35, btnY, 2 );
+// Settles the faded screen: selection, anti-aliased edges
+static void graphicsFaded() {
+    if ( currentState == GRAPHICSCONFIG ) {
+        drawGraphicsScreen();
     }
+}
 
-    // Reset text datum to centred for buttons
-    tft.setTextDatum( MC_DATUM );
-
-    // Check Now / Install button
-    int btnY = 190;
-    if ( updateAvailable ) {
-        tft.fillRoundRect( 10, btnY, 140, 30, 5, TFT_GREEN );
-        tft.setTextColor( TFT_BLACK );
-        tft.drawString( "INSTALL", 80, btnY + 15, 2 );
-    }
-    else {
-        tft.fillRoundRect( 10, btnY, 140, 30, 5, TFT_BLUE );
-        tft.setTextColor( TFT_WHITE );
-        tft.drawString( "CHECK NOW", 80, btnY + 15, 2 );
+static void onThemeSwatch( int id, int ) {
+    ThemePalette from = activeTheme;
+    themeMode = uiGet( id ).tag;
+    prefs.begin( "sys", false );
+    prefs.putInt( "themeMode", themeMode );
+    if ( themeMode == THEME_DARK || themeMode == THEME_WHITE ) {
+        isWhiteTheme = themeMode == THEME_WHITE;
+        prefs.putBool( "theme", isWhiteTheme );
     }
-
-    // Back button (same style as other menus)
-    tft.drawRoundRect( 230, 125, 50, 50, 4, TFT_RED );
-    drawArrowBack( 230, 125, TFT_RED );
+    prefs.end();
+    themeApply();
+    themeFade( from, graphicsFaded );
 }
 
-void drawGraphicsScreen() {
-    tft.fillScreen( getBgColor() );
-    tft.setTextColor( getTextColor() );
-    tft.setTextDatum( MC_DATUM );
-    tft.drawString( "GRAPHICS", 160, 30, 4 );
-
-    // === THEMES ===
-    tft.drawString( "Themes", 135, 50, 2 );
-
-    // BLACK Theme
-    tft.drawRoundRect( 20, 65, 50, 30, 4, TFT_BLACK );
-    tft.drawRoundRect( 19, 64, 52, 32, 4, TFT_BLACK );
-    tft.fillRoundRect( 21, 66, 48, 28, 3, themeMode == THEME_DARK ? TFT_WHITE : TFT_DARKGREY );
-    tft.setTextColor( TFT_BLACK );
-    tft.drawString( "BLK", 45, 78, 1 );
-    tft.setTextColor( getTextColor() );
+static void onInvert( int, int ) {
+    log_d( "[INVERT] Toggle: %s -> %s", invertColors ? "TRUE" : "FALSE", !invertColors ? "TRUE" : "FALSE" );
+    invertColors = !invertColors;
 
-    // WHITE Theme
-    tft.drawRoundRect( 80, 65, 50, 30, 4, TFT_WHITE );
-    tft.drawRoundRect( 79, 64, 52, 32, 4, TFT_WHITE );
-    tft.fillRoundRect( 81, 66, 48, 28, 3, themeMode == THEME_WHITE ? TFT_WHITE : TFT_DARKGREY );
-    tft.setTextColor( TFT_BLACK );
-    tft.drawString( "WHT", 105, 78, 1 );
-    tft.setTextColor( getTextColor() );
-
-    // BLUE Theme
-    tft.drawRoundRect( 140, 65, 50, 30, 4, 0x0010 );
-    tft.drawRoundRect( 139, 64, 52, 32, 4, 0x0010 );
-    tft.fillRoundRect( 141, 66, 48, 28, 3, themeMode == THEME_BLUE ? 0x07FF : TFT_DARKGREY );
-    tft.setTextColor( 0x0010 );
-    tft.drawString( "BLU", 165, 78, 1 );
-    tft.setTextColor( getTextColor() );
+    bool prefOpened = prefs.begin( "sys", false );
+    if ( prefOpened ) {
+        [[maybe_unused]] size_t written = prefs.putBool( "invertColors", invertColors );   // Log only
+        prefs.end();
 
-    // YELLOW Theme
-    tft.drawRoundRect( 200, 65, 50, 30, 4, 0xCC00 );
-    tft.drawRoundRect( 199, 64, 52, 32, 4, 0xCC00 );
-    tft.fillRoundRect( 201, 66, 48, 28, 3, themeMode == THEME_YELLOW ? 0xFFE0 : TFT_DARKGREY );
-    tft.setTextColor( TFT_BLACK );
-    tft.drawString( "YEL", 225, 78, 1 );
-    tft.setTextColor( getTextColor() );
-
-    // === INVERT BUTTON ===
-    tft.setTextColor( getTextColor() );
-    tft.setTextDatum( MC_DATUM );
-    tft.drawString( "Colours", 285, 50, 2 );
-
-    // Invert button - same style as themes
-    uint16_t invertBorderColor = invertColors ? TFT_GREEN : TFT_DARKGREY;
-    uint16_t invertFillColor = invertColors ? TFT_GREEN : TFT_DARKGREY;
-
-    tft.drawRoundRect( 260, 65, 50, 30, 4, invertBorderColor );
-    tft.drawRoundRect( 259, 64, 52, 32, 4, invertBorderColor );
-    tft.fillRoundRect( 261, 66, 48, 28, 3, invertFillColor );
-    tft.setTextColor( TFT_BLACK );
-    tft.drawString( "INV", 285, 78, 1 );
-    tft.setTextColor( getTextColor() );
+        // VERIFY: Re-open and read back
+        prefs.begin( "sys", true ); // read-only
+        [[maybe_unused]] bool readBack = prefs.getBool( "invertColors", false );
+        prefs.end();
+        log_d( "[INVERT] Written: %u bytes, readback: %s, match: %d", ( unsigned )written, readBack ? "TRUE" : "FALSE", readBack == invertColors );
+    }
 
-    // === DISPLAY BRIGHTNESS SLIDER (compact) ===
-    tft.setTextDatum( ML_DATUM );
-    tft.setTextColor( getTextColor() );
-    tft.drawString( "Brightness", 10, 108, 2 );
+    // ILI9341 (CYD1): invertColors directly controls inversion
+    tft.invertDisplay( invertColors );
+    uiGet( gfxInvert ).color = invertColors ? TFT_GREEN : TFT_DARKGREY;
+    uiSetValue( gfxInvert, invertColors );
+    uiInvalidate( gfxInvert );
+}
 
-    int sliderX = 10;
-    int sliderY = 125;
-    int sliderWidth = 130;
-    int sliderHeight = 12;
+// Applied by themeDayNightTick() once the clock is back on screen
+static void onDayNight( int, int ) {
+    dayNightTheme = !dayNightTheme;
+    savePrefBool( "dayNight", dayNightTheme );
+    uiGet( gfxDayNight ).color = dayNightTheme ? TFT_GREEN : TFT_DARKGREY;
+    uiSetValue( gfxDayNight, dayNightTheme );
+    uiInvalidate( gfxDayNight );
+}
 
-    // Slider border
-    tft.drawRect( sliderX, sliderY, sliderWidth, sliderHeight, getTextColor() );
+static void onBrightness( int, int value ) {
+    brightness = constrain( value, BRIGHT_MIN, 255 );
+    // Cap autoDimLevel so it never exceeds the new normal brightness
+    int brightPct = brightness * 100 / 255;
+    if ( autoDimLevel > brightPct ) {
+        autoDimLevel = brightPct;
+        savePrefInt( "autoDimLevel", autoDimLevel );
+        setNumberText( gfxDimLevel, autoDimLevel, "%" );
+    }
+    // Throttle NVS writes to ≤1 per 500 ms — flash writes can stall the bus
+    static unsigned long lastNVSSaveBright = 0;
+    if ( millis() - lastNVSSaveBright > 500 ) {
+        savePrefInt( "bright", brightness );
+        lastNVSSaveBright = millis();
+    }
+    backlightSet( brightness );
+    uiSetValue( gfxSlider, brightness );
+    setNumberText( gfxPercent, map( brightness, 0, 255, 0, 100 ), "%" );
+}
 
-    // Fill based on current brightness
-    int fillWidth = map( brightness, 0, 255, 0, sliderWidth - 2 );
-    tft.fillRect( sliderX + 1, sliderY + 1, fillWidth, sliderHeight - 2, TFT_SKYBLUE );
+static void onClockStyle( int, int digital ) {
+    isDigitalClock = digital;
+    savePrefBool( "digiClock", isDigitalClock );
+}
 
-    // Percentage - placed immediately after compact slider
-    int brightnessPercent = map( brightness, 0, 255, 0, 100 );
-    tft.setTextDatum( ML_DATUM );
-    tft.drawString( String( brightnessPercent ) + "%", sliderX + sliderWidth + 5, sliderY + 1, 1 );
-
-    // === ANALOG / DIGITAL TOGGLE (to the right of brightness) ===
-    int swX = 200;
-    int swY = 115;
-    int swW = 110;
-    int swH = 28;
-
-    // Active element colour
-    uint16_t activeColor = TFT_GREEN;
-    if ( themeMode == THEME_BLUE ) {
-        activeColor = blueLight;
-    }
-    if ( themeMode == THEME_YELLOW ) {
-        activeColor = yellowDark;
-    }
+static void onFlip( int, int flipped ) {
+    displayFlipped = flipped;
+    savePrefBool( "dispFlip", displayFlipped );
+    loadTouchCal();     // Calibration for the new orientation
+    tft.setRotation( displayFlipped ? 3 : 1 );
+    drawGraphicsScreen();
+}
 
-    tft.drawRect( swX, swY, swW, swH, getTextColor() );
+static void onAutoDim( int id, int ) {
+    autoDimEnabled = uiGet( id ).tag;
+    savePrefBool( "autoDimEnabled", autoDimEnabled );
+    uiSetValue( gfxDimOn, autoDimEnabled );
+    uiSetValue( gfxDimOff, !autoDimEnabled );
+    uiSetVisible( gfxDimPanel, autoDimEnabled );
+}
 
-    if ( !isDigitalClock ) {
-        // State: ANALOG (active left)
-        tft.fillRect( swX + 2, swY + 2, ( swW / 2 ) - 2, swH - 4, activeColor );
-        tft.setTextDatum( MC_DATUM );
-        tft.setTextColor( TFT_WHITE );
-        tft.drawString( "ANA", swX + ( swW / 4 ), swY + ( swH / 2 ), 2 );
-        tft.setTextColor( getTextColor() );
-        tft.drawString( "DIGI", swX + ( 3 * swW / 4 ), swY + ( swH / 2 ), 2 );
-    }
-    else {
-        // State: DIGITAL (active right)
-        tft.fillRect( swX + ( swW / 2 ), swY + 2, ( swW / 2 ) - 2, swH - 4, activeColor );
-        tft.setTextDatum( MC_DATUM );
-        tft.setTextColor( getTextColor() );
-        tft.drawString( "ANA", swX + ( swW / 4 ), swY + ( swH / 2 ), 2 );
-        tft.setTextColor( TFT_WHITE );
-        tft.drawString( "DIGI", swX + ( 3 * swW / 4 ), swY + ( swH / 2 ), 2 );
-    }
+static void onDimStartStep( int id, int ) {
+    autoDimStart = ( autoDimStart + uiGet( id ).tag + 24 ) % 24;
+    savePrefInt( "autoDimStart", autoDimStart );
+    setNumberText( gfxDimStart, autoDimStart, "h" );
+}
 
-    // === ROTATE 180° TOGGLE ===
-    int rotX = 200;
-    int rotY = 148;
-    int rotW = 110;
-    int rotH = 22;
+static void onDimEndStep( int id, int ) {
+    autoDimEnd = ( autoDimEnd + uiGet( id ).tag + 24 ) % 24;
+    savePrefInt( "autoDimEnd", autoDimEnd );
+    setNumberText( gfxDimEnd, autoDimEnd, "h" );
+}
 
-    tft.drawRect( rotX, rotY, rotW, rotH, getTextColor() );
-    if ( !displayFlipped ) {
-        tft.fillRect( rotX + 2, rotY + 2, ( rotW / 2 ) - 2, rotH - 4, activeColor );
-        tft.setTextDatum( MC_DATUM );
-        tft.setTextColor( TFT_WHITE );
-        tft.drawString( "NRM", rotX + ( rotW / 4 ), rotY + ( rotH / 2 ), 1 );
-        tft.setTextColor( getTextColor() );
-        tft.drawString( "FLP", rotX + ( 3 * rotW / 4 ), rotY + ( rotH / 2 ), 1 );
+static void onDimLevelStep( int id, int ) {
+    if ( uiGet( id ).tag > 0 ) {
+        // Snap up to next 5% grid point, then cap at normal brightness
+        int next     = ( ( autoDimLevel / 5 ) + 1 ) * 5;
+        autoDimLevel = min( next, brightness * 100 / 255 );
     }
     else {
-        tft.fillRect( rotX + ( rotW / 2 ), rotY + 2, ( rotW / 2 ) - 2, rotH - 4, activeColor );
-        tft.setTextDatum( MC_DATUM );
-        tft.setTextColor( getTextColor() );
-        tft.drawString( "NRM", rotX + ( rotW / 4 ), rotY + ( rotH / 2 ), 1 );
-        tft.setTextColor( TFT_WHITE );
-        tft.drawString( "FLP", rotX + ( 3 * rotW / 4 ), rotY + ( rotH / 2 ), 1 );
+        // Snap down to previous 5% grid point (floor), minimum 0
+        int prev     = ( ( autoDimLevel - 1 ) / 5 ) * 5;
+        autoDimLevel = max( prev, 0 );
     }
+    savePrefInt( "autoDimLevel", autoDimLevel );
+    setNumberText( gfxDimLevel, autoDimLevel, "%" );
+}
 
-    // === AUTO DIM SETTINGS ===
-    tft.setTextDatum( ML_DATUM );
-    tft.setTextColor( getTextColor() );
-    tft.drawString( "Auto Dim", 10, 155, 2 );
-
-    // ON/OFF BUTTONS
-    int onX = 10;
-    int onY = 175;
-    int offX = 10;
-    int offY = 195;
-    int btnWidth = 28;
-    int btnHeight = 16;
-    if ( autoDimEnabled ) {
-        tft.fillRoundRect( onX, onY, btnWidth, btnHeight, 3, TFT_GREEN );
-        tft.setTextColor( TFT_WHITE );
-        tft.setTextDatum( MC_DATUM );
-        tft.drawString( "ON", onX + btnWidth / 2, onY + btnHeight / 2, 1 );
-        tft.fillRoundRect( offX, offY, btnWidth, btnHeight, 3, TFT_BLUE );
-        tft.setTextColor( TFT_WHITE );
-        tft.drawString( "OFF", offX + btnWidth / 2, offY + btnHeight / 2, 1 );
-    }
-    else {
-        tft.fillRoundRect( onX, onY, btnWidth, btnHeight, 3, TFT_BLUE );
-        tft.setTextColor( TFT_WHITE );
-        tft.setTextDatum( MC_DATUM );
-        tft.drawString( "ON", onX + btnWidth / 2, onY + btnHeight / 2, 1 );
-        tft.fillRoundRect( offX, offY, btnWidth, btnHeight, 3, TFT_GREEN );
-        tft.setTextColor( TFT_WHITE );
-        tft.drawString( "OFF", offX + btnWidth / 2, offY + btnHeight / 2, 1 );
-    }
+static void onGraphicsBack( int, int ) {
+    currentState = SETTINGS;
+    menuOffset   = 0;
+    drawSettingsScreen();
+}
 
-    // SETTINGS TO THE RIGHT OF ON/OFF
-    if ( autoDimEnabled ) {
-        tft.setTextColor( getTextColor() );
-        tft.setTextDatum( ML_DATUM );
-
-        int startX = 50;
-        int startY = onY + 3;
-        int lineHeight = 16;
-        // === START TIME ===
-        tft.drawString( "Start", startX, startY, 1 );
-        int startTimeX = startX + 50;
-        tft.drawString( String( autoDimStart ) + "h", startTimeX, startY, 1 );
-        int startPlusX = startTimeX + 50;
-        int startPlusY = startY - 6;
-        int btnW = 16;
-        int btnH = 12;
-
-        // Helper lambda: draw a +/- symbol centred in a rect using lines (font-metric-independent)
-        auto drawPlusBtn = [ & ]( int rx, int ry ) {
-            tft.drawRoundRect( rx, ry, btnW, btnH, 2, TFT_GREEN );
-            int cx = rx + btnW / 2,  cy = ry + btnH / 2;
-            tft.drawFastHLine( cx - 3, cy,     7, TFT_GREEN );
-            tft.drawFastVLine( cx,     cy - 3, 7, TFT_GREEN );
-        };
-        auto drawMinusBtn = [ & ]( int rx, int ry ) {
-            tft.drawRoundRect( rx, ry, btnW, btnH, 2, TFT_GREEN );
-            int cx = rx + btnW / 2,  cy = ry + btnH / 2;
-            tft.drawFastHLine( cx - 3, cy, 7, TFT_GREEN );
-        };
-
-        drawPlusBtn( startPlusX, startPlusY );
-        int startMinusX = startPlusX + btnW + 10;
-        int startMinusY = startPlusY;
-        drawMinusBtn( startMinusX, startMinusY );
-        tft.setTextColor( getTextColor() );
+static int addSwatch( int x, int width, const char *caption, int tag, bool selected, uint16_t border, uint16_t fill,
+                      uint16_t text, UiEventFn onTap ) {
+    int       id = uiAddButton( x - 1, 64, width, 32, caption, border, onTap );
+    UiWidget &w  = uiGet( id );
+    w.fillColor  = fill;
+    w.textColor  = text;
+    w.tag        = tag;
+    w.value      = selected;
+    w.draw       = drawSwatch;
+    w.debounceMs = TOUCH_DEBOUNCE_MS;
+    return id;
+}
 
-        // === END TIME ===
-        int endY = startY + lineHeight;
-        tft.setTextDatum( ML_DATUM );
-        tft.drawString( "End", startX, endY, 1 );
-        int endTimeX = startX + 50;
-        tft.drawString( String( autoDimEnd ) + "h", endTimeX, endY, 1 );
-        int endPlusX = endTimeX + 50;
-        int endPlusY = endY - 6;
-        drawPlusBtn( endPlusX, endPlusY );
-        int endMinusX = endPlusX + btnW + 10;
-        int endMinusY = endPlusY;
-        drawMinusBtn( endMinusX, endMinusY );
-        tft.setTextColor( getTextColor() );
+// Perceived brightness, 0..~64k, of an RGB565 colour
+static uint32_t luma565( uint16_t c ) {
+    return ( ( c >> 11 ) * 8 ) * 77 + ( ( ( c >> 5 ) & 0x3F ) * 4 ) * 150 + ( ( c & 0x1F ) * 8 ) * 29;
+}
 
-        // === LEVEL - PROCENTA ===
-        int levelY = endY + lineHeight;
-        tft.setTextDatum( ML_DATUM );
-        tft.drawString( "Level", startX, levelY, 1 );
-        int levelTimeX = startX + 50;
-        tft.drawString( String( autoDimLevel ) + "%", levelTimeX, levelY, 1 );
-        int levelPlusX = levelTimeX + 50;
-        int levelPlusY = levelY - 6;
-        drawPlusBtn( levelPlusX, levelPlusY );
-        int levelMinusX = levelPlusX + btnW + 10;
-        int levelMinusY = levelPlusY;
-        drawMinusBtn( levelMinusX, levelMinusY );
-        tft.setTextColor( getTextColor() );
-    }
+// Swatch in a palette's own colours: background top as the border, bottom as
+// the fill, captioned in whichever of background and text stands out on it
+static void addThemeSwatch( int x, int width, const char *caption, int mode ) {
+    const ThemePalette &p    = themePalette( mode );
+    uint32_t            fill = luma565( p.bgBottom );
+    uint32_t            dBg  = max( luma565( p.bg ), fill ) - min( luma565( p.bg ), fill );
+    uint32_t            dTxt = max( luma565( p.text ), fill ) - min( luma565( p.text ), fill );
+    addSwatch( x, width, caption, mode, themeMode == mode, p.bg, p.bgBottom, dBg >= dTxt ? p.bg : p.text, onThemeSwatch );
+}
 
-    // === BACK BUTTON ===
-    int backX = 252;
-    int backY = 182;
-    int backSize = 56;
-    tft.drawRoundRect( backX, backY, backSize, backSize, 3, TFT_RED );
-    tft.drawRoundRect( backX + 1, backY + 1, backSize - 2, backSize - 2, 2, TFT_RED );
-    tft.setTextColor( TFT_RED );
-    tft.setTextDatum( MC_DATUM );
-    tft.drawString( "<", backX + backSize / 2, backY + backSize / 2, 4 );
+static void addPill( int y, const char *caption, bool enable ) {
+    int id = uiAddButton( 10, y, 28, 16, caption, TFT_WHITE, onAutoDim );
+    uiGet( id ).tag   = enable;
+    uiGet( id ).value = autoDimEnabled == enable;
+    uiGet( id ).draw  = drawPill;
+    ( enable ? gfxDimOn : gfxDimOff ) = id;
 }
 
-// ---------------------------------------------------------------------------
-// Targeted partial redraws for the Graphics screen
-// ---------------------------------------------------------------------------
+// One auto-dim row: caption, value and +/- buttons at text baseline y
+static int addDimRow( int y, const char *caption, int value, const char *unit, UiEventFn onStep ) {
+    uiAddLabel( 50, y - 6, 45, 12, caption, 1, ML_DATUM, gfxDimPanel );
+    int valueId = uiAddLabel( 100, y - 6, 35, 12, "", 1, ML_DATUM, gfxDimPanel );
+    setNumberText( valueId, value, unit );
+    for ( int step = 1; step >= -1; step -= 2 ) {
+        int id = uiAddButton( step > 0 ? 150 : 176, y - 6, 16, 12, nullptr, TFT_GREEN, onStep, gfxDimPanel );
+        uiGet( id ).tag  = step;
+        uiGet( id ).draw = drawStepButton;
+    }
+    return valueId;
+}
 
-// Repaint only the autoDimLevel value text — no fillScreen flash.
-void redrawAutoDimLevel() {
-    const int levelTimeX = 100;  // startX(50) + 50
-    const int levelY     = 210;  // onY(175) + 3 + 2*lineHeight(16)
-    uint16_t bg = getBgColor();
-    // Erase the old value (max "100%" at font 1 fits in ~30 x 10 px)
-    tft.fillRect( levelTimeX, levelY - 6, 35, 12, bg );
-    tft.setTextDatum( ML_DATUM );
-    tft.setTextColor( getTextColor() );
-    tft.drawString( String( autoDimLevel ) + "%", levelTimeX, levelY, 1 );
+void drawGraphicsScreen() {
+    GFX_SCOPE( "drawGraphicsScreen" );
+    uiBeginScreen( GRAPHICSCONFIG );
+    uiAddLabel( 60, 18, 200, 24, "GRAPHICS", 4, MC_DATUM );
+
+    // === THEMES / INVERT ===
+    // A loaded user theme adds a sixth swatch; the row tightens to fit it
+    const ThemePalette *user  = themeUserPalette();
+    int                 pitch = user ? 50 : 60;
+    int                 width = user ? 44 : 52;
+    int                 x     = user ? 16 : 20;
+    int                 invX  = x + ( user ? 5 : 4 ) * pitch;
+    uiAddLabel( x - 1, 42, invX - x - ( pitch - width ), 16, "Themes", 2, MC_DATUM );
+    uiAddLabel( invX + width / 2 - 31, 42, 60, 16, "Colours", 2, MC_DATUM );
+    addSwatch( x, width, "BLK", THEME_DARK, themeMode == THEME_DARK, TFT_BLACK, TFT_WHITE, TFT_BLACK, onThemeSwatch );
+    addSwatch( x + pitch, width, "WHT", THEME_WHITE, themeMode == THEME_WHITE, TFT_WHITE, TFT_WHITE, TFT_BLACK, onThemeSwatch );
+    addThemeSwatch( x + 2 * pitch, width, "BLU", THEME_BLUE );
+    addThemeSwatch( x + 3 * pitch, width, "YEL", THEME_YELLOW );
+    if ( user ) {
+        addThemeSwatch( x + 4 * pitch, width, "USR", THEME_USER );
+    }
+    gfxInvert = addSwatch( invX, width, "INV", 0, invertColors, invertColors ? TFT_GREEN : TFT_DARKGREY, TFT_GREEN, TFT_BLACK,
+                           onInvert );
+
+    // === BRIGHTNESS ===
+    uiAddLabel( 10, 100, 80, 16, "Brightness", 2, ML_DATUM );
+    gfxSlider  = uiAddSlider( 10, 125, 130, 12, 0, 255, brightness, onBrightness );
+    gfxPercent = uiAddLabel( 145, 120, 35, 12, "", 1, ML_DATUM );
+    setNumberText( gfxPercent, map( brightness, 0, 255, 0, 100 ), "%" );
+
+    // === ANALOG / DIGITAL, ROTATE 180° ===
+    int clockStyle = uiAddToggle( 200, 115, 110, 28, "ANA", "DIGI", isDigitalClock, onClockStyle );
+    int flip       = uiAddToggle( 200, 148, 110, 22, "NRM", "FLP", displayFlipped, onFlip );
+    uiGet( clockStyle ).color = accentColor();
+    uiGet( flip ).color       = accentColor();
+    uiGet( flip ).font        = 1;
+
+    // === AUTO DIM ===
+    uiAddLabel( 10, 147, 60, 16, "Auto Dim", 2, ML_DATUM );
+    addPill( 175, "ON", true );
+    addPill( 195, "OFF", false );
+    gfxDimPanel = uiAddPanel( 50, 170, 146, 48 );
+    uiGet( gfxDimPanel ).visible = autoDimEnabled;
+    gfxDimStart = addDimRow( 178, "Start", autoDimStart, "h", onDimStartStep );
+    gfxDimEnd   = addDimRow( 194, "End", autoDimEnd, "h", onDimEndStep );
+    gfxDimLevel = addDimRow( 210, "Level", autoDimLevel, "%", onDimLevelStep );
+
+    // === DAY / NIGHT (classic themes follow sunrise / sunset) ===
+    uiAddLabel( 200, 177, 50, 10, "Day/Night", 1, MC_DATUM );
+    gfxDayNight = uiAddButton( 202, 190, 44, 28, "AUTO", dayNightTheme ? TFT_GREEN : TFT_DARKGREY, onDayNight );
+    uiGet( gfxDayNight ).fillColor  = TFT_GREEN;
+    uiGet( gfxDayNight ).textColor  = TFT_BLACK;
+    uiGet( gfxDayNight ).value      = dayNightTheme;
+    uiGet( gfxDayNight ).draw       = drawSwatch;
+    uiGet( gfxDayNight ).debounceMs = TOUCH_DEBOUNCE_MS;
+
+    // === BACK ===
+    int back = uiAddButton( 252, 182, 56, 56, nullptr, TFT_RED, onGraphicsBack );
+    uiGet( back ).draw = drawBigBack;
+
+    uiDrawAll();
 }
 
-// Partial repaint: only the slider fill and percentage label — no fillScreen flash.
-void redrawBrightnessSlider() {
-    const int sliderX      = 10;
-    const int sliderY      = 125;
-    const int sliderWidth  = 130;
-    const int sliderHeight = 12;
+static const char *wifiItem( int index ) {
+    return wifiSSIDs[ index ].c_str();
+}
 
-    int fillWidth = map( brightness, 0, 255, 0, sliderWidth - 2 );
-    // Filled portion
-    if ( fillWidth > 0 ) {
-        tft.fillRect( sliderX + 1, sliderY + 1, fillWidth, sliderHeight - 2, TFT_SKYBLUE );
-    }
-    // Empty portion (erase without touching the border)
-    int emptyX = sliderX + 1 + fillWidth;
-    int emptyW = sliderWidth - 2 - fillWidth;
-    if ( emptyW > 0 ) {
-        tft.fillRect( emptyX, sliderY + 1, emptyW, sliderHeight - 2, getBgColor() );
-    }
-    // Percentage label — draw with explicit background so the glyph cell self-clears (no artifact)
-    int labelX = sliderX + sliderWidth + 5;
-    int brightnessPercent = map( brightness, 0, 255, 0, 100 );
-    tft.setTextDatum( ML_DATUM );
-    tft.setTextColor( getTextColor(), getBgColor() );
-    tft.drawString( String( brightnessPercent ) + "%  ", labelX, sliderY + 1, 1 );
-    tft.setTextColor( getTextColor() );  // restore no-bg mode for other callers
+static void wifiListSettled() {
+    wifiOffset = vlistFirstRow();
+    drawListArrows( 110, 170, theme().listArrow );
 }
 
 void drawInitialSetup() {
+    GFX_SCOPE( "drawInitialSetup" );
     tft.fillScreen( getBgColor() );
     tft.setTextColor( getTextColor() );
     tft.setTextDatum( MC_DATUM );
     tft.drawString( "WIFI SELECTION", 160, 15, 2 );
-    tft.setTextDatum( ML_DATUM );
 
+    // Five scrollable rows starting at y = 36 — row 5 is reserved for the pinned "Other..." entry
+    vlistBegin( 10, 36, 240, 150, 30, wifiCount, 18, wifiItem, wifiListSettled, wifiOffset );
+    vlistDraw();
+
+    tft.setTextDatum( ML_DATUM );
     if ( wifiCount == 0 ) {
         tft.drawString( "No networks found", 15, 45, 2 );
     }
-    else {
-        // Show up to 5 rows — row 5 is reserved for the pinned "Other..." entry
-        for ( int i = wifiOffset; i < wifiOffset + 5 && i < wifiCount; i++ ) {
-            int idx = i - wifiOffset;
-            String txt = wifiSSIDs[ i ];
-            if ( txt.length() > 18 ) {
-                txt = txt.substring( 0, 15 ) + "...";
-            }
-            tft.drawString( txt, 15, 45 + idx * 30, 2 );
-            tft.drawFastHLine( 10, 62 + idx * 30, 240, TFT_DARKGREY );
-        }
-    }
 
     // "Other..." is always pinned at row 5 — visible regardless of scroll position
     tft.setTextColor( TFT_BLUE );
@@ -1448,406 +1067,14 @@ void drawInitialSetup() {
     if ( ssid != "" ) {
         drawArrowBack( 265, 50, TFT_RED );
     }
-
-    // Up arrow
-    if ( wifiOffset > 0 ) {
-        drawArrowUp( 265, 110, TFT_BLUE );
-    }
-
-    // Down arrow — more networks exist above the pinned "Other..." row
-    if ( wifiOffset + 5 < wifiCount ) {
-        drawArrowDown( 265, 170, TFT_BLUE );
-    }
+    wifiListSettled();
 }
 
+// WiFi password (KEYBOARD) and SSID entry (SSID_INPUT) share passwordBuffer
 void drawKeyboardScreen() {
-    tft.fillScreen( getBgColor() );
-    tft.setTextColor( getTextColor() );
-    tft.setTextDatum( MC_DATUM );
-    tft.setFreeFont( &FreeSansBold12pt7b );
-
-    String title = "WiFi Password";
-    if ( currentState == SSID_INPUT ) {
-        title = "Enter SSID";
-    }
-    else if ( currentState == CUSTOMCITYINPUT ) {
-        title = "Enter City Name";
-    }
-    else if ( currentState == CUSTOMCOUNTRYINPUT ) {
-        title = "Enter Country Name";
-    }
-    tft.drawString( title, 160, 20 );
-
-    tft.drawRect( 10, 40, 300, 30, isWhiteTheme ? TFT_BLACK : TFT_WHITE );
-    tft.setFreeFont( &FreeSans9pt7b );
-    tft.setTextDatum( ML_DATUM );
-    // DISPLAY LOGIC: Asterisks only for WiFi password and only when showPassword is false
-    if ( currentState == KEYBOARD && !showPassword ) {
-        String stars = "";
-        for ( int i = 0; i < passwordBuffer.length(); i++ ) {
-            stars += "*";
-        }
-        tft.drawString( stars, 20, 55 );
-    }
-    else {
-        tft.drawString( passwordBuffer, 20, 55 );
-    }
-
-    // VISIBILITY TOGGLE (only for WiFi password keyboard, not SSID entry)
-    if ( currentState == KEYBOARD ) {
-        tft.setTextDatum( MC_DATUM );
-        tft.drawRect( 250, 140, 60, 25, isWhiteTheme ? TFT_DARKGREY : TFT_WHITE );
-        tft.setFreeFont( &FreeSans9pt7b );
-        tft.drawString( showPassword ? "Hide" : "Show", 280, 153 );
-    }
-
-    // Keyboard
-    tft.setFreeFont( &FreeSans9pt7b );
-    tft.setTextDatum( MC_DATUM );
-
-    const char *rows[] = {"qwertyuiop", "asdfghjkl", "zxcvbnm"};
-    if ( keyboardNumbers ) {
-        // NUMBER MODE: row 1 digits, rows 2 and 3 special characters
-        rows[ 0 ] = "1234567890";
-        rows[ 1 ] = "!@#$%^&*(/";
-        rows[ 2 ] = ")-_+=.,?";
-    }
-
-    for ( int r = 0; r < 3; r++ ) {
-        int len = strlen( rows[ r ] );
-        for ( int i = 0; i < len; i++ ) {
-            int btnX = i * 29 + 2;
-            int btnY = 80 + r * 30;
-            tft.drawRect( btnX, btnY, 26, 26, isWhiteTheme ? TFT_DARKGREY : TFT_WHITE );
-            char ch = rows[ r ][ i ];
-            if ( keyboardShift && !keyboardNumbers ) {
-                ch = toupper( ch );
-            }
-            tft.drawString( String( ch ), btnX + 13, btnY + 15 );
-        }
-    }
-
-    // Space bar and function buttons
-    tft.drawRect( 2, 170, 316, 25, isWhiteTheme ? TFT_DARKGREY : TFT_WHITE );
-    tft.setTextDatum( MC_DATUM );
-    tft.drawString( "Space", 160, 183 );
-
-    int bw = 64;
-    int by = 198;
-    int bh = 35;
-    tft.setTextColor( isWhiteTheme ? TFT_BLACK : TFT_WHITE );
-    tft.drawRect( 0 * bw + 2, by, bw - 4, bh, isWhiteTheme ? TFT_DARKGREY : TFT_WHITE );
-    tft.drawString( "Shift", 0 * bw + bw / 2, by + 18 );
-    tft.drawRect( 1 * bw + 2, by, bw - 4, bh, isWhiteTheme ? TFT_DARKGREY : TFT_WHITE );
-    tft.drawString( "123", 1 * bw + bw / 2, by + 18 );
-    tft.drawRect( 2 * bw + 2, by, bw - 4, bh, isWhiteTheme ? TFT_DARKGREY : TFT_WHITE );
-    tft.drawString( "Del", 2 * bw + bw / 2, by + 18 );
-    tft.setTextColor( TFT_RED );
-    tft.drawRect( 3 * bw + 2, by, bw - 4, bh, TFT_RED );
-    tft.drawString( "Back", 3 * bw + bw / 2, by + 18 );
-    tft.setTextColor( TFT_GREEN );
-    tft.drawRect( 4 * bw + 2, by, bw - 4, bh, TFT_GREEN );
-    tft.drawString( "OK", 4 * bw + bw / 2, by + 18 );
-    tft.setTextColor( isWhiteTheme ? TFT_BLACK : TFT_WHITE );
-}
-
-void updateKeyboardText() {
-    // Clear only the inside of the text box to avoid flickering the rest of the keyboard
-    tft.fillRect( 11, 41, 298, 28, isWhiteTheme ? TFT_WHITE : TFT_BLACK );
-
-    tft.setFreeFont( &FreeSans9pt7b );
-    tft.setTextColor( isWhiteTheme ? TFT_BLACK : TFT_WHITE );
-    tft.setTextDatum( ML_DATUM );
-
-    if ( currentState == KEYBOARD && !showPassword ) {
-        String stars = "";
-        for ( int i = 0; i < passwordBuffer.length(); i++ ) {
-            stars += "*";
-        }
-        tft.drawString( stars, 20, 55 );
-    }
-    else {
-        tft.drawString( passwordBuffer, 20, 55 );
-    }
-}
-
-void handleKeyboardTouch( int x, int y ) {
-    log_d( "[KEYBOARD] Touch detected at X=%d, Y=%d", x, y );
-    // ========== DETECT LETTERS AND DIGITS IN KEYBOARD ROWS ==========
-    for ( int r = 0; r < 3; r++ ) {
-        const char *row;
-        if ( keyboardNumbers ) {
-            if ( r == 0 ) {
-                row = "1234567890";
-            }
-            else if ( r == 1 ) {
-                row = "!@#$%^&*(/";
-            }
-            else {
-                row = ")-_+=.,?";
-            }
-        }
-        else {
-            if ( r == 0 ) {
-                row = "qwertyuiop";
-            }
-            else if ( r == 1 ) {
-                row = "asdfghjkl";
-            }
-            else {
-                row = "zxcvbnm";
-            }
-        }
-
-        int len = strlen( row );
-        for ( int i = 0; i < len; i++ ) {
-            int btnX = i * 29 + 2;
-            int btnY = 80 + r * 30;
-
-            // Touch area adjusted to 26x26 (matches WiFi keyboard design)
-            if ( x >= btnX && x <= btnX + 26 && y >= btnY && y <= btnY + 26 ) {
-                char ch = row[ i ];
-                if ( keyboardShift && !keyboardNumbers ) {
-                    ch = toupper( ch );
-                }
-
-                if ( currentState == KEYBOARD ) {
-                    passwordBuffer += ch;
-                    log_d( "[KEYBOARD] Added to passwordBuffer: %c", ch );
-                    updateKeyboardText();
-                }
-                else if ( currentState == CUSTOMCITYINPUT ) {
-                    customCityInput += ch;
-                    log_d( "[KEYBOARD] Added to customCityInput: %c", ch );
-                    drawCustomCityInput(); // Full redraw to keep visual consistent
-                }
-                else if ( currentState == CUSTOMCOUNTRYINPUT ) {
-                    customCountryInput += ch;
-                    log_d( "[KEYBOARD] Added to customCountryInput: %c", ch );
-                    drawCustomCountryInput(); // Full redraw to keep visual consistent
-                }
-
-                delay( UI_DEBOUNCE_MS );
-                return;
-            }
-        }
-    }
-
-    // ========== DETECT SPACE BAR ==========
-    if ( x >= 2 && x <= 318 && y >= 170 && y <= 195 ) {
-        log_d( "[KEYBOARD] Space pressed" );
-        if ( currentState == KEYBOARD ) {
-            passwordBuffer += " ";
-            updateKeyboardText();
-        }
-        else if ( currentState == CUSTOMCITYINPUT ) {
-            customCityInput += " ";
-            drawCustomCityInput();
-        }
-        else if ( currentState == CUSTOMCOUNTRYINPUT ) {
-            customCountryInput += " ";
-            drawCustomCountryInput();
-        }
-
-        delay( UI_DEBOUNCE_MS );
-        return;
-    }
-
-    // ========== DETECT FUNCTION BUTTONS ==========
-    int bw = 64;
-    int by = 198;
-    int bh = 35;
-
-    // ===== BUTTON 1: SHIFT (CAP) =====
-    if ( x >= 0 && x <= bw && y >= by && y <= by + bh ) {
-        log_d( "[KEYBOARD] SHIFT pressed" );
-        keyboardShift = !keyboardShift;
-
-        if ( currentState == KEYBOARD ) {
-            drawKeyboardScreen();
-        }
-        else if ( currentState == CUSTOMCITYINPUT ) {
-            drawCustomCityInput();
-        }
-        else if ( currentState == CUSTOMCOUNTRYINPUT ) {
-            drawCustomCountryInput();
-        }
-
-        delay( UI_DEBOUNCE_MS );
-        return;
-    }
-
-    // ===== BUTTON 2: NUMBERS (123) =====
-    if ( x >= bw && x <= 2 * bw && y >= by && y <= by + bh ) {
-        log_d( "[KEYBOARD] NUMBERS toggle pressed" );
-        keyboardNumbers = !keyboardNumbers;
-
-        if ( currentState == KEYBOARD ) {
-            drawKeyboardScreen();
-        }
-        else if ( currentState == CUSTOMCITYINPUT ) {
-            drawCustomCityInput();
-        }
-        else if ( currentState == CUSTOMCOUNTRYINPUT ) {
-            drawCustomCountryInput();
-        }
-
-        delay( UI_DEBOUNCE_MS );
-        return;
-    }
-
-    // ===== BUTTON 3: DELETE (DEL) =====
-    if ( x >= 2 * bw && x <= 3 * bw && y >= by && y <= by + bh ) {
-        log_d( "[KEYBOARD] DEL pressed" );
-        if ( currentState == KEYBOARD ) {
-            if ( passwordBuffer.length() > 0 ) {
-                passwordBuffer.remove( passwordBuffer.length() - 1 );
-                updateKeyboardText();
-            }
-        }
-        else if ( currentState == CUSTOMCITYINPUT ) {
-            if ( customCityInput.length() > 0 ) {
-                customCityInput.remove( customCityInput.length() - 1 );
-                drawCustomCityInput();
-            }
-        }
-        else if ( currentState == CUSTOMCOUNTRYINPUT ) {
-            if ( customCountryInput.length() > 0 ) {
-                customCountryInput.remove( customCountryInput.length() - 1 );
-                drawCustomCountryInput();
-            }
-        }
-
-        delay( UI_DEBOUNCE_MS );
-        return;
-    }
-
-    // ===== BUTTON 4: LOOKUP / SEARCH / OK (WiFi) =====
-    if ( x >= 3 * bw && x <= 4 * bw && y >= by && y <= by + bh ) {
-        // 1) WiFi - BACK button (in WiFi keyboard design: 3*bw = Back(Red), 4*bw = OK(Green))
-        // In drawCustomCityInput: 3*bw = Lookup(Green), 4*bw = Back(Orange)
-
-        // Must distinguish by currentState which button is at which position
-
-        if ( currentState == KEYBOARD ) {
-            // For WiFi, position 3*bw is the BACK button
-            log_d( "[KEYBOARD] WIFI BACK pressed" );
-            passwordBuffer = ""; // CLEAR TEXT ON EXIT
-            keyboardShift = false;
-            keyboardNumbers = false;
-            currentState = WIFICONFIG;
-            drawInitialSetup();
-
-        }
-        else if ( currentState == CUSTOMCITYINPUT ) {
-            // For City Input, position 3*bw is the LOOKUP button (Green)
-            log_d( "[KEYBOARD] LOOKUP pressed for city" );
-            if ( customCityInput.length() > 0 ) {
-                log_d( "[KEYBOARD] Looking up city: %s", customCityInput.c_str() );
-                lookupCityGeonames( customCityInput, selectedCountry );
-                currentState = CITYLOOKUPCONFIRM;
-                drawCityLookupConfirm();
-            }
-            else {
-                log_d( "[KEYBOARD] City input empty, cannot lookup" );
-                delay( UI_SPLASH_DELAY_MS );
-                drawCustomCityInput();
-            }
-        }
-        else if ( currentState == CUSTOMCOUNTRYINPUT ) {
-            // For Country Input, position 3*bw is the SEARCH button (Green)
-            log_d( "[KEYBOARD] SEARCH pressed for country" );
-            if ( customCountryInput.length() > 0 ) {
-                log_d( "[KEYBOARD] Looking up country: %s", customCountryInput.c_str() );
-                lookupCountryGeonames( customCountryInput );
-                currentState = COUNTRYLOOKUPCONFIRM;
-                drawCountryLookupConfirm();
-            }
-            else {
-                log_d( "[KEYBOARD] Country input empty, cannot lookup" );
-                delay( UI_SPLASH_DELAY_MS );
-                drawCustomCountryInput();
-            }
-        }
-
-        delay( UI_DEBOUNCE_MS );
-        return;
-    }
-
-    // ===== BUTTON 5: BACK (Custom) / OK (WiFi) =====
-    if ( x >= 4 * bw && x <= 5 * bw && y >= by && y <= by + bh ) {
-
-        if ( currentState == KEYBOARD ) {
-            // For WiFi, position 4*bw is the OK button (Green)
-            log_d( "[KEYBOARD] WIFI OK pressed" );
-            prefs.begin( "sys", false );
-            prefs.putString( "ssid", selectedSSID );
-            prefs.putString( "pass", obfuscatePassword( passwordBuffer ) );
-            prefs.end();
-
-            ssid = selectedSSID;
-            password = passwordBuffer;
-
-            showWifiConnectingScreen( ssid );
-            WiFi.mode( WIFI_STA );
-            WiFi.scanDelete();
-            WiFi.disconnect();
-            delay( 100 );
-            WiFi.begin( ssid.c_str(), password.c_str() );
-
-            unsigned long startWait = millis();
-            while ( WiFi.status() != WL_CONNECTED && millis() - startWait < WIFI_CONNECT_TIMEOUT ) {
-                delay( 500 );
-            }
-
-            if ( WiFi.status() == WL_CONNECTED ) {
-                showWifiResultScreen( true );
-                if ( regionAutoMode ) {
-                    syncRegion();
-                }
-                currentState = CLOCK;
-                lastSec = -1;
-            }
-            else {
-                showWifiResultScreen( false );
-                currentState = WIFICONFIG;
-                drawInitialSetup();
-            }
-
-        }
-        else if ( currentState == CUSTOMCITYINPUT ) {
-            // For City Input, position 4*bw is the BACK button
-            log_d( "[KEYBOARD] Returning from custom city input" );
-            customCityInput = ""; // CLEAR TEXT ON EXIT
-            keyboardShift = false;
-            keyboardNumbers = false;
-            currentState = CITYSELECT;
-            cityOffset = 0;
-            drawCitySelection();
-
-        }
-        else if ( currentState == CUSTOMCOUNTRYINPUT ) {
-            // For Country Input, position 4*bw is the BACK button
-            log_d( "[KEYBOARD] Returning from custom country input" );
-            customCountryInput = ""; // CLEAR TEXT ON EXIT
-            keyboardShift = false;
-            keyboardNumbers = false;
-            currentState = COUNTRYSELECT;
-            countryOffset = 0;
-            drawCountrySelection();
-        }
-
-        delay( UI_DEBOUNCE_MS );
-        return;
-    }
-
-    // ===== SHOW/HIDE PASSWORD (WIFI ONLY) =====
-    if ( currentState == KEYBOARD && x >= 250 && x <= 320 && y >= 140 && y <= 165 ) {
-        log_d( "[KEYBOARD] SHOW/HIDE password toggled" );
-        showPassword = !showPassword;
-        drawKeyboardScreen();
-        delay( UI_DEBOUNCE_MS );
-        return;
-    }
+    GFX_SCOPE( "drawKeyboardScreen" );
+    bool password = currentState == KEYBOARD;
+    kbBegin( currentState, { password ? "WiFi Password" : "Enter SSID", &passwordBuffer,
+                             "Back", TFT_RED, "OK", TFT_GREEN, password, password && !showPassword, false } );
 }
 
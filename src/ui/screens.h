@@ -3,10 +3,6 @@
 #include <Arduino.h>
 #include <TFT_eSPI.h>
 
-// --- Layout helpers ---
-int  getMenuItemY( int itemIndex );
-bool isTouchInMenuItem( int x, int y, int itemIndex );
-
 // --- WiFi / startup screens ---
 void showWifiConnectingScreen( String ssid );
 void showWifiResultScreen( bool success );
@@ -14,19 +10,14 @@ void drawLoadingScreen();              // Static loading screen shown while NTP
 void drawSyncOverlay( const String &msg, bool okButton );  // Modal overlay for SYNC feedback
 void drawRegionalDstButton();   // Repaint only the DST toggle button (no fillScreen)
 void clearSyncOverlay();        // Erase sync overlay and restore the content beneath it
-void redrawBrightnessSlider();  // Repaint only the brightness slider (no fillScreen)
-void redrawAutoDimLevel();      // Repaint only the auto-dim level value (no fillScreen)
-void redrawAutoDimStart();      // Repaint only the auto-dim start time value
-void redrawAutoDimEnd();        // Repaint only the auto-dim end time value
-void redrawAutoDimSection();    // Repaint the entire auto-dim subpanel (no fillScreen)
-void redrawDigiAnaToggle();     // Repaint only the ANA/DIGI toggle widget
 void scanWifiNetworks();
 
 // --- Touch calibration ---
 void runTouchCalibration();
+void loadTouchCal();        // Calibration for the current orientation → touch task (hal/touch_cal.h)
 
 // --- Settings screens ---
-void drawSettingsScreen();
+void drawSettingsScreen();        // Widget tree (widgets.h); taps go through uiTouch()
 void drawWeatherScreen();
 void drawCoordInputScreen();
 void drawRegionalScreen();
@@ -38,10 +29,8 @@ void drawCityLookupConfirm();
 void drawCustomCityInput();
 void drawCustomCountryInput();
 void drawFirmwareScreen();
-void drawGraphicsScreen();
+void drawGraphicsScreen();        // Widget tree (widgets.h); taps go through uiTouch()
 void drawInitialSetup();
 
 // --- Keyboard ---
-void drawKeyboardScreen();
-void updateKeyboardText();
-void handleKeyboardTouch( int x, int y );
+void drawKeyboardScreen();        // KEYBOARD / SSID_INPUT; the keyboard itself lives in keyboard.h
@@ -1,56 +1,272 @@
 #include "theme.h"
+#include "gfx_stats.h"
 #include "../util/constants.h"
 
 // ---------------------------------------------------------------------------
 // Externs – defined in main.cpp
 // ---------------------------------------------------------------------------
+extern DisplayTFT tft;
 extern int      themeMode;
 extern bool     isWhiteTheme;
-extern uint16_t blueDark;
-extern uint16_t blueLight;
-extern uint16_t yellowDark;
-extern uint16_t yellowLight;
 
 // ---------------------------------------------------------------------------
+// Built-in palettes
+// ---------------------------------------------------------------------------
+static constexpr ThemePalette PALETTE_BLACK = {
+    TFT_BLACK, TFT_BLACK, TFT_WHITE, TFT_YELLOW, TFT_GREEN, TFT_DARKGREY, TFT_WHITE, TFT_WHITE,
+    TFT_SKYBLUE, TFT_RED, TFT_ORANGE, TFT_SKYBLUE, 0x3186, 0x4208, TFT_WHITE, TFT_WHITE, TFT_BLUE
+};
+
+static constexpr ThemePalette PALETTE_WHITE = {
+    TFT_WHITE, TFT_WHITE, TFT_BLACK, TFT_RED, TFT_GREEN, TFT_DARKGREY, TFT_BLACK, TFT_BLACK,
+    TFT_SKYBLUE, TFT_DARKGREEN, TFT_DARKGREEN, TFT_SKYBLUE, 0xDEDB, 0x8410, TFT_DARKGREY, TFT_BLACK, TFT_BLUE
+};
+
+// Dark blue to light blue gradient
+static constexpr ThemePalette PALETTE_BLUE = {
+    0x0010, 0x07FF, 0x07FF, 0xFFE0, 0x07FF, TFT_DARKGREY, TFT_WHITE, 0x07FF,
+    TFT_SKYBLUE, TFT_RED, TFT_ORANGE, TFT_YELLOW, 0x0010, 0x4208, TFT_WHITE, TFT_WHITE, 0xFFE0
+};
 
-uint16_t getBgColor() {
-    if ( themeMode == THEME_DARK ) {
-        return isWhiteTheme ? TFT_WHITE : TFT_BLACK;
+// Dark yellow to light yellow gradient; dark inks for contrast
+static constexpr ThemePalette PALETTE_YELLOW = {
+    0xCC00, 0xFFE0, 0xFFE0, 0x07FF, 0xCC00, 0x0010, TFT_BLACK, TFT_BLACK,
+    0x0220, 0x0220, 0x0220, TFT_BLACK, 0xCC00, 0x4208, TFT_WHITE, TFT_WHITE, TFT_BLUE
+};
+
+ThemePalette        activeTheme   = PALETTE_BLACK;
+static ThemePalette userPalette   = PALETTE_BLACK;
+static bool         userAvailable = false;
+
+const ThemePalette &themePalette( int mode ) {
+    switch ( mode ) {
+        case THEME_WHITE:
+            return PALETTE_WHITE;
+        case THEME_BLUE:
+            return PALETTE_BLUE;
+        case THEME_YELLOW:
+            return PALETTE_YELLOW;
+        case THEME_USER:
+            return userAvailable ? userPalette : PALETTE_BLACK;
+        default:
+            return PALETTE_BLACK;
     }
-    if ( themeMode == THEME_WHITE ) {
-        return isWhiteTheme ? TFT_WHITE : TFT_BLACK;
+}
+
+void themeApply() {
+    if ( themeMode == THEME_USER && !userAvailable ) {
+        log_w( "[THEME] No user theme loaded, using dark" );
     }
-    if ( themeMode == THEME_BLUE ) {
-        return blueDark;    // BLUE - dark background
+    // BLACK and WHITE share isWhiteTheme as their switch
+    bool classic = themeMode != THEME_BLUE && themeMode != THEME_YELLOW && themeMode != THEME_USER;
+    activeTheme  = themePalette( classic ? ( isWhiteTheme ? THEME_WHITE : THEME_DARK ) : themeMode );
+}
+
+// ---------------------------------------------------------------------------
+// User theme
+// ---------------------------------------------------------------------------
+struct ThemeRole {
+    const char *name;
+    uint16_t ThemePalette::*color;
+};
+
+static const ThemeRole THEME_ROLES[] = {
+    { "bg",          &ThemePalette::bg },
+    { "bgBottom",    &ThemePalette::bgBottom },
+    { "text",        &ThemePalette::text },
+    { "secHand",     &ThemePalette::secHand },
+    { "accent",      &ThemePalette::accent },
+    { "tick",        &ThemePalette::tick },
+    { "digits",      &ThemePalette::digits },
+    { "dateText",    &ThemePalette::dateText },
+    { "cityText",    &ThemePalette::cityText },
+    { "holiday",     &ThemePalette::holiday },
+    { "nameday",     &ThemePalette::nameday },
+    { "weatherText", &ThemePalette::weatherText },
+    { "moonShadow",  &ThemePalette::moonShadow },
+    { "cloudShadow", &ThemePalette::cloudShadow },
+    { "keyBorder",   &ThemePalette::keyBorder },
+    { "keyText",     &ThemePalette::keyText },
+    { "listArrow",   &ThemePalette::listArrow },
+};
+
+// "#RRGGBB" (converted to RGB565) or "0xXXXX" (RGB565 as is)
+static bool parseColor( const char *v, uint16_t &out ) {
+    char *end;
+    if ( v[ 0 ] == '#' ) {
+        unsigned long rgb = strtoul( v + 1, &end, 16 );
+        if ( end - v != 7 ) {
+            return false;
+        }
+        out = ( uint16_t )( ( ( rgb >> 8 ) & 0xF800 ) | ( ( rgb >> 5 ) & 0x07E0 ) | ( ( rgb >> 3 ) & 0x001F ) );
+        return true;
     }
-    if ( themeMode == THEME_YELLOW ) {
-        return yellowDark;    // YELLOW - dark background
+    if ( v[ 0 ] == '0' && ( v[ 1 ] == 'x' || v[ 1 ] == 'X' ) ) {
+        unsigned long c = strtoul( v + 2, &end, 16 );
+        if ( end == v + 2 || c > 0xFFFF ) {
+            return false;
+        }
+        out = ( uint16_t )c;
+        return true;
     }
-    return TFT_BLACK;
+    return false;
 }
 
-uint16_t getTextColor() {
-    if ( themeMode == THEME_DARK ) {
-        return isWhiteTheme ? TFT_BLACK : TFT_WHITE;
+bool themeLoadUser( const char *text ) {
+    ThemePalette pal   = PALETTE_BLACK;
+    bool         bgSet = false, bottomSet = false;
+    int          roles = 0;
+    int          lineNo = 0;
+    while ( text != nullptr && *text != '\0' ) {
+        const char *eol = strchr( text, '\n' );
+        int         len = eol ? eol - text : strlen( text );
+        char        line[ 64 ];
+        lineNo++;
+        snprintf( line, sizeof( line ), "%.*s", min( len, ( int )sizeof( line ) - 1 ), text );
+        text = eol ? eol + 1 : nullptr;
+
+        // Split "key = value"; a '#' before the '=' starts a comment line, and
+        // the value ends at the first blank so trailing comments are dropped
+        char *hash = strchr( line, '#' );
+        char *eq   = strchr( line, '=' );
+        if ( eq == nullptr || ( hash != nullptr && hash < eq ) ) {
+            continue;
+        }
+        *eq         = '\0';
+        char *key   = line;
+        char *value = eq + 1;
+        while ( isspace( ( unsigned char )*key ) ) {
+            key++;
+        }
+        while ( isspace( ( unsigned char )*value ) ) {
+            value++;
+        }
+        for ( char *e = key + strlen( key ); e > key && isspace( ( unsigned char )e[ -1 ] ); ) {
+            *--e = '\0';
+        }
+        for ( char *e = value; *e != '\0'; e++ ) {
+            if ( isspace( ( unsigned char )*e ) ) {
+                *e = '\0';
+                break;
+            }
+        }
+
+        const ThemeRole *role = nullptr;
+        for ( const ThemeRole &r : THEME_ROLES ) {
+            if ( strcmp( key, r.name ) == 0 ) {
+                role = &r;
+                break;
+            }
+        }
+        uint16_t color;
+        if ( role == nullptr || !parseColor( value, color ) ) {
+            log_w( "[THEME] User theme line %d ignored: %s = %s", lineNo, key, value );
+            continue;
+        }
+        pal.*( role->color ) = color;
+        bgSet     |= role->color == &ThemePalette::bg;
+        bottomSet |= role->color == &ThemePalette::bgBottom;
+        roles++;
     }
-    if ( themeMode == THEME_WHITE ) {
-        return isWhiteTheme ? TFT_BLACK : TFT_WHITE;
+    if ( bgSet && !bottomSet ) {
+        pal.bgBottom = pal.bg;  // Solid background unless a gradient end is given
     }
-    if ( themeMode == THEME_BLUE ) {
-        return blueLight;    // BLUE - light text
+
+    userAvailable = roles > 0;
+    if ( userAvailable ) {
+        userPalette = pal;
     }
-    if ( themeMode == THEME_YELLOW ) {
-        return yellowLight;    // YELLOW - light text
+    log_i( "[THEME] User theme: %d roles", roles );
+    return userAvailable;
+}
+
+const ThemePalette *themeUserPalette() {
+    return userAvailable ? &userPalette : nullptr;
+}
+
+// ---------------------------------------------------------------------------
+// Background row table
+// ---------------------------------------------------------------------------
+static constexpr int BG_ROWS = 240;     // Screen height in landscape
+
+static uint16_t bgRows[ BG_ROWS ];
+static uint32_t bgStamp    = 0;
+static bool     bgGradient = false;     // false → every row equals getBgColor()
+
+// Palette colours the table was built from
+static uint16_t bgTop = 0, bgBottom = 0;
+
+uint16_t blendColor565( uint16_t a, uint16_t b, int num, int den ) {
+    int r1 = ( a >> 11 ) & 0x1F, g1 = ( a >> 5 ) & 0x3F, b1 = a & 0x1F;
+    int r2 = ( b >> 11 ) & 0x1F, g2 = ( b >> 5 ) & 0x3F, b2 = b & 0x1F;
+
+    int r  = r1 + ( r2 - r1 ) * num / den;
+    int g  = g1 + ( g2 - g1 ) * num / den;
+    int bl = b1 + ( b2 - b1 ) * num / den;
+    return ( uint16_t )( ( r << 11 ) | ( g << 5 ) | bl );
+}
+
+static void ensureBgTable() {
+    uint16_t top    = activeTheme.bg;
+    uint16_t bottom = activeTheme.bgBottom;
+
+    if ( bgStamp != 0 && bgTop == top && bgBottom == bottom ) {
+        return;
+    }
+
+    for ( int y = 0; y < BG_ROWS; y++ ) {
+        bgRows[ y ] = blendColor565( top, bottom, y, BG_ROWS );
+    }
+    bgGradient = ( top != bottom );
+    bgTop      = top;
+    bgBottom   = bottom;
+    bgStamp++;
+    log_d( "[THEME] Background table rebuilt (%s)", bgGradient ? "gradient" : "solid" );
+}
+
+uint16_t getBgColorAt( int y ) {
+    ensureBgTable();
+    return bgRows[ constrain( y, 0, BG_ROWS - 1 ) ];
+}
+
+uint32_t getBgStamp() {
+    ensureBgTable();
+    return bgStamp;
+}
+
+void fillBackground( int x, int y, int w, int h ) {
+    ensureBgTable();
+    if ( w <= 0 || h <= 0 ) {
+        return;
+    }
+    if ( !bgGradient ) {
+        tft.fillRect( x, y, w, h, bgRows[ 0 ] );
+        return;
+    }
+
+    // Neighbouring rows often share a colour (the gradient has ~64 steps over
+    // 240 rows), so each run of equal rows goes out as one fillRect.
+    int y0 = max( y, 0 );
+    int y1 = min( y + h, BG_ROWS );
+    while ( y0 < y1 ) {
+        uint16_t c   = bgRows[ y0 ];
+        int      run = 1;
+        while ( y0 + run < y1 && bgRows[ y0 + run ] == c ) {
+            run++;
+        }
+        tft.fillRect( x, y0, w, run, c );
+        y0 += run;
     }
-    return TFT_WHITE;
 }
 
-uint16_t getSecHandColor() {
-    if ( themeMode == THEME_BLUE ) {
-        return yellowLight;    // Second hand in blue theme = yellow
+void fillSpriteBackground( TFT_eSprite &spr, int y ) {
+    ensureBgTable();
+    if ( !bgGradient ) {
+        spr.fillSprite( bgRows[ 0 ] );
+        return;
     }
-    if ( themeMode == THEME_YELLOW ) {
-        return blueLight;    // Second hand in yellow theme = blue
+    int w = spr.width();
+    for ( int row = 0; row < spr.height(); row++ ) {
+        spr.drawFastHLine( 0, row, w, bgRows[ constrain( y + row, 0, BG_ROWS - 1 ) ] );
     }
-    return isWhiteTheme ? TFT_RED : TFT_YELLOW;
 }
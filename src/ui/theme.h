@@ -3,11 +3,83 @@
 #include <Arduino.h>
 #include <TFT_eSPI.h>
 
-// Returns the background colour for the active theme
-uint16_t getBgColor();
+// ---------------------------------------------------------------------------
+// Theme palette — every theme-dependent colour on screen is one named role.
+// themeApply() resolves themeMode / isWhiteTheme (or the user theme) into the
+// active palette once; lookups are then a single load from it.
+// ---------------------------------------------------------------------------
+struct ThemePalette {
+    uint16_t bg;            // Background; gradient top on BLUE / YELLOW
+    uint16_t bgBottom;      // Gradient bottom (== bg for a solid background)
+    uint16_t text;          // Primary text, dial numerals, hands
+    uint16_t secHand;
+    uint16_t accent;        // Active half of toggles
+    uint16_t tick;          // Minor dial ticks
+    uint16_t digits;        // Digital clock
+    uint16_t dateText;      // Date and week lines
+    uint16_t cityText;
+    uint16_t holiday;
+    uint16_t nameday;
+    uint16_t weatherText;   // Weather readings and moon caption
+    uint16_t moonShadow;    // Unlit part of the moon
+    uint16_t cloudShadow;   // Weather icon cloud shading
+    uint16_t keyBorder;     // Keyboard / keypad key outlines
+    uint16_t keyText;       // Function key captions, input field border
+    uint16_t listArrow;     // Scroll arrows beside lists
+};
 
-// Returns the primary text colour for the active theme
-uint16_t getTextColor();
+extern ThemePalette activeTheme;
 
-// Returns the seconds-hand colour for the active theme
-uint16_t getSecHandColor();
+// Re-resolves the active palette; call after changing themeMode or isWhiteTheme
+void themeApply();
+
+// Parses a user theme ("role = #RRGGBB" or "role = 0xRGB565" per line, '#'
+// comments); roles not listed keep the dark theme's colour. Returns false when
+// nothing usable was found. The theme is selected with themeMode = THEME_USER.
+bool themeLoadUser( const char *text );
+
+// The loaded user palette, nullptr when there is none
+const ThemePalette *themeUserPalette();
+
+// The palette a theme mode selects: THEME_DARK … THEME_YELLOW, or THEME_USER
+// (the dark one while no user theme is loaded)
+const ThemePalette &themePalette( int mode );
+
+inline const ThemePalette &theme() {
+    return activeTheme;
+}
+
+inline uint16_t getBgColor() {
+    return activeTheme.bg;
+}
+
+inline uint16_t getTextColor() {
+    return activeTheme.text;
+}
+
+inline uint16_t getSecHandColor() {
+    return activeTheme.secHand;
+}
+
+// ---------------------------------------------------------------------------
+// Background table — BLUE/YELLOW themes paint a vertical gradient, so the
+// "background" depends on the screen row. One RGB565 colour per row is cached
+// for the active theme and rebuilt automatically when the theme changes.
+// ---------------------------------------------------------------------------
+
+// Linear blend of two RGB565 colours, num/den of the way from a to b
+uint16_t blendColor565( uint16_t a, uint16_t b, int num, int den );
+
+// Background colour of screen row y for the active theme
+uint16_t getBgColorAt( int y );
+
+// Changes every time the row table is rebuilt; cache key for anything that
+// bakes the background in (e.g. the analog dial sprite)
+uint32_t getBgStamp();
+
+// Restores the true theme background under a screen rectangle
+void fillBackground( int x, int y, int w, int h );
+
+// Fills a sprite with the background it will cover when pushed at screen row y
+// (the gradient runs top to bottom only, so x does not matter)
+void fillSpriteBackground( TFT_eSprite &spr, int y );
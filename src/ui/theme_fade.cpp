@@ -0,0 +1,290 @@
+#include "theme_fade.h"
+#include "dma_push.h"
+#include "gfx_stats.h"
+#include <TFT_eSPI.h>
+
+#include "../data/app_state.h"
+#include "../util/constants.h"
+#include "../util/scheduler.h"
+
+// ---------------------------------------------------------------------------
+// Externs – defined in main.cpp
+// ---------------------------------------------------------------------------
+extern DisplayTFT  tft;
+extern int         themeMode;
+extern bool        isWhiteTheme;
+extern bool        dayNightTheme;
+extern float       themeTransition;
+extern ScreenState currentState;
+extern int         lastSec;
+
+// ---------------------------------------------------------------------------
+
+static constexpr int FADE_KEEP  = 0;    // Not a theme colour: never re-sent
+static constexpr int FADE_BG    = 1;    // Background; colour depends on the row
+static constexpr int FADE_SLOTS = 16;   // 4-bit indices
+static constexpr int FADE_STRIP = 8;    // Rows per readRect() during capture
+
+// Roles in match priority: when several share an old colour the first one
+// decides where that colour goes
+static uint16_t ThemePalette::*const FADE_ROLES[] = {
+    &ThemePalette::text,        &ThemePalette::digits,      &ThemePalette::dateText,
+    &ThemePalette::cityText,    &ThemePalette::tick,        &ThemePalette::secHand,
+    &ThemePalette::accent,      &ThemePalette::weatherText, &ThemePalette::holiday,
+    &ThemePalette::nameday,     &ThemePalette::keyBorder,   &ThemePalette::keyText,
+    &ThemePalette::listArrow,   &ThemePalette::moonShadow,  &ThemePalette::cloudShadow,
+};
+
+// Colours the screens also use for fixed, theme-independent buttons (SAVE,
+// BACK, unselected swatches...). A role that starts in one of them is not
+// faded, so those buttons do not flicker; its pixels settle in the repaint.
+static const uint16_t FIXED_COLORS[] = { TFT_RED, TFT_GREEN, TFT_BLUE, TFT_ORANGE, TFT_SKYBLUE, TFT_DARKGREY };
+
+// readRect() / pushRect() buffers hold panel (big-endian) byte order
+static inline uint16_t swap565( uint16_t c ) {
+    return ( uint16_t )( ( c >> 8 ) | ( c << 8 ) );
+}
+
+static inline uint16_t oldBgAt( const ThemePalette &from, int y, int h ) {
+    return blendColor565( from.bg, from.bgBottom, y, h );
+}
+
+// The fade in progress: index map and slot table from the capture, played
+// back one frame per fadeJob run
+static void     fadeTick();
+static SchedJob fadeJob = { "theme-fade", fadeTick };
+
+static ThemePalette    fadeFrom;
+static uint16_t        oldColor[ FADE_SLOTS ], newColor[ FADE_SLOTS ];
+static int             slots     = 0;
+static bool            bgChanges = false;
+static uint8_t        *indexMap  = nullptr;     // Two pixels per byte, even x in the low nibble
+static uint8_t        *rowWork   = nullptr;     // Per row: any indexed pixel
+static uint16_t       *strip     = nullptr;     // Capture strip, then the line buffer
+static int             frame     = 0;
+static uint32_t        fadeStart = 0;
+static ThemeFadeDoneFn fadeDone  = nullptr;
+
+static void fadeEnd() {
+    schedCancel( fadeJob );
+    free( indexMap );
+    free( strip );
+    indexMap        = nullptr;
+    strip           = nullptr;
+    themeTransition = 0.0f;
+    log_d( "[THEME] Crossfade: %d slots, %d frames in %lu ms", slots - FADE_BG - 1, frame,
+           ( unsigned long )( millis() - fadeStart ) );
+
+    ThemeFadeDoneFn done = fadeDone;
+    fadeDone             = nullptr;
+    if ( done ) {
+        done();
+    }
+}
+
+// One frame: blend the slot colours, re-send runs of indexed pixels
+static void fadeTick() {
+    GFX_SCOPE( "themeFadeFrame" );
+    const int w = tft.width();
+    const int h = tft.height();
+    int       f = ++frame;
+
+    uint16_t lut[ FADE_SLOTS ];
+    for ( int s = FADE_BG + 1; s < slots; s++ ) {
+        lut[ s ] = swap565( blendColor565( oldColor[ s ], newColor[ s ], f, THEME_FADE_FRAMES ) );
+    }
+    dmaSync();
+    tft.startWrite();
+    for ( int y = 0; y < h; y++ ) {
+        if ( !rowWork[ y ] ) {
+            continue;
+        }
+        if ( bgChanges ) {
+            lut[ FADE_BG ] = swap565( blendColor565( oldBgAt( fadeFrom, y, h ), getBgColorAt( y ), f, THEME_FADE_FRAMES ) );
+        }
+        const uint8_t *row = indexMap + y * w / 2;
+        int            x   = 0;
+        while ( x < w ) {
+            while ( x < w && ( ( row[ x >> 1 ] >> ( ( x & 1 ) * 4 ) ) & 0x0F ) == FADE_KEEP ) {
+                x++;
+            }
+            int start = x;
+            for ( ; x < w; x++ ) {
+                uint8_t idx = ( row[ x >> 1 ] >> ( ( x & 1 ) * 4 ) ) & 0x0F;
+                if ( idx == FADE_KEEP ) {
+                    break;
+                }
+                strip[ x ] = lut[ idx ];
+            }
+            if ( x > start ) {
+                tft.pushRect( start, y, x - start, 1, strip + start );
+            }
+        }
+    }
+    tft.endWrite();
+    themeTransition = ( float )f / THEME_FADE_FRAMES;
+
+    if ( f == THEME_FADE_FRAMES ) {
+        fadeEnd();
+    }
+}
+
+bool themeFade( const ThemePalette &from, ThemeFadeDoneFn done ) {
+    GFX_SCOPE( "themeFade" );
+    themeFadeFinish();
+
+    const ThemePalette &to = activeTheme;
+    const int           w  = tft.width();
+    const int           h  = tft.height();
+
+    // Slot table: old → new colour for every role that actually changes
+    uint16_t seen[ FADE_SLOTS ];
+    int      seenCount = 0;
+    slots              = FADE_BG + 1;
+    for ( uint16_t ThemePalette::*role : FADE_ROLES ) {
+        uint16_t c   = from.*role;
+        bool     dup = false;
+        for ( int i = 0; i < seenCount; i++ ) {
+            dup |= seen[ i ] == c;
+        }
+        for ( uint16_t fixed : FIXED_COLORS ) {
+            dup |= fixed == c;
+        }
+        if ( dup || seenCount == FADE_SLOTS ) {
+            continue;
+        }
+        seen[ seenCount++ ] = c;
+        if ( to.*role != c && slots < FADE_SLOTS ) {
+            oldColor[ slots ] = c;
+            newColor[ slots ] = to.*role;
+            slots++;
+        }
+    }
+    bgChanges = from.bg != to.bg || from.bgBottom != to.bgBottom;
+    if ( slots == FADE_BG + 1 && !bgChanges ) {
+        if ( done ) {
+            done();
+        }
+        return true;
+    }
+
+    // Index map plus one "row has work" byte per row, and a strip buffer
+    // reused as the line buffer
+    indexMap = ( uint8_t * )malloc( w * h / 2 + h );
+    strip    = ( uint16_t * )malloc( w * FADE_STRIP * sizeof( uint16_t ) );
+    if ( indexMap == nullptr || strip == nullptr ) {
+        free( indexMap );
+        free( strip );
+        indexMap = nullptr;
+        strip    = nullptr;
+        log_w( "[THEME] Crossfade skipped: no memory for the index map" );
+        if ( done ) {
+            done();
+        }
+        return false;
+    }
+    rowWork = indexMap + w * h / 2;
+
+    // Capture: the one part that blocks, as the screen must be read before
+    // anything draws over it
+    fadeStart = millis();
+    dmaSync();
+    for ( int y0 = 0; y0 < h; y0 += FADE_STRIP ) {
+        int rows = min( FADE_STRIP, h - y0 );
+        tft.readRect( 0, y0, w, rows, strip );
+        for ( int r = 0; r < rows; r++ ) {
+            int             y    = y0 + r;
+            uint16_t        bg   = bgChanges ? oldBgAt( from, y, h ) : 0;
+            const uint16_t *px   = strip + r * w;
+            uint8_t        *row  = indexMap + y * w / 2;
+            bool            work = false;
+            for ( int x = 0; x < w; x++ ) {
+                uint16_t c   = swap565( px[ x ] );
+                uint8_t  idx = FADE_KEEP;
+                if ( bgChanges && c == bg ) {
+                    idx = FADE_BG;
+                }
+                else {
+                    for ( int s = FADE_BG + 1; s < slots; s++ ) {
+                        if ( c == oldColor[ s ] ) {
+                            idx = s;
+                            break;
+                        }
+                    }
+                }
+                work |= idx != FADE_KEEP;
+                if ( x & 1 ) {
+                    row[ x >> 1 ] |= idx << 4;
+                }
+                else {
+                    row[ x >> 1 ] = idx;
+                }
+            }
+            rowWork[ y ] = work;
+        }
+    }
+    log_d( "[THEME] Crossfade capture %lu ms", ( unsigned long )( millis() - fadeStart ) );
+
+    fadeFrom = from;
+    fadeDone = done;
+    frame    = 0;
+    schedEvery( fadeJob, THEME_FADE_MS / THEME_FADE_FRAMES, 0 );
+    return true;
+}
+
+bool themeFadeActive() {
+    return indexMap != nullptr;
+}
+
+void themeFadeFinish() {
+    if ( themeFadeActive() ) {
+        fadeEnd();
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Day / night
+// ---------------------------------------------------------------------------
+
+// "HH:MM" → minutes since midnight, -1 while unknown ("--:--")
+static int minutesOfDay( const String &hhmm ) {
+    if ( hhmm.length() != 5 || !isdigit( hhmm[ 0 ] ) || hhmm[ 2 ] != ':' ) {
+        return -1;
+    }
+    return hhmm.substring( 0, 2 ).toInt() * 60 + hhmm.substring( 3 ).toInt();
+}
+
+static void dayNightFaded() {
+    lastSec = -1;   // Full clock repaint in the new theme
+}
+
+void themeDayNightTick() {
+    if ( !dayNightTheme || ( themeMode != THEME_DARK && themeMode != THEME_WHITE ) ) {
+        return;
+    }
+    int rise = minutesOfDay( app.weather.sunrise );
+    int set  = minutesOfDay( app.weather.sunset );
+    if ( rise < 0 || set < 0 ) {
+        return;     // No weather fetch yet
+    }
+
+    time_t     now      = time( nullptr );
+    struct tm *timeinfo = localtime( &now );
+    if ( !timeinfo || timeinfo->tm_year < 125 ) {
+        return;     // Time not synced
+    }
+    int  minute = timeinfo->tm_hour * 60 + timeinfo->tm_min;
+    bool day    = minute >= rise && minute < set;
+    if ( day == isWhiteTheme || currentState != CLOCK ) {
+        return;     // Already right, or a settings screen is up: try again next tick
+    }
+
+    // Not saved to NVS: the stored theme stays the user's choice
+    ThemePalette from = activeTheme;
+    isWhiteTheme      = day;
+    themeMode         = day ? THEME_WHITE : THEME_DARK;
+    themeApply();
+    log_i( "[THEME] %s theme at %02d:%02d", day ? "Day" : "Night", timeinfo->tm_hour, timeinfo->tm_min );
+
+    themeFade( from, dayNightFaded );
+}
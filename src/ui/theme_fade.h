@@ -0,0 +1,38 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "theme.h"
+
+// ---------------------------------------------------------------------------
+// Theme crossfade
+//
+// The screen is read back once and every pixel is classified against the old
+// palette into a 4-bit index map: background, one of the palette roles, or
+// "keep" (theme-independent colours and anti-aliased edges). Each frame then
+// only blends the small index → colour table and re-sends the indexed pixels;
+// no geometry is redrawn. The caller repaints the screen normally afterwards,
+// which leaves the exact new-theme image (edges included).
+// ---------------------------------------------------------------------------
+
+typedef void ( *ThemeFadeDoneFn )();
+
+// Fades the screen from palette `from` to the active palette (call after
+// themeApply()). Only the capture blocks (one full-screen read-back); the
+// THEME_FADE_FRAMES frames then run from a scheduler job over THEME_FADE_MS
+// and done() follows the last one. done() is called at once when there is
+// nothing to fade, or when the index map cannot be allocated (returns false;
+// the screen is then left untouched).
+bool themeFade( const ThemePalette &from, ThemeFadeDoneFn done );
+
+// A fade is playing: it owns the screen until done() has run
+bool themeFadeActive();
+
+// Skips the frames left and calls done(); loop() does this before a touch
+// handler draws. No-op when no fade is playing.
+void themeFadeFinish();
+
+// Automatic day/night switch for the classic themes: WHITE between sunrise and
+// sunset, DARK otherwise. Cheap; call about once a minute from loop(). Acts
+// only while the clock is showing and once sunrise / sunset are known.
+void themeDayNightTick();
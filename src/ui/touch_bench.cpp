@@ -0,0 +1,203 @@
+#include "touch_bench.h"
+
+#ifdef TOUCH_TRACE
+
+#include "dma_push.h"
+
+#include "../data/app_state.h"
+#include "../hal/touch.h"
+#include "../hal/touch_trace.h"
+#include "../util/scheduler.h"
+
+// ---------------------------------------------------------------------------
+// Externs – defined in main.cpp
+// ---------------------------------------------------------------------------
+extern bool displayFlipped;
+
+// ---------------------------------------------------------------------------
+
+static constexpr int      BENCH_SCREENS   = COORDSINPUT + 1;
+static constexpr size_t   DUMP_LINE_BYTES = 32;
+static constexpr int      DUMP_LINES_POLL = 4;      // Per poll, so a dump does not stall the UI
+static constexpr uint32_t BENCH_POLL_MS   = 20;
+
+static uint8_t       traceBuf[ TOUCH_TRACE_MAX_BYTES ];
+static size_t        traceLen  = 0;
+static size_t        loadLen   = 0;
+static size_t        dumpPos   = 0;
+static size_t        dumpEnd   = 0;
+static bool          recActive = false;
+
+static char          line[ 16 + 2 * DUMP_LINE_BYTES ];
+static size_t        lineLen  = 0;
+static bool          lineLong = false;
+
+// Touch-to-pixel per screen
+static uint32_t      latCount[ BENCH_SCREENS ], latSum[ BENCH_SCREENS ], latMax[ BENCH_SCREENS ];
+static bool          pending     = false;
+static uint32_t      pendingUs   = 0;
+static int           pendingScr  = 0;
+static bool          replayRan   = false;
+static unsigned long replayEndMs = 0;
+
+static void startReplay() {
+    TouchTraceReader rd;
+    if ( !touchTraceOpen( rd, traceBuf, traceLen ) ) {
+        log_w( "[BENCH] No trace in memory" );
+        return;
+    }
+    if ( ( ( rd.flags & TOUCH_TRACE_FLIPPED ) != 0 ) != displayFlipped ) {
+        log_w( "[BENCH] Trace was recorded in the other orientation" );
+    }
+    memset( latCount, 0, sizeof( latCount ) );
+    memset( latSum, 0, sizeof( latSum ) );
+    memset( latMax, 0, sizeof( latMax ) );
+    pending = false;
+    if ( touchReplayStart( traceBuf, traceLen ) ) {
+        replayRan   = true;
+        replayEndMs = 0;
+        log_i( "[BENCH] Replaying %u bytes", ( unsigned )traceLen );
+    }
+}
+
+static void report() {
+    uint32_t total = 0;
+    for ( int s = 0; s < BENCH_SCREENS; s++ ) {
+        if ( latCount[ s ] == 0 ) {
+            continue;
+        }
+        total += latCount[ s ];
+        log_i( "[BENCH] screen %2d: %3lu presses, touch-to-pixel avg %6lu us, max %6lu us", s,
+               ( unsigned long )latCount[ s ], ( unsigned long )( latSum[ s ] / latCount[ s ] ), ( unsigned long )latMax[ s ] );
+    }
+    log_i( "[BENCH] Replay done, %lu presses handled", ( unsigned long )total );
+}
+
+static int hexNibble( char c ) {
+    if ( c >= '0' && c <= '9' ) {
+        return c - '0';
+    }
+    if ( c >= 'a' && c <= 'f' ) {
+        return c - 'a' + 10;
+    }
+    if ( c >= 'A' && c <= 'F' ) {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+static void command( const char *cmd ) {
+    if ( strcmp( cmd, "trace rec" ) == 0 ) {
+        touchReplayStop();
+        touchRecordStart( traceBuf, sizeof( traceBuf ), displayFlipped ? TOUCH_TRACE_FLIPPED : 0 );
+        recActive = true;
+        traceLen  = 0;
+        log_i( "[BENCH] Recording (room for %u bytes)", ( unsigned )sizeof( traceBuf ) );
+    }
+    else if ( strcmp( cmd, "trace stop" ) == 0 ) {
+        touchReplayStop();
+        if ( recActive ) {
+            recActive = false;
+            traceLen  = touchRecordStop();
+            dumpPos   = 0;
+            dumpEnd   = traceLen;
+            log_i( "[BENCH] Recorded %u bytes", ( unsigned )traceLen );
+        }
+    }
+    else if ( strcmp( cmd, "trace play" ) == 0 ) {
+        startReplay();
+    }
+    else if ( strcmp( cmd, "TRACE END" ) == 0 ) {
+        TouchTraceReader rd;
+        traceLen = touchTraceOpen( rd, traceBuf, loadLen ) ? loadLen : 0;
+        log_i( "[BENCH] Loaded %u bytes%s", ( unsigned )loadLen, traceLen ? "" : " (not a trace)" );
+        loadLen = 0;
+    }
+    else if ( strncmp( cmd, "TRACE ", 6 ) == 0 ) {
+        for ( const char *p = cmd + 6; p[ 0 ] && p[ 1 ] && loadLen < sizeof( traceBuf ); p += 2 ) {
+            int hi = hexNibble( p[ 0 ] ), lo = hexNibble( p[ 1 ] );
+            if ( hi < 0 || lo < 0 ) {
+                break;
+            }
+            traceBuf[ loadLen++ ] = ( uint8_t )( hi << 4 | lo );
+        }
+    }
+}
+
+static void benchPoll() {
+    while ( Serial.available() > 0 ) {
+        char c = ( char )Serial.read();
+        if ( c == '\r' ) {
+            continue;
+        }
+        if ( c != '\n' ) {
+            if ( lineLen < sizeof( line ) - 1 ) {
+                line[ lineLen++ ] = c;
+            }
+            else {
+                lineLong = true;
+            }
+            continue;
+        }
+        line[ lineLen ] = '\0';
+        if ( !lineLong ) {
+            command( line );
+        }
+        lineLen  = 0;
+        lineLong = false;
+    }
+
+    // A finished recording goes out a few lines per pass
+    for ( int i = 0; i < DUMP_LINES_POLL && dumpPos < dumpEnd; i++ ) {
+        char   hex[ 2 * DUMP_LINE_BYTES + 1 ];
+        size_t n = min( DUMP_LINE_BYTES, dumpEnd - dumpPos );
+        for ( size_t j = 0; j < n; j++ ) {
+            snprintf( hex + 2 * j, 3, "%02x", traceBuf[ dumpPos + j ] );
+        }
+        Serial.printf( "TRACE %s\n", hex );
+        dumpPos += n;
+        if ( dumpPos == dumpEnd ) {
+            Serial.printf( "TRACE END\n" );
+        }
+    }
+
+    // The last presses reach the handlers a moment after the replay itself ends
+    if ( replayRan && !touchReplaying() ) {
+        if ( replayEndMs == 0 ) {
+            replayEndMs = millis();
+        }
+        else if ( millis() - replayEndMs >= 1000 ) {
+            replayRan = false;
+            report();
+        }
+    }
+}
+
+static SchedJob pollJob = { "bench", benchPoll };
+
+void touchBenchBegin() {
+    schedEvery( pollJob, BENCH_POLL_MS );
+}
+
+void touchBenchDispatched( uint32_t eventUs, int screen ) {
+    if ( !replayRan || screen < 0 || screen >= BENCH_SCREENS ) {
+        return;
+    }
+    pending    = true;
+    pendingUs  = eventUs;
+    pendingScr = screen;
+}
+
+void touchBenchPassDone() {
+    if ( !pending ) {
+        return;
+    }
+    pending = false;
+    dmaSync();      // Pixels are on the panel once the last transfer is done
+    uint32_t lat = micros() - pendingUs;
+    latCount[ pendingScr ]++;
+    latSum[ pendingScr ] += lat;
+    latMax[ pendingScr ]  = max( latMax[ pendingScr ], lat );
+}
+
+#endif
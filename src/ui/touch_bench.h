@@ -0,0 +1,37 @@
+#pragma once
+
+#include <Arduino.h>
+
+// ---------------------------------------------------------------------------
+// Touch trace console and touch-to-pixel benchmark (build with -D TOUCH_TRACE)
+//
+// Serial commands, one per line, read by a scheduler job every 20 ms:
+//   trace rec      record live presses (hal/touch.h recorder, touch_trace.h format)
+//   trace stop     stop recording or replaying; a recording is then printed as
+//                  TRACE lines
+//   trace play     replay the trace in memory through the touch pipeline
+//   TRACE <hex>    trace data as printed by "trace stop", ended by "TRACE END";
+//                  pasting a saved dump back loads it for "trace play"
+//
+// While a replay runs, loop() reports every press it hands to a touch handler
+// and the end of that pass. Touch-to-pixel latency is the time from the
+// injected sample (TouchEvent::us) to the end of the pass with the last DMA
+// transfer done, so it covers the handler, any redraw the pass triggered and
+// the compositor flush. It is kept per screen and logged when the replay ends.
+//
+// Without TOUCH_TRACE every call compiles to nothing.
+// ---------------------------------------------------------------------------
+
+#ifdef TOUCH_TRACE
+
+void touchBenchBegin();                                     // Starts the serial console job
+void touchBenchDispatched( uint32_t eventUs, int screen );  // A handler ran for this event
+void touchBenchPassDone();                                  // End of the loop() pass
+
+#else
+
+inline void touchBenchBegin() {}
+inline void touchBenchDispatched( uint32_t, int ) {}
+inline void touchBenchPassDone() {}
+
+#endif
@@ -1,13 +1,16 @@
-#include <XPT2046_Touchscreen.h>
-
 #include "touch_handler.h"
 #include "theme.h"
 #include "icons.h"
+#include "keyboard.h"
 #include "clock_face.h"
+#include "dma_push.h"
+#include "gfx_stats.h"
 #include "screens.h"
-#include "../hal/backlight.h"
+#include "vlist.h"
+#include "widgets.h"
 
 #include "../hal/led.h"
+#include "../hal/touch.h"
 
 #include <WiFi.h>
 #include <TFT_eSPI.h>
@@ -15,6 +18,7 @@
 #include <time.h>
 
 #include "../util/constants.h"
+#include "../util/scheduler.h"
 #include "../data/app_state.h"
 #include "../data/city_data.h"
 #include "../data/nameday.h"
@@ -24,14 +28,9 @@
 // ---------------------------------------------------------------------------
 // Externs — all defined in main.cpp
 // ---------------------------------------------------------------------------
-extern TFT_eSPI   tft;
-extern XPT2046_Touchscreen ts;
+extern DisplayTFT tft;
 extern bool       isWhiteTheme;
 extern int        themeMode;
-extern uint16_t   blueLight;
-extern uint16_t   blueDark;
-extern uint16_t   yellowLight;
-extern uint16_t   yellowDark;
 
 // Layout
 extern const int  MENU_BASE_Y;
@@ -78,11 +77,6 @@ extern String     customCountryInput;
 extern String     weatherCity;
 extern String     timezoneName;
 
-// Weather units
-extern bool       weatherUnitF;
-extern bool       weatherUnitMph;
-extern bool       weatherUnitInHg;
-
 // OTA / firmware
 extern const char *FIRMWARE_VERSION;
 extern String     availableVersion;
@@ -102,14 +96,6 @@ extern int        autoDimEnd;
 extern int        autoDimLevel;
 extern bool       invertColors;
 extern bool       displayFlipped;
-extern int        touchXMin;
-extern int        touchXMax;
-extern int        touchYMin;
-extern int        touchYMax;
-extern int        touchXMinF;
-extern int        touchXMaxF;
-extern int        touchYMinF;
-extern int        touchYMaxF;
 extern int        autoDimEditMode;
 extern int        autoDimTempStart;
 extern int        autoDimTempEnd;
@@ -118,6 +104,8 @@ extern int        autoDimTempLevel;
 // Clock / time
 extern bool       isDigitalClock;
 extern bool       is12hFormat;
+extern bool       sweepMode;
+extern int        digitTransition;
 extern long       gmtOffset_sec;
 extern int        daylightOffset_sec;
 extern int        lastSec;
@@ -147,18 +135,123 @@ bool   getTimezoneForCity( String countryName, String city, String &timezone,
                            int &gmt, int &dst );
 bool   lookupCountryGeonames( String countryName );
 bool   lookupCityGeonames( String cityName, String countryHint );
-void   getCountryCities( String countryName, String cities[], int &count );
 String obfuscatePassword( const String &plain );
 String syncRegion();
+
 // ---------------------------------------------------------------------------
-void handleTouch( int x, int y ) {
+// Modal UI states. Splash messages and dialogs used to sleep or spin inside
+// the handler, freezing the clock; now the handler starts a modal and its
+// scheduler job finishes it from loop(). While one is up it takes every
+// touch.
+// ---------------------------------------------------------------------------
+enum UiModal : uint8_t {
+    MODAL_NONE,
+    MODAL_SPLASH,           // Message up for the time given, then modalDone
+    MODAL_SYNC_ERROR,       // Sync error overlay: OK, or UI_MODAL_TIMEOUT_MS, runs modalDone
+    MODAL_WIFI_CONNECT      // "Connecting to..." until WiFi connects or WIFI_CONNECT_TIMEOUT
+};
+
+typedef void ( *ModalDoneFn )();
+
+static constexpr unsigned long WIFI_POLL_MS = 100;   // Connect status checks while MODAL_WIFI_CONNECT is up
+
+static void modalTick();
+
+static UiModal       modal      = MODAL_NONE;
+static unsigned long modalStart = 0;
+static ModalDoneFn   modalDone  = nullptr;
+static bool          wifiBegun  = false;
+static SchedJob      modalJob   = { "modal", modalTick };
+
+// The modal's job runs ms from now
+static void startModal( UiModal kind, unsigned long ms, ModalDoneFn done ) {
+    modal      = kind;
+    modalStart = millis();
+    modalDone  = done;
+    schedAfter( modalJob, ms );
+}
+
+static void endModal() {
+    ModalDoneFn done = modalDone;
+    schedCancel( modalJob );
+    modal     = MODAL_NONE;
+    modalDone = nullptr;
+    if ( done ) {
+        dmaSync();      // The continuation draws straight to tft
+        done();
+    }
+}
+
+static void wifiConnected() {
+    if ( regionAutoMode ) {
+        syncRegion();
+    }
+    currentState = CLOCK;
+    lastSec = -1;
+}
+
+static void wifiFailed() {
+    currentState = WIFICONFIG;
+    drawInitialSetup();
+}
+
+// Splash and dialog timeouts end the modal; a WiFi connect polls until done
+static void modalTick() {
+    switch ( modal ) {
+        case MODAL_NONE:
+            break;
+
+        case MODAL_WIFI_CONNECT: {
+            // The first run comes a moment after the disconnect and starts the new association
+            if ( !wifiBegun ) {
+                WiFi.begin( ssid.c_str(), password.c_str() );
+                wifiBegun  = true;
+                modalStart = millis();
+                schedAfter( modalJob, WIFI_POLL_MS );
+                break;
+            }
+            bool connected = WiFi.status() == WL_CONNECTED;
+            if ( connected || millis() - modalStart >= WIFI_CONNECT_TIMEOUT ) {
+                dmaSync();
+                showWifiResultScreen( connected );
+                startModal( MODAL_SPLASH, UI_SPLASH_DELAY_MS, connected ? wifiConnected : wifiFailed );
+            }
+            else {
+                schedAfter( modalJob, WIFI_POLL_MS );
+            }
+            break;
+        }
+
+        default:
+            endModal();
+            break;
+    }
+}
+
+// Touch while a modal is up: only the sync error's OK button does anything
+static bool modalTouch( int x, int y ) {
+    if ( modal == MODAL_NONE ) {
+        return false;
+    }
+    if ( modal == MODAL_SYNC_ERROR && x >= 110 && x <= 210 && y >= 134 && y <= 158 ) {
+        endModal();
+        touchHoldOff( UI_DEBOUNCE_MS );
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+void handleTouch( int x, int y, TouchEventType type ) {
+    if ( modalTouch( x, y ) ) {
+        return;
+    }
     switch ( currentState ) {
         case CLOCK: {
             // WiFi + update icon bounding box — jump directly to FIRMWARE screen (only when update icon is visible)
             if ( updateAvailable && x >= 295 && x <= 325 && y >= 10 && y <= 30 ) {
                 currentState = FIRMWARE_SETTINGS;
                 drawFirmwareScreen();
-                delay( UI_DEBOUNCE_MS );
+                touchHoldOff( UI_DEBOUNCE_MS );
             }
             // Settings button
             else if ( x >= 270 && x <= 320 && y >= 200 && y <= 240 ) {
@@ -176,365 +269,150 @@ void handleTouch( int x, int y ) {
                 prefs.end();
                 // Force redraw by clearing lastSec
                 lastSec = -1;
-                delay( TOUCH_DEBOUNCE_MS );
+                touchHoldOff( TOUCH_DEBOUNCE_MS );
+            }
+            // Touch on the analog clock toggles smooth-sweep hands (ANALOG MODE ONLY)
+            else if ( !isDigitalClock && x >= 160 && x <= 300 && y >= 20 && y <= 150 ) {
+                sweepMode = !sweepMode;
+                prefs.begin( "sys", false );
+                prefs.putBool( "sweep", sweepMode );
+                prefs.end();
+                forceClockRedraw = true;   // Next frame repaints the whole dial in the new style
+                touchHoldOff( TOUCH_DEBOUNCE_MS );
             }
             break;
         }
 
-        case SETTINGS: {
-            // Back button (red)
-            if ( x >= 230 && x <= 280 && y >= 125 && y <= 175 ) {
-                currentState = CLOCK;
-                lastSec = -1;
-                delay( UI_DEBOUNCE_MS );
-            }
-            // Up arrow
-            else if ( menuOffset > 0 && x >= 230 && x <= 280 && y >= 70 && y <= 120 ) {
-                menuOffset--;
-                drawSettingsScreen();
-                delay( UI_DEBOUNCE_MS );
-            }
-            // Down arrow
-            else if ( menuOffset < 2 && x >= 230 && x <= 280 && y >= 180 && y <= 230 ) {
-                menuOffset++;
-                drawSettingsScreen();
-                delay( UI_DEBOUNCE_MS );
-            }
-            // Detect taps on menu items
-            else {
-                for ( int i = 0; i < 4; i++ ) { // 4 visible items on screen
-                    if ( isTouchInMenuItem( x, y, i ) ) {
-                        int actualItem = i + menuOffset;  // Remap: visual position → actual item
-
-                        switch ( actualItem ) {
-                            case 0: // WiFi Setup
-                                currentState = WIFICONFIG;
-                                scanWifiNetworks();
-                                wifiOffset = 0;
-                                drawInitialSetup();
-                                break;
-
-                            case 1: // Weather
-                                currentState = WEATHERCONFIG;
-                                drawWeatherScreen();
-                                break;
-
-                            case 2: // Regional
-                                currentState = REGIONALCONFIG;
-                                drawRegionalScreen();
-                                break;
-
-                            case 3: // Graphics
-                                currentState = GRAPHICSCONFIG;
-                                drawGraphicsScreen();
-                                break;
-
-                            case 4: // Firmware
-                                currentState = FIRMWARE_SETTINGS;
-                                drawFirmwareScreen();
-                                break;
-
-                            case 5: // Calibrate
-                                runTouchCalibration();
-                                menuOffset = 0;
-                                drawSettingsScreen();
-                                break;
-                        }
-
-                        delay( UI_DEBOUNCE_MS );
-                        break;  // Exit for loop
-                    }
-                }
-            }
+        case SETTINGS:
+            uiTouch( x, y );
             break;
-        }
 
         case WIFICONFIG: {
-            if ( ssid != "" && x >= 265 && x <= 315 && y >= 50 && y <= 100 ) {
+            // Rows 0-4 scroll (arrows or drag); a tap picks the network on release
+            if ( vlistPressed() ) {
+                int row = vlistTouch( x, y, type );
+                if ( row >= 0 ) {
+                    selectedSSID = wifiSSIDs[ row ];
+                    currentState = KEYBOARD;
+                    passwordBuffer = "";
+                    keyboardNumbers = false;
+                    keyboardShift = false;
+                    drawKeyboardScreen();
+                }
+            }
+            else if ( ssid != "" && x >= 265 && x <= 315 && y >= 50 && y <= 100 ) {
                 currentState = SETTINGS;
                 menuOffset = 0;
                 drawSettingsScreen();
             }
             else if ( x >= 265 && x <= 315 && y >= 110 && y <= 160 ) {
-                if ( wifiOffset > 0 ) {
-                    wifiOffset--;
-                    drawInitialSetup();
+                if ( vlistCanScroll( -1 ) ) {
+                    vlistStep( -1 );
                 }
             }
             else if ( x >= 265 && x <= 315 && y >= 170 && y <= 220 ) {
-                if ( wifiOffset + 5 < wifiCount ) {
-                    wifiOffset++;
-                    drawInitialSetup();
-                }
-            }
-            else {
-                bool handled = false;
-                // Only rows 0-4 are scrollable network entries; row 5 is the pinned "Other..."
-                for ( int i = wifiOffset; i < wifiOffset + 5 && i < wifiCount; i++ ) {
-                    int idx = i - wifiOffset;
-                    int yPos = 45 + idx * 30;
-                    if ( y >= yPos && y <= yPos + 25 ) {
-                        selectedSSID = wifiSSIDs[ i ];
-                        currentState = KEYBOARD;
-                        passwordBuffer = "";
-                        keyboardNumbers = false;
-                        keyboardShift = false;
-                        drawKeyboardScreen();
-                        handled = true;
-                        break;
-                    }
-                }
-                // Check tap on "Other..." row — always pinned at row 5
-                if ( !handled ) {
-                    int yPos = 45 + 5 * 30;
-                    if ( y >= yPos && y <= yPos + 25 ) {
-                        selectedSSID = "";
-                        currentState = SSID_INPUT;
-                        passwordBuffer = "";
-                        keyboardNumbers = false;
-                        keyboardShift = false;
-                        drawKeyboardScreen();
-                    }
-                }
-            }
-            break;
-        }
-
-        case SSID_INPUT: {
-            // Same key handling as KEYBOARD
-            for ( int r = 0; r < 3; r++ ) {
-                const char *row;
-                if ( keyboardNumbers ) {
-                    if ( r == 0 ) {
-                        row = "1234567890";
-                    }
-                    else if ( r == 1 ) {
-                        row = "!@#$%^&*(/";
-                    }
-                    else {
-                        row = ")-_+=.,?";
-                    }
-                }
-                else {
-                    if ( r == 0 ) {
-                        row = "qwertyuiop";
-                    }
-                    else if ( r == 1 ) {
-                        row = "asdfghjkl";
-                    }
-                    else {
-                        row = "zxcvbnm";
-                    }
-                }
-                int len = strlen( row );
-                for ( int i = 0; i < len; i++ ) {
-                    int btnX = i * 29 + 2;
-                    int btnY = 80 + r * 30;
-                    if ( x >= btnX && x <= btnX + 26 && y >= btnY && y <= btnY + 26 ) {
-                        char ch = row[ i ];
-                        if ( keyboardShift && !keyboardNumbers ) {
-                            ch = toupper( ch );
-                        }
-                        passwordBuffer += ch;
-                        updateKeyboardText();
-                        delay( UI_DEBOUNCE_MS );
-                        return;
-                    }
-                }
-            }
-            if ( x >= 2 && x <= 318 && y >= 170 && y <= 195 ) {
-                passwordBuffer += " ";
-                updateKeyboardText();
-                delay( UI_DEBOUNCE_MS );
-                return;
-            }
-            int bw = 64;
-            int by = 198;
-            int bh = 35;
-            if ( x >= 0 && x <= bw && y >= by && y <= by + bh ) {
-                keyboardShift = !keyboardShift;
-                drawKeyboardScreen();
-                delay( UI_DEBOUNCE_MS );
-                return;
-            }
-            if ( x >= bw && x <= 2 * bw && y >= by && y <= by + bh ) {
-                keyboardNumbers = !keyboardNumbers;
-                drawKeyboardScreen();
-                delay( UI_DEBOUNCE_MS );
-                return;
-            }
-            if ( x >= 2 * bw && x <= 3 * bw && y >= by && y <= by + bh ) {
-                if ( passwordBuffer.length() > 0 ) {
-                    passwordBuffer.remove( passwordBuffer.length() - 1 );
-                    updateKeyboardText();
-                    delay( UI_DEBOUNCE_MS );
+                if ( vlistCanScroll( 1 ) ) {
+                    vlistStep( 1 );
                 }
-                return;
-            }
-            // Back – return to WiFi list
-            if ( x >= 3 * bw && x <= 4 * bw && y >= by && y <= by + bh ) {
-                passwordBuffer = "";
-                currentState = WIFICONFIG;
-                drawInitialSetup();
-                delay( TOUCH_DEBOUNCE_MS );
-                return;
             }
-            // OK – confirm SSID, move to password entry
-            if ( x >= 4 * bw && x <= 5 * bw && y >= by && y <= by + bh ) {
-                selectedSSID = passwordBuffer;
+            // Check tap on "Other..." row — always pinned at row 5
+            else if ( y >= 45 + 5 * 30 && y <= 45 + 5 * 30 + 25 ) {
+                selectedSSID = "";
+                currentState = SSID_INPUT;
                 passwordBuffer = "";
                 keyboardNumbers = false;
                 keyboardShift = false;
-                currentState = KEYBOARD;
                 drawKeyboardScreen();
-                delay( TOUCH_DEBOUNCE_MS );
-                return;
+            }
+            else {
+                vlistTouch( x, y, type );
             }
             break;
         }
 
-        case KEYBOARD: {
-            for ( int r = 0; r < 3; r++ ) {
-                const char *row;
-                if ( keyboardNumbers ) {
-                    if ( r == 0 ) {
-                        row = "1234567890";
-                    }
-                    else if ( r == 1 ) {
-                        row = "!@#$%^&*(/";
-                    }
-                    else {
-                        row = ")-_+=.,?";
-                    }
-                }
-                else {
-                    if ( r == 0 ) {
-                        row = "qwertyuiop";
-                    }
-                    else if ( r == 1 ) {
-                        row = "asdfghjkl";
-                    }
-                    else {
-                        row = "zxcvbnm";
-                    }
-                }
-                int len = strlen( row );
-                for ( int i = 0; i < len; i++ ) {
-                    int btnX = i * 29 + 2;
-                    int btnY = 80 + r * 30;
-                    if ( x >= btnX && x <= btnX + 26 && y >= btnY && y <= btnY + 26 ) {
-                        char ch = row[ i ];
-                        if ( keyboardShift && !keyboardNumbers ) {
-                            ch = toupper( ch );
-                        }
-                        passwordBuffer += ch;
-                        updateKeyboardText();
-                        delay( UI_DEBOUNCE_MS );
-                        return;
-                    }
-                }
-            }
-            if ( x >= 2 && x <= 318 && y >= 170 && y <= 195 ) {
-                passwordBuffer += " ";
-                updateKeyboardText();
-                delay( UI_DEBOUNCE_MS );
-                return;
-            }
-            int bw = 64;
-            int by = 198;
-            int bh = 35;
-            if ( x >= 0 && x <= bw && y >= by && y <= by + bh ) {
-                keyboardShift = !keyboardShift;
-                drawKeyboardScreen();
-                delay( UI_DEBOUNCE_MS );
-                return;
-            }
-            if ( x >= bw && x <= 2 * bw && y >= by && y <= by + bh ) {
-                keyboardNumbers = !keyboardNumbers;
-                drawKeyboardScreen();
-                delay( UI_DEBOUNCE_MS );
-                return;
-            }
-            if ( x >= 2 * bw && x <= 3 * bw && y >= by && y <= by + bh ) {
-                if ( passwordBuffer.length() > 0 ) {
-                    passwordBuffer.remove( passwordBuffer.length() - 1 );
-                    updateKeyboardText();
-                    delay( UI_DEBOUNCE_MS );
-                }
-                return;
-            }
-            if ( x >= 3 * bw && x <= 4 * bw && y >= by && y <= by + bh ) {
-                passwordBuffer = "";
-                currentState = WIFICONFIG;
-                drawInitialSetup();
-                delay( TOUCH_DEBOUNCE_MS );
-                return;
+        case SSID_INPUT:
+            switch ( kbTouch( x, y, type ) ) {
+                // Back – return to WiFi list
+                case KB_LEFT:
+                    passwordBuffer = "";
+                    currentState = WIFICONFIG;
+                    drawInitialSetup();
+                    touchHoldOff( TOUCH_DEBOUNCE_MS );
+                    break;
+
+                // OK – confirm SSID, move to password entry
+                case KB_RIGHT:
+                    selectedSSID = passwordBuffer;
+                    passwordBuffer = "";
+                    keyboardNumbers = false;
+                    keyboardShift = false;
+                    currentState = KEYBOARD;
+                    drawKeyboardScreen();
+                    touchHoldOff( TOUCH_DEBOUNCE_MS );
+                    break;
+
+                default:
+                    break;
             }
-            if ( x >= 4 * bw && x <= 5 * bw && y >= by && y <= by + bh ) {
-                prefs.begin( "sys", false );
-                prefs.putString( "ssid", selectedSSID );
-                prefs.putString( "pass", obfuscatePassword( passwordBuffer ) );
-                prefs.end();
-                ssid = selectedSSID;
-                password = passwordBuffer;
-                showWifiConnectingScreen( ssid );
-                WiFi.mode( WIFI_STA );
-                WiFi.scanDelete();
-                WiFi.disconnect();
-                delay( 100 );
-                WiFi.begin( ssid.c_str(), password.c_str() );
-                unsigned long startWait = millis();
-                while ( WiFi.status() != WL_CONNECTED && millis() - startWait < WIFI_CONNECT_TIMEOUT ) {
-                    delay( 500 );
-                }
-                if ( WiFi.status() == WL_CONNECTED ) {
-                    showWifiResultScreen( true );
-                    if ( regionAutoMode ) {
-                        syncRegion();
-                    }
-                    currentState = CLOCK;
-                    lastSec = -1;
-                }
-                else {
-                    showWifiResultScreen( false );
+            break;
+
+        case KEYBOARD:
+            switch ( kbTouch( x, y, type ) ) {
+                case KB_LEFT:
+                    passwordBuffer = "";
                     currentState = WIFICONFIG;
                     drawInitialSetup();
+                    touchHoldOff( TOUCH_DEBOUNCE_MS );
+                    break;
+
+                case KB_RIGHT: {
+                    prefs.begin( "sys", false );
+                    prefs.putString( "ssid", selectedSSID );
+                    prefs.putString( "pass", obfuscatePassword( passwordBuffer ) );
+                    prefs.end();
+                    ssid = selectedSSID;
+                    password = passwordBuffer;
+                    showWifiConnectingScreen( ssid );
+                    WiFi.mode( WIFI_STA );
+                    WiFi.scanDelete();
+                    WiFi.disconnect();
+                    // The modal's job begins the association, waits for it and shows the result
+                    wifiBegun = false;
+                    startModal( MODAL_WIFI_CONNECT, WIFI_POLL_MS, nullptr );
+                    break;
                 }
-                delay( TOUCH_DEBOUNCE_MS );
-                return;
-            }
-            if ( x >= 250 && x <= 310 && y >= 140 && y <= 165 ) {
-                showPassword = !showPassword;
-                drawKeyboardScreen();
-                delay( UI_DEBOUNCE_MS );
-                return;
+
+                case KB_REVEAL:
+                    showPassword = !showPassword;
+                    kbSetMasked( !showPassword );
+                    break;
+
+                default:
+                    break;
             }
             break;
-        }
 
         case WEATHERCONFIG: {
             // ===== SLOUPEC 1: TEPLOTA =====
             // °C button: x=8 w=38 → x=8..46
             if ( x >= 8 && x <= 46 && y >= 80 && y <= 100 ) {
-                if ( weatherUnitF ) {
-                    weatherUnitF = false;
+                if ( appSet( app.units.tempF, false, APP_UNIT_TEMP ) ) {
                     prefs.begin( "sys", false );
-                    prefs.putBool( "weatherUnitF", weatherUnitF );
+                    prefs.putBool( "weatherUnitF", app.units.tempF );
                     prefs.end();
                     drawWeatherScreen();
-                    delay( TOUCH_DEBOUNCE_MS );
+                    touchHoldOff( TOUCH_DEBOUNCE_MS );
                 }
                 break;
             }
             // °F button: x=50 w=38 → x=50..88
             if ( x >= 50 && x <= 88 && y >= 80 && y <= 100 ) {
-                if ( !weatherUnitF ) {
-                    weatherUnitF = true;
+                if ( appSet( app.units.tempF, true, APP_UNIT_TEMP ) ) {
                     prefs.begin( "sys", false );
-                    prefs.putBool( "weatherUnitF", weatherUnitF );
+                    prefs.putBool( "weatherUnitF", app.units.tempF );
                     prefs.end();
                     drawWeatherScreen();
-                    delay( TOUCH_DEBOUNCE_MS );
+                    touchHoldOff( TOUCH_DEBOUNCE_MS );
                 }
                 break;
             }
@@ -542,25 +420,23 @@ void handleTouch( int x, int y ) {
             // ===== COLUMN 2: WIND =====
             // km/h button: x=115 w=38 → x=115..153
             if ( x >= 115 && x <= 153 && y >= 80 && y <= 100 ) {
-                if ( weatherUnitMph ) {
-                    weatherUnitMph = false;
+                if ( appSet( app.units.windMph, false, APP_UNIT_WIND ) ) {
                     prefs.begin( "sys", false );
-                    prefs.putBool( "weatherUnitMph", weatherUnitMph );
+                    prefs.putBool( "weatherUnitMph", app.units.windMph );
                     prefs.end();
                     drawWeatherScreen();
-                    delay( TOUCH_DEBOUNCE_MS );
+                    touchHoldOff( TOUCH_DEBOUNCE_MS );
                 }
                 break;
             }
             // mph button: x=157 w=38 → x=157..195
             if ( x >= 157 && x <= 195 && y >= 80 && y <= 100 ) {
-                if ( !weatherUnitMph ) {
-                    weatherUnitMph = true;
+                if ( appSet( app.units.windMph, true, APP_UNIT_WIND ) ) {
                     prefs.begin( "sys", false );
-                    prefs.putBool( "weatherUnitMph", weatherUnitMph );
+                    prefs.putBool( "weatherUnitMph", app.units.windMph );
                     prefs.end();
                     drawWeatherScreen();
-                    delay( TOUCH_DEBOUNCE_MS );
+                    touchHoldOff( TOUCH_DEBOUNCE_MS );
                 }
                 break;
             }
@@ -568,25 +444,23 @@ void handleTouch( int x, int y ) {
             // ===== SLOUPEC 3: TLAK =====
             // hPa button: x=222 w=38 → x=222..260
             if ( x >= 222 && x <= 260 && y >= 80 && y <= 100 ) {
-                if ( weatherUnitInHg ) {
-                    weatherUnitInHg = false;
+                if ( appSet( app.units.pressureInHg, false, APP_UNIT_PRESS ) ) {
                     prefs.begin( "sys", false );
-                    prefs.putBool( "weatherUnitInHg", weatherUnitInHg );
+                    prefs.putBool( "weatherUnitInHg", app.units.pressureInHg );
                     prefs.end();
                     drawWeatherScreen();
-                    delay( TOUCH_DEBOUNCE_MS );
+                    touchHoldOff( TOUCH_DEBOUNCE_MS );
                 }
                 break;
             }
             // inHg button: x=264 w=38 → x=264..302
             if ( x >= 264 && x <= 302 && y >= 80 && y <= 100 ) {
-                if ( !weatherUnitInHg ) {
-                    weatherUnitInHg = true;
+                if ( appSet( app.units.pressureInHg, true, APP_UNIT_PRESS ) ) {
                     prefs.begin( "sys", false );
-                    prefs.putBool( "weatherUnitInHg", weatherUnitInHg );
+                    prefs.putBool( "weatherUnitInHg", app.units.pressureInHg );
                     prefs.end();
                     drawWeatherScreen();
-                    delay( TOUCH_DEBOUNCE_MS );
+                    touchHoldOff( TOUCH_DEBOUNCE_MS );
                 }
                 break;
             }
@@ -598,7 +472,7 @@ void handleTouch( int x, int y ) {
                 coordEditingLon = false;
                 currentState = COORDSINPUT;
                 drawCoordInputScreen();
-                delay( TOUCH_DEBOUNCE_MS );
+                touchHoldOff( TOUCH_DEBOUNCE_MS );
                 break;
             }
 
@@ -631,7 +505,7 @@ void handleTouch( int x, int y ) {
                             coordLonBuffer += ch;
                         }
                         drawCoordInputScreen();
-                        delay( 100 );
+                        touchHoldOff( 100 );
                         return;
                     }
                 }
@@ -650,7 +524,7 @@ void handleTouch( int x, int y ) {
                     }
                 }
                 drawCoordInputScreen();
-                delay( 100 );
+                touchHoldOff( 100 );
                 return;
             }
 
@@ -658,7 +532,7 @@ void handleTouch( int x, int y ) {
             if ( x >= bw + 5 && x <= bw + 5 + bw - 5 && y >= by && y <= by + bh ) {
                 coordEditingLon = !coordEditingLon;
                 drawCoordInputScreen();
-                delay( UI_DEBOUNCE_MS );
+                touchHoldOff( UI_DEBOUNCE_MS );
                 return;
             }
 
@@ -680,7 +554,7 @@ void handleTouch( int x, int y ) {
                 }
                 currentState = WEATHERCONFIG;
                 drawWeatherScreen();
-                delay( TOUCH_DEBOUNCE_MS );
+                touchHoldOff( TOUCH_DEBOUNCE_MS );
                 return;
             }
 
@@ -688,7 +562,7 @@ void handleTouch( int x, int y ) {
             if ( x >= 3 * bw + 5 && x <= 3 * bw + 5 + bw - 5 && y >= by && y <= by + bh ) {
                 currentState = WEATHERCONFIG;
                 drawWeatherScreen();
-                delay( UI_DEBOUNCE_MS );
+                touchHoldOff( UI_DEBOUNCE_MS );
                 return;
             }
             break;
@@ -720,7 +594,7 @@ void handleTouch( int x, int y ) {
                 prefs.putString( "posixTZ", posixTZ );
                 prefs.end();
                 drawRegionalScreen();
-                delay( UI_DEBOUNCE_MS );
+                touchHoldOff( UI_DEBOUNCE_MS );
             }
             else if ( !regionAutoMode && x >= 155 && x <= 183 && y >= 172 && y <= 188 ) {
                 gmtOffset_sec -= 3600;
@@ -741,7 +615,7 @@ void handleTouch( int x, int y ) {
                 prefs.putString( "posixTZ", posixTZ );
                 prefs.end();
                 drawRegionalScreen();
-                delay( UI_DEBOUNCE_MS );
+                touchHoldOff( UI_DEBOUNCE_MS );
             }
             else if ( !regionAutoMode && x >= 195 && x <= 267 && y >= 172 && y <= 188 ) {
                 manualDstActive = !manualDstActive;
@@ -756,7 +630,7 @@ void handleTouch( int x, int y ) {
                 prefs.putString( "posixTZ", posixTZ );
                 prefs.end();
                 drawRegionalDstButton();
-                delay( UI_DEBOUNCE_MS );
+                touchHoldOff( UI_DEBOUNCE_MS );
             }
             else if ( x >= 40 && x <= 145 && y >= 205 && y <= 235 ) {
                 if ( regionAutoMode ) {
@@ -764,25 +638,14 @@ void handleTouch( int x, int y ) {
                     String syncErr = syncRegion();
                     if ( syncErr.isEmpty() ) {
                         drawSyncOverlay( "Sync complete!", false );
-                        delay( 1500 );
+                        startModal( MODAL_SPLASH, 1500, clearSyncOverlay );
                     }
                     else {
+                        // Waits for the OK tap (modalTouch)
                         drawSyncOverlay( syncErr, true );
-                        // Wait for OK tap
-                        while ( true ) {
-                            if ( ts.tirqTouched() && ts.touched() ) {
-                                TS_Point p = ts.getPoint();
-                                int tx = constrain( map( p.x, touchXMin, touchXMax, 0, 320 ), 0, 319 );
-                                int ty = constrain( map( p.y, touchYMin, touchYMax, 0, 240 ), 0, 239 );
-                                if ( tx >= 110 && tx <= 210 && ty >= 134 && ty <= 158 ) {
-                                    break;
-                                }
-                            }
-                            delay( 50 );
-                        }
-                        delay( UI_DEBOUNCE_MS );
+                        touchFlush();
+                        startModal( MODAL_SYNC_ERROR, UI_MODAL_TIMEOUT_MS, clearSyncOverlay );
                     }
-                    clearSyncOverlay();
                     // Stay on REGIONALCONFIG — user must explicitly navigate away
                 }
                 else {
@@ -800,17 +663,25 @@ void handleTouch( int x, int y ) {
         }
 
         case COUNTRYSELECT: {
-            if ( x >= 230 && x <= 320 && y >= 45 && y <= 95 ) {
-                if ( countryOffset > 0 ) {
-                    countryOffset--;
+            // A press in the list owns every event until release; a tap picks on release
+            if ( vlistPressed() ) {
+                int row = vlistTouch( x, y, type );
+                if ( row >= 0 ) {
+                    selectedCountry = String( countries[ row ].name );
+                    currentState = CITYSELECT;
+                    cityOffset = 0;
+                    drawCitySelection();
+                }
+            }
+            else if ( x >= 230 && x <= 320 && y >= 45 && y <= 95 ) {
+                if ( vlistCanScroll( -1 ) ) {
+                    vlistStep( -1 );
                 }
-                drawCountrySelection();
             }
             else if ( x >= 230 && x <= 320 && y >= 180 && y <= 230 ) {
-                if ( countryOffset + 5 < COUNTRIES_COUNT ) {
-                    countryOffset++;
+                if ( vlistCanScroll( 1 ) ) {
+                    vlistStep( 1 );
                 }
-                drawCountrySelection();
             }
             else if ( x >= 230 && x <= 320 && y >= 110 && y <= 160 ) {
                 currentState = REGIONALCONFIG;
@@ -824,36 +695,37 @@ void handleTouch( int x, int y ) {
                 drawCustomCountryInput();
             }
             else {
-                for ( int i = countryOffset; i < countryOffset + 5 && i < COUNTRIES_COUNT; i++ ) {
-                    int idx = i - countryOffset;
-                    int yPos = 70 + idx * 30;
-                    if ( y >= yPos && y <= yPos + 25 ) {
-                        selectedCountry = String( countries[ i ].name );
-                        currentState = CITYSELECT;
-                        cityOffset = 0;
-                        drawCitySelection();
-                        break;
-                    }
-                }
+                vlistTouch( x, y, type );
             }
             break;
         }
 
         case CITYSELECT: {
-            String cities[ 20 ];
-            int cityCount = 0;
-            getCountryCities( selectedCountry, cities, cityCount );
-            if ( x >= 230 && x <= 320 && y >= 45 && y <= 95 ) {
-                if ( cityOffset > 0 ) {
-                    cityOffset--;
+            if ( vlistPressed() ) {
+                const CountryEntry *country = findCountry( selectedCountry );
+                int                 row     = vlistTouch( x, y, type );
+                if ( country != nullptr && row >= 0 ) {
+                    selectedCity = country->cities[ row ].name;
+                    String tz;
+                    int go, doff;
+                    if ( getTimezoneForCity( selectedCountry, selectedCity, tz, go, doff ) ) {
+                        selectedTimezone = tz;
+                        gmtOffset_sec = go;
+                        daylightOffset_sec = doff;
+                        currentState = LOCATIONCONFIRM;
+                        drawLocationConfirm();
+                    }
+                }
+            }
+            else if ( x >= 230 && x <= 320 && y >= 45 && y <= 95 ) {
+                if ( vlistCanScroll( -1 ) ) {
+                    vlistStep( -1 );
                 }
-                drawCitySelection();
             }
             else if ( x >= 230 && x <= 320 && y >= 180 && y <= 230 ) {
-                if ( cityOffset + 5 < cityCount ) {
-                    cityOffset++;
+                if ( vlistCanScroll( 1 ) ) {
+                    vlistStep( 1 );
                 }
-                drawCitySelection();
             }
             else if ( x >= 230 && x <= 320 && y >= 110 && y <= 160 ) {
                 currentState = COUNTRYSELECT;
@@ -868,23 +740,7 @@ void handleTouch( int x, int y ) {
                 drawCustomCityInput();
             }
             else {
-                for ( int i = cityOffset; i < cityOffset + 5 && i < cityCount; i++ ) {
-                    int idx = i - cityOffset;
-                    int yPos = 70 + idx * 30;
-                    if ( y >= yPos && y <= yPos + 25 ) {
-                        selectedCity = cities[ i ];
-                        String tz;
-                        int go, doff;
-                        if ( getTimezoneForCity( selectedCountry, selectedCity, tz, go, doff ) ) {
-                            selectedTimezone = tz;
-                            gmtOffset_sec = go;
-                            daylightOffset_sec = doff;
-                            currentState = LOCATIONCONFIRM;
-                            drawLocationConfirm();
-                        }
-                        break;
-                    }
-                }
+                vlistTouch( x, y, type );
             }
             break;
         }
@@ -903,149 +759,57 @@ void handleTouch( int x, int y ) {
             break;
         }
 
-        case CUSTOMCITYINPUT: {
-            if ( x >= 180 && x <= 250 && y >= 198 && y <= 233 ) {
-                if ( customCityInput.length() > 0 ) {
-                    lookupCityGeonames( customCityInput, selectedCountry );
-                    currentState = CITYLOOKUPCONFIRM;
-                    drawCityLookupConfirm();
-                }
-                else {
-                    drawCustomCityInput();
-                }
-                return;
-            }
+        case CUSTOMCITYINPUT:
+            switch ( kbTouch( x, y, type ) ) {
+                // SRCH
+                case KB_LEFT:
+                    if ( customCityInput.length() > 0 ) {
+                        lookupCityGeonames( customCityInput, selectedCountry );
+                        currentState = CITYLOOKUPCONFIRM;
+                        drawCityLookupConfirm();
+                        touchHoldOff( TOUCH_DEBOUNCE_MS );
+                    }
+                    break;
 
-            // FIX: Selecting the correct character set by keyboardNumbers
-            const char *rows[ 3 ];
-            if ( keyboardNumbers ) {
-                rows[ 0 ] = "1234567890";
-                rows[ 1 ] = "!@#$%^&*(/";
-                rows[ 2 ] = ")-_+=.,?";
-            }
-            else {
-                rows[ 0 ] = "qwertyuiop";
-                rows[ 1 ] = "asdfghjkl";
-                rows[ 2 ] = "zxcvbnm";
-            }
+                // BACK
+                case KB_RIGHT:
+                    customCityInput = "";
+                    currentState = CITYSELECT;
+                    cityOffset = 0;
+                    drawCitySelection();
+                    touchHoldOff( TOUCH_DEBOUNCE_MS );
+                    break;
 
-            for ( int r = 0; r < 3; r++ ) {
-                for ( int i = 0; i < strlen( rows[ r ] ); i++ ) {
-                    if ( x >= i * 29 && x <= i * 29 + 29 && y >= 80 + r * 30 && y <= 80 + r * 30 + 30 ) {
-                        char ch = rows[ r ][ i ];
-                        if ( keyboardShift && !keyboardNumbers ) {
-                            ch = toupper( ch );
-                        }
-                        customCityInput += ch;
-                        keyboardShift = false;
-                        drawCustomCityInput();
-                        return;
-                    }
-                }
-            }
-            if ( x >= 0 && x <= 318 && y >= 170 && y <= 195 ) {
-                customCityInput += " ";
-                drawCustomCityInput();
-                return;
-            }
-            if ( x >= 250 && x <= 320 && y >= 198 && y <= 233 ) {
-                customCityInput = "";
-                currentState = CITYSELECT;
-                cityOffset = 0;
-                drawCitySelection();
-                return;
-            }
-            if ( x >= 120 && x <= 180 && y >= 198 && y <= 233 ) {
-                if ( customCityInput.length() > 0 ) {
-                    customCityInput.remove( customCityInput.length() - 1 );
-                    drawCustomCityInput();
-                }
-                return;
-            }
-            if ( x >= 60 && x <= 120 && y >= 198 && y <= 233 ) {
-                keyboardNumbers = !keyboardNumbers;
-                drawCustomCityInput();
-                return;
-            }
-            if ( x >= 0 && x <= 60 && y >= 198 && y <= 233 ) {
-                keyboardShift = !keyboardShift;
-                drawCustomCityInput();
-                return;
+                default:
+                    break;
             }
             break;
-        }
 
-        case CUSTOMCOUNTRYINPUT: {
-            if ( x >= 180 && x <= 250 && y >= 198 && y <= 233 ) {
-                if ( customCountryInput.length() > 0 ) {
-                    lookupCountryGeonames( customCountryInput );
-                    currentState = COUNTRYLOOKUPCONFIRM;
-                    drawCountryLookupConfirm();
-                }
-                else {
-                    drawCustomCountryInput();
-                }
-                return;
-            }
+        case CUSTOMCOUNTRYINPUT:
+            switch ( kbTouch( x, y, type ) ) {
+                // SRCH
+                case KB_LEFT:
+                    if ( customCountryInput.length() > 0 ) {
+                        lookupCountryGeonames( customCountryInput );
+                        currentState = COUNTRYLOOKUPCONFIRM;
+                        drawCountryLookupConfirm();
+                        touchHoldOff( TOUCH_DEBOUNCE_MS );
+                    }
+                    break;
 
-            // FIX: Select correct character set based on keyboardNumbers
-            const char *rows[ 3 ];
-            if ( keyboardNumbers ) {
-                rows[ 0 ] = "1234567890";
-                rows[ 1 ] = "!@#$%^&*(/";
-                rows[ 2 ] = ")-_+=.,?";
-            }
-            else {
-                rows[ 0 ] = "qwertyuiop";
-                rows[ 1 ] = "asdfghjkl";
-                rows[ 2 ] = "zxcvbnm";
-            }
+                // BACK
+                case KB_RIGHT:
+                    customCountryInput = "";
+                    currentState = COUNTRYSELECT;
+                    countryOffset = 0;
+                    drawCountrySelection();
+                    touchHoldOff( TOUCH_DEBOUNCE_MS );
+                    break;
 
-            for ( int r = 0; r < 3; r++ ) {
-                for ( int i = 0; i < strlen( rows[ r ] ); i++ ) {
-                    if ( x >= i * 29 && x <= i * 29 + 29 && y >= 80 + r * 30 && y <= 80 + r * 30 + 30 ) {
-                        char ch = rows[ r ][ i ];
-                        if ( keyboardShift && !keyboardNumbers ) {
-                            ch = toupper( ch );
-                        }
-                        customCountryInput += ch;
-                        keyboardShift = false;
-                        drawCustomCountryInput();
-                        return;
-                    }
-                }
-            }
-            if ( x >= 0 && x <= 318 && y >= 170 && y <= 195 ) {
-                customCountryInput += " ";
-                drawCustomCountryInput();
-                return;
-            }
-            if ( x >= 250 && x <= 320 && y >= 198 && y <= 233 ) {
-                customCountryInput = "";
-                currentState = COUNTRYSELECT;
-                countryOffset = 0;
-                drawCountrySelection();
-                return;
-            }
-            if ( x >= 120 && x <= 180 && y >= 198 && y <= 233 ) {
-                if ( customCountryInput.length() > 0 ) {
-                    customCountryInput.remove( customCountryInput.length() - 1 );
-                    drawCustomCountryInput();
-                }
-                return;
-            }
-            if ( x >= 60 && x <= 120 && y >= 198 && y <= 233 ) {
-                keyboardNumbers = !keyboardNumbers;
-                drawCustomCountryInput();
-                return;
-            }
-            if ( x >= 0 && x <= 60 && y >= 198 && y <= 233 ) {
-                keyboardShift = !keyboardShift;
-                drawCustomCountryInput();
-                return;
+                default:
+                    break;
             }
             break;
-        }
 
         case CITYLOOKUPCONFIRM: {
             if ( x >= 40 && x <= 145 && y >= 205 && y <= 235 ) {
@@ -1094,7 +858,7 @@ void handleTouch( int x, int y ) {
                 currentState = SETTINGS;
                 menuOffset = 0;
                 drawSettingsScreen();
-                delay( UI_DEBOUNCE_MS );
+                touchHoldOff( UI_DEBOUNCE_MS );
                 break;
             }
 
@@ -1114,7 +878,7 @@ void handleTouch( int x, int y ) {
                     prefs.end();
                     log_i( "[OTA] Install mode changed to: %s", i == 0 ? "Auto" : "By user" );
                     drawFirmwareScreen();
-                    delay( UI_DEBOUNCE_MS );
+                    touchHoldOff( UI_DEBOUNCE_MS );
                     break;
                 }
             }
@@ -1134,269 +898,50 @@ void handleTouch( int x, int y ) {
 
                     checkForUpdate();
 
-                    delay( 1000 );
-                    drawFirmwareScreen();
+                    // Leave the message up a moment before the refreshed screen replaces it
+                    startModal( MODAL_SPLASH, 1000, drawFirmwareScreen );
                 }
-                delay( UI_DEBOUNCE_MS );
+                touchHoldOff( UI_DEBOUNCE_MS );
                 break;
             }
             break;
         }
 
-        case GRAPHICSCONFIG: {
-            // ... (Theme code stays the same) ...
-            if ( x >= 20 && x <= 70 && y >= 65 && y <= 95 ) {
-                themeMode = THEME_DARK;
-                isWhiteTheme = false;
-                prefs.begin( "sys", false );
-                prefs.putInt( "themeMode", themeMode );
-                prefs.putBool( "theme", isWhiteTheme );
-                prefs.end();
-                tft.fillScreen( getBgColor() );
-                drawGraphicsScreen();
-                delay( TOUCH_DEBOUNCE_MS );
-                break;
-            }
-            if ( x >= 80 && x <= 130 && y >= 65 && y <= 95 ) {
-                themeMode = THEME_WHITE;
-                isWhiteTheme = true;
-                prefs.begin( "sys", false );
-                prefs.putInt( "themeMode", themeMode );
-                prefs.putBool( "theme", isWhiteTheme );
-                prefs.end();
-                tft.fillScreen( getBgColor() );
-                drawGraphicsScreen();
-                delay( TOUCH_DEBOUNCE_MS );
-                break;
-            }
-            if ( x >= 140 && x <= 190 && y >= 65 && y <= 95 ) {
-                themeMode = THEME_BLUE;
-                prefs.begin( "sys", false );
-                prefs.putInt( "themeMode", themeMode );
-                prefs.end();
-                fillGradientVertical( 0, 0, 320, 240, blueDark, blueLight );
-                drawGraphicsScreen();
-                delay( TOUCH_DEBOUNCE_MS );
-                break;
-            }
-            if ( x >= 200 && x <= 250 && y >= 65 && y <= 95 ) {
-                themeMode = THEME_YELLOW;
-                prefs.begin( "sys", false );
-                prefs.putInt( "themeMode", themeMode );
-                prefs.end();
-                fillGradientVertical( 0, 0, 320, 240, yellowDark, yellowLight );
-                drawGraphicsScreen();
-                delay( TOUCH_DEBOUNCE_MS );
-                break;
-            }
-
-            // === NEW INVERT BUTTON ===
-            if ( x >= 260 && x <= 310 && y >= 65 && y <= 95 ) {
-                log_d( "[INVERT] Toggle: %s -> %s", invertColors ? "TRUE" : "FALSE", !invertColors ? "TRUE" : "FALSE" );
-                invertColors = !invertColors;
-
-                bool prefOpened = prefs.begin( "sys", false );
-                if ( prefOpened ) {
-                    size_t written = prefs.putBool( "invertColors", invertColors );
-                    delay( 100 ); // Give extra time for the write to complete
-                    prefs.end();
-
-                    // VERIFY: Re-open and read back
-                    prefs.begin( "sys", true ); // read-only
-                    bool readBack = prefs.getBool( "invertColors", false );
-                    prefs.end();
-                    log_d( "[INVERT] Written: %u bytes, readback: %s, match: %d", ( unsigned )written, readBack ? "TRUE" : "FALSE", readBack == invertColors );
-                }
-
-                // ILI9341 (CYD1): invertColors directly controls inversion.
-                // invertColors=false → tft.invertDisplay(false) = normal display
-                // invertColors=true  → tft.invertDisplay(true)  = inverted display
-                tft.invertDisplay( invertColors );
-                log_d( "[INVERT] Display SW inverted: %s", invertColors ? "TRUE" : "FALSE" );
-
-                drawGraphicsScreen();
-                delay( TOUCH_DEBOUNCE_MS );
-                break;
-            }
-
-            // === NEW BRIGHTNESS CONTROL (COMPACT) ===
-            // Slider is now at x=10, width=130
-            if ( x >= 10 && x <= 140 && y >= 125 && y <= 137 ) {
-                int newBrightness = map( x - 10, 0, 130, 0, 255 );
-                brightness = constrain( newBrightness, BRIGHT_MIN, 255 );
-                // Cap autoDimLevel so it never exceeds the new normal brightness
-                int brightPct = brightness * 100 / 255;
-                if ( autoDimLevel > brightPct ) {
-                    autoDimLevel = brightPct;
-                    prefs.begin( "sys", false );
-                    prefs.putInt( "autoDimLevel", autoDimLevel );
-                    prefs.end();
-                    redrawAutoDimLevel();   // update the displayed value without a full redraw
-                }
-                // Throttle NVS writes to ≤1 per 500 ms — flash writes can stall the bus
-                static unsigned long lastNVSSaveBright = 0;
-                if ( millis() - lastNVSSaveBright > 500 ) {
-                    prefs.begin( "sys", false );
-                    prefs.putInt( "bright", brightness );
-                    prefs.end();
-                    lastNVSSaveBright = millis();
-                }
-                backlightSet( brightness );
-                redrawBrightnessSlider();   // partial repaint — no fillScreen flash
-                break;
-            }
-
-            // === NEW ANALOG / DIGITAL TOGGLE ===
-            // Oblast: x >= 200, y cca 115-143
-            if ( x >= 200 && x <= 310 && y >= 115 && y <= 145 ) {
-                isDigitalClock = !isDigitalClock;
-                prefs.begin( "sys", false );
-                prefs.putBool( "digiClock", isDigitalClock );
-                prefs.end();
-                redrawDigiAnaToggle();
-                delay( TOUCH_DEBOUNCE_MS );
-                break;
-            }
+        case GRAPHICSCONFIG:
+            uiTouch( x, y );
+            break;
+    }
+}
 
-            // === ROTATE 180° TOGGLE ===
-            // Matches draw region: rotX=200, rotY=148, rotW=110, rotH=22
-            if ( x >= 200 && x <= 310 && y >= 148 && y <= 170 ) {
-                displayFlipped = !displayFlipped;
-                prefs.begin( "sys", false );
-                prefs.putBool( "dispFlip", displayFlipped );
-                prefs.end();
-                // Load cal set for new orientation (defaults if never calibrated in that orientation)
-                prefs.begin( "sys", true );
-                if ( displayFlipped ) {
-                    touchXMin = prefs.getInt( "calXMinF", 3900 );
-                    touchXMax = prefs.getInt( "calXMaxF",  200 );
-                    touchYMin = prefs.getInt( "calYMinF", 3900 );
-                    touchYMax = prefs.getInt( "calYMaxF",  200 );
-                }
-                else {
-                    touchXMin = prefs.getInt( "calXMin",  200 );
-                    touchXMax = prefs.getInt( "calXMax", 3900 );
-                    touchYMin = prefs.getInt( "calYMin",  200 );
-                    touchYMax = prefs.getInt( "calYMax", 3900 );
-                }
-                prefs.end();
-                tft.setRotation( displayFlipped ? 3 : 1 );
-                tft.fillScreen( getBgColor() );
-                drawGraphicsScreen();
-                delay( TOUCH_DEBOUNCE_MS );
-                break;
-            }
+bool touchPagesBySwipe() {
+    return currentState == CLOCK || currentState == SETTINGS;
+}
 
-            // Back button
-            if ( x >= 252 && x <= 308 && y >= 182 && y <= 238 ) {
-                currentState = SETTINGS;
-                menuOffset = 0;
-                drawSettingsScreen();
-                delay( UI_DEBOUNCE_MS );
-                break;
-            }
+void handleLongPress( int x, int y ) {
+    // Long press on the digital clock cycles the digit transition; a tap there
+    // toggles 12/24h (handleTouch)
+    if ( modal == MODAL_NONE && currentState == CLOCK && isDigitalClock && x >= 160 && x <= 300 && y >= 20 && y <= 150 ) {
+        digitTransition = ( digitTransition + 1 ) % ( DIGIT_FX_FLIP + 1 );
+        prefs.begin( "sys", false );
+        prefs.putInt( "digitFx", digitTransition );
+        prefs.end();
+        touchHoldOff( TOUCH_DEBOUNCE_MS );
+        return;
+    }
+    handleTouch( x, y, TOUCH_MOVE );     // Anywhere else a long press is a tap
+}
 
-            // ... (Rest of AutoDim code stays the same) ...
-            if ( x >= 10 && x <= 38 && y >= 175 && y <= 191 ) {
-                // ... AutoDim ON code ...
-                autoDimEnabled = true;
-                prefs.begin( "sys", false );
-                prefs.putBool( "autoDimEnabled", autoDimEnabled );
-                prefs.end();
-                redrawAutoDimSection();
-                delay( UI_DEBOUNCE_MS );
-                break;
-            }
-            if ( x >= 10 && x <= 38 && y >= 195 && y <= 211 ) {
-                // ... AutoDim OFF code ...
-                autoDimEnabled = false;
-                prefs.begin( "sys", false );
-                prefs.putBool( "autoDimEnabled", autoDimEnabled );
-                prefs.end();
-                redrawAutoDimSection();
-                delay( UI_DEBOUNCE_MS );
-                break;
-            }
-            // ... (zbytek AutoDim logiky ponech beze změny) ...
-            // COPY THE ENTIRE AUTODIM BLOCK FROM THE ORIGINAL FILE IF UNCERTAIN.
-            // This just indicates that the rest of case GRAPHICSCONFIG is unchanged
-
-            // AUTODIM LOGIC CONTINUATION (for completeness in copy-paste block):
-            if ( autoDimEnabled ) {
-                int startX = 50;
-                int startY = 178;
-                int lineHeight = 16;
-                int startTimeX = startX + 50;
-                int startPlusX = startTimeX + 50;
-                int startMinusX = startPlusX + 26;
-                int btnW = 16;
-                if ( x >= startPlusX && x <= startPlusX + btnW && y >= startY - 6 && y <= startY + 6 ) {
-                    autoDimStart = ( autoDimStart + 1 ) % 24;
-                    prefs.begin( "sys", false );
-                    prefs.putInt( "autoDimStart", autoDimStart );
-                    prefs.end();
-                    redrawAutoDimStart();
-                    delay( UI_DEBOUNCE_MS );
-                    break;
-                }
-                if ( x >= startMinusX && x <= startMinusX + btnW && y >= startY - 6 && y <= startY + 6 ) {
-                    autoDimStart = ( autoDimStart - 1 + 24 ) % 24;
-                    prefs.begin( "sys", false );
-                    prefs.putInt( "autoDimStart", autoDimStart );
-                    prefs.end();
-                    redrawAutoDimStart();
-                    delay( UI_DEBOUNCE_MS );
-                    break;
-                }
-                int endY = startY + lineHeight;
-                int endPlusX = startTimeX + 50;
-                int endMinusX = endPlusX + 26;
-                if ( x >= endPlusX && x <= endPlusX + btnW && y >= endY - 6 && y <= endY + 6 ) {
-                    autoDimEnd = ( autoDimEnd + 1 ) % 24;
-                    prefs.begin( "sys", false );
-                    prefs.putInt( "autoDimEnd", autoDimEnd );
-                    prefs.end();
-                    redrawAutoDimEnd();
-                    delay( UI_DEBOUNCE_MS );
-                    break;
-                }
-                if ( x >= endMinusX && x <= endMinusX + btnW && y >= endY - 6 && y <= endY + 6 ) {
-                    autoDimEnd = ( autoDimEnd - 1 + 24 ) % 24;
-                    prefs.begin( "sys", false );
-                    prefs.putInt( "autoDimEnd", autoDimEnd );
-                    prefs.end();
-                    redrawAutoDimEnd();
-                    delay( UI_DEBOUNCE_MS );
-                    break;
-                }
-                int levelY = endY + lineHeight;
-                int levelPlusX = startTimeX + 50;
-                int levelMinusX = levelPlusX + 26;
-                if ( x >= levelPlusX && x <= levelPlusX + btnW && y >= levelY - 6 && y <= levelY + 6 ) {
-                    int brightPct = brightness * 100 / 255;
-                    // Snap up to next 5% grid point, then cap at normal brightness
-                    int next = ( ( autoDimLevel / 5 ) + 1 ) * 5;
-                    autoDimLevel = min( next, brightPct );
-                    prefs.begin( "sys", false );
-                    prefs.putInt( "autoDimLevel", autoDimLevel );
-                    prefs.end();
-                    redrawAutoDimLevel();
-                    delay( UI_DEBOUNCE_MS );
-                    break;
-                }
-                if ( x >= levelMinusX && x <= levelMinusX + btnW && y >= levelY - 6 && y <= levelY + 6 ) {
-                    // Snap down to previous 5% grid point (floor), minimum 0
-                    int prev = ( ( autoDimLevel - 1 ) / 5 ) * 5;
-                    autoDimLevel = max( prev, 0 );
-                    prefs.begin( "sys", false );
-                    prefs.putInt( "autoDimLevel", autoDimLevel );
-                    prefs.end();
-                    redrawAutoDimLevel();
-                    delay( UI_DEBOUNCE_MS );
-                    break;
-                }
-            }
-            break;
-        }
+void handleSwipe( SwipeDir dir ) {
+    if ( modal != MODAL_NONE ) {
+        return;
+    }
+    if ( currentState == CLOCK && dir == SWIPE_LEFT ) {
+        currentState = SETTINGS;
+        menuOffset   = 0;
+        drawSettingsScreen();
+    }
+    else if ( currentState == SETTINGS && dir == SWIPE_RIGHT ) {
+        currentState = CLOCK;
+        lastSec      = -1;      // Full clock repaint on the next loop
     }
 }
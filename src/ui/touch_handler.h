@@ -1,4 +1,20 @@
 #pragma once
+#include "gesture.h"
+
 // Phase 4: touch handler dispatch extracted from loop() in main.cpp
-// void handleTouch( int x, int y ) — called from loop() when ts.touched()
-void handleTouch( int x, int y );
+// void handleTouch( int x, int y, type ) — called from loop() for each touch press / hold (hal/touch.h).
+// type is TOUCH_DOWN for the start of a press and TOUCH_MOVE while it is held;
+// TOUCH_UP is passed only to end a press in a scrolling list (vlistPressed()).
+// On the screens that page by swipe it is the event that completed the tap.
+void handleTouch( int x, int y, TouchEventType type );
+
+// Screens where a press acts on release (tap / long press) so that a
+// horizontal swipe can page between them: the clock and settings
+bool touchPagesBySwipe();
+
+// Long press on those screens: cycles the digit transition on the digital
+// clock, otherwise the same as a tap
+void handleLongPress( int x, int y );
+
+// Swipe left on the clock opens settings; swipe right on settings goes back
+void handleSwipe( SwipeDir dir );
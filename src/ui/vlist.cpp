@@ -0,0 +1,250 @@
+#include "vlist.h"
+#include "dma_push.h"
+#include "gesture.h"
+#include "gfx_stats.h"
+#include "theme.h"
+
+#include <TFT_eSPI.h>
+
+#include "../data/app_state.h"
+#include "../hal/touch.h"
+#include "../util/constants.h"
+#include "../util/scheduler.h"
+
+// ---------------------------------------------------------------------------
+// Externs – defined in main.cpp
+// ---------------------------------------------------------------------------
+extern DisplayTFT  tft;
+extern ScreenState currentState;
+
+// ---------------------------------------------------------------------------
+
+static DisplaySprite rowSprite( &tft );     // 4 bpp, ROW_* palette
+
+enum RowColor : uint8_t {
+    ROW_BG,
+    ROW_TEXT,
+    ROW_RULE,
+    ROW_COLORS
+};
+
+static int           listX, listY, listW, listH;
+static int           rowH     = 30;
+static int           rowCount = 0;
+static int           rowChars = 20;
+static int           scrollY  = 0;      // Viewport top, in px from the top of row 0
+static VListItemFn   itemFn   = nullptr;
+static VListSettleFn settleFn = nullptr;
+static ScreenState   listScreen;            // Screen the list belongs to
+
+// Press in progress (vlistTouch): the finger's tracker and where it started
+static GestureTracker tracker;
+static bool           pressed     = false;
+static int            pressY      = 0;
+static int            startScroll = 0;
+
+// Scroll animation, one frame per scrollJob run: a step or fling, then the
+// snap to a whole row, then settleFn
+static void     scrollTick();
+static SchedJob scrollJob   = { "vlist-scroll", scrollTick };
+static int      animStart   = 0;
+static int      animTarget  = 0;
+static int      animFrames  = 0;
+static int      animFrame   = 0;
+static bool     animEaseOut = false;
+static bool     animSnap    = false;    // This phase is the snap; settleFn follows it
+
+static int maxScroll() {
+    return max( 0, rowCount * rowH - listH );
+}
+
+// Caption at the legacy list position (x + 5, text centre 9 px below the row
+// top, separator 20 px under the text); long captions end in "..."
+static void renderRow( int index ) {
+    rowSprite.fillSprite( ROW_BG );
+    if ( index < 0 || index >= rowCount ) {
+        return;
+    }
+    char        text[ 48 ];
+    const char *caption = itemFn( index );
+    int         len     = strlen( caption );
+    int         keep    = min( len, ( int )sizeof( text ) - 4 );
+    if ( len > rowChars ) {
+        keep = min( keep, rowChars - 3 );
+    }
+    memcpy( text, caption, keep );
+    strcpy( text + keep, keep < len ? "..." : "" );
+
+    rowSprite.setTextDatum( ML_DATUM );
+    rowSprite.setTextColor( ROW_TEXT );
+    rowSprite.drawString( text, 5, 9, 2 );
+    rowSprite.drawFastHLine( 0, rowH - 1, listW, ROW_RULE );
+}
+
+void vlistBegin( int x, int y, int w, int h, int rowHeight, int count, int maxChars,
+                 VListItemFn item, VListSettleFn onSettle, int firstRow ) {
+    listX    = x;
+    listY    = y;
+    listW    = w;
+    listH    = h;
+    rowH     = rowHeight;
+    rowCount = count;
+    rowChars = maxChars;
+    itemFn   = item;
+    settleFn = onSettle;
+    scrollY  = constrain( firstRow * rowH, 0, maxScroll() );
+
+    listScreen = currentState;
+    pressed    = false;
+    schedCancel( scrollJob );
+
+    if ( rowSprite.created() && ( rowSprite.width() != w || rowSprite.height() != rowHeight ) ) {
+        rowSprite.deleteSprite();
+    }
+    if ( !rowSprite.created() ) {
+        rowSprite.setColorDepth( 4 );
+        if ( rowSprite.createSprite( w, rowHeight ) == nullptr ) {
+            log_e( "[VLIST] Row sprite allocation failed (%d x %d)", w, rowHeight );
+        }
+    }
+}
+
+void vlistEnd() {
+    pressed = false;
+    schedCancel( scrollJob );
+    rowSprite.deleteSprite();
+}
+
+void vlistDraw() {
+    GFX_SCOPE( "vlistDraw" );
+    if ( !rowSprite.created() ) {
+        return;
+    }
+    const uint16_t palette[ ROW_COLORS ] = { getBgColor(), getTextColor(), TFT_DARKGREY };
+    rowSprite.createPalette( palette, ROW_COLORS );
+
+    // Rows pushed top to bottom; the first and last are clipped to the viewport
+    int row = scrollY / rowH;
+    int top = listY - scrollY % rowH;
+    while ( top < listY + listH ) {
+        int clipTop = max( 0, listY - top );
+        int clipBot = min( rowH, listY + listH - top );
+        renderRow( row );
+        dmaPushSprite( rowSprite, 0, clipTop, listW, clipBot - clipTop, listX, top + clipTop );
+        row++;
+        top += rowH;
+    }
+    dmaSync();
+}
+
+static void animate( int target, int frames, bool easeOut, bool snap ) {
+    animStart   = scrollY;
+    animTarget  = constrain( target, 0, maxScroll() );
+    animFrames  = frames;
+    animFrame   = 0;
+    animEaseOut = easeOut;
+    animSnap    = snap;
+    schedEvery( scrollJob, VLIST_FRAME_MS, 0 );
+}
+
+// Linear steps, or decelerating ones (ease-out) for a fling; settles after
+static void scrollTo( int target, int frames, bool easeOut = false ) {
+    animate( target, frames, easeOut, false );
+}
+
+static void settle() {
+    // Snap to a whole row so arrow steps and offsets stay row-aligned
+    animate( ( scrollY + rowH / 2 ) / rowH * rowH, VLIST_STEP_FRAMES / 2, false, true );
+}
+
+static void scrollTick() {
+    if ( currentState != listScreen ) {
+        schedCancel( scrollJob );   // The screen changed under the animation
+        return;
+    }
+    while ( animFrame >= animFrames || animStart == animTarget ) {
+        scrollY = animTarget;
+        if ( animSnap ) {
+            schedCancel( scrollJob );
+            if ( settleFn ) {
+                settleFn();
+            }
+            return;
+        }
+        settle();
+    }
+    animFrame++;
+    int left = animFrames - animFrame;
+    scrollY  = animEaseOut ? animStart + ( animTarget - animStart ) * ( animFrames * animFrames - left * left ) / ( animFrames * animFrames )
+                           : animStart + ( animTarget - animStart ) * animFrame / animFrames;
+    vlistDraw();
+}
+
+void vlistStep( int rows ) {
+    // Steps taken during an animation add up from where it is heading
+    int from = schedArmed( scrollJob ) ? animTarget : scrollY;
+    scrollTo( from + rows * rowH, VLIST_STEP_FRAMES );
+}
+
+int vlistFirstRow() {
+    return scrollY / rowH;
+}
+
+bool vlistCanScroll( int dir ) {
+    int at = schedArmed( scrollJob ) ? animTarget : scrollY;
+    return dir < 0 ? at > 0 : at < maxScroll();
+}
+
+bool vlistPressed() {
+    return pressed && currentState == listScreen;
+}
+
+int vlistTouch( int x, int y, TouchEventType type ) {
+    TouchEvent ev = { type, ( int16_t )x, ( int16_t )y, 0, 0, 0, ( uint32_t )micros() };
+    Gesture    gesture;
+    if ( type == TOUCH_DOWN ) {
+        pressed = false;    // A new press, should the last one's release have been lost
+    }
+    if ( !vlistPressed() ) {
+        if ( type != TOUCH_DOWN || x < listX || x >= listX + listW || y < listY || y >= listY + listH ) {
+            return -1;
+        }
+        // A press stops a scroll in progress where it is; the release settles it
+        schedCancel( scrollJob );
+        gestureReset( tracker );
+        gestureFeed( tracker, ev, gesture );
+        pressed     = true;
+        pressY      = y;
+        startScroll = scrollY;
+        return -1;
+    }
+
+    // The drag follows the finger; a swipe coasts on at its release speed
+    bool recognised = gestureFeed( tracker, ev, gesture );
+    if ( type != TOUCH_UP ) {
+        if ( tracker.dragging ) {
+            int target = constrain( startScroll - ( tracker.y - pressY ), 0, maxScroll() );
+            if ( target != scrollY ) {
+                scrollY = target;
+                vlistDraw();
+            }
+        }
+        return -1;
+    }
+    pressed = false;
+    if ( tracker.dragging ) {
+        bool swiped = recognised && gesture.type == GESTURE_SWIPE && ( gesture.dir == SWIPE_UP || gesture.dir == SWIPE_DOWN );
+        if ( swiped ) {
+            scrollTo( scrollY - gesture.vy * VLIST_FLING_MS / 1000, VLIST_FLING_FRAMES, true );
+        }
+        else {
+            settle();
+        }
+        return -1;
+    }
+    if ( scrollY % rowH != 0 ) {
+        settle();   // The press stopped a scroll between rows
+    }
+    int row = ( pressY - listY + scrollY ) / rowH;
+    return row < rowCount ? row : -1;
+}
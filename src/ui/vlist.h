@@ -0,0 +1,44 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "../hal/touch.h"
+
+// ---------------------------------------------------------------------------
+// Virtualised scrolling list for the country, city and WiFi screens
+//
+// The list never materialises its items: the item callback is asked only for
+// rows that intersect the viewport, each row is rendered into one row-high
+// strip sprite and pushed through dma_push. The viewport scrolls by pixels,
+// so arrow steps animate and a finger drag moves the rows with it.
+//
+// The ILI9341 vertical-scroll registers move the panel's native 320 px axis,
+// which is horizontal in this landscape build, so scrolling is done here in
+// software. Only one list exists at a time (the one on screen). Its row
+// sprite is 4 bpp (background, text, separator) and is expanded on the push.
+//
+// Nothing here waits: a drag advances with each touch event it is handed, and
+// arrow steps, flings and the snap to a whole row run one frame per
+// VLIST_FRAME_MS from a scheduler job (util/scheduler.h), which stops by
+// itself once the screen the list was begun on is gone.
+// ---------------------------------------------------------------------------
+
+typedef const char *( *VListItemFn )( int index );  // Row caption; only called for visible rows
+typedef void ( *VListSettleFn )();                  // Scroll came to rest (arrows, offsets)
+
+// Replaces the current list. firstRow is the row shown at the top.
+void vlistBegin( int x, int y, int w, int h, int rowHeight, int count, int maxChars,
+                 VListItemFn item, VListSettleFn onSettle, int firstRow );
+
+void vlistEnd();                    // Frees the row sprite; the next vlistBegin() recreates it
+void vlistDraw();                   // Paint the viewport at the current offset
+void vlistStep( int rows );         // Animated scroll by whole rows (arrow buttons); returns at once
+int  vlistFirstRow();               // Top row once the scroll has settled
+bool vlistCanScroll( int dir );     // -1 = up, 1 = down; counts a step still animating
+
+// Feeds one touch event. A TOUCH_DOWN inside the viewport starts a press, and
+// from then on every event up to the TOUCH_UP belongs to the list (see
+// vlistPressed()): moves drag the rows, and the release returns the row index
+// if the press was a tap, or flings / settles a drag. Returns -1 otherwise.
+int  vlistTouch( int x, int y, TouchEventType type );
+bool vlistPressed();                // A press in the list awaits its TOUCH_UP
@@ -0,0 +1,430 @@
+#include "widgets.h"
+#include "gfx_stats.h"
+#include "theme.h"
+
+#include <TFT_eSPI.h>
+
+#include "../hal/touch.h"
+#include "../util/constants.h"
+
+// ---------------------------------------------------------------------------
+// Externs – defined in main.cpp
+// ---------------------------------------------------------------------------
+extern DisplayTFT  tft;
+extern ScreenState currentState;
+
+// ---------------------------------------------------------------------------
+
+static constexpr int GRID_DIM = ( 320 + UI_GRID_CELL - 1 ) / UI_GRID_CELL;  // Covers either orientation
+
+static UiWidget    widgets[ UI_MAX_WIDGETS ];
+static int         widgetCount = 0;
+static ScreenState owner       = CLOCK;
+static uint32_t    screenGen   = 0;         // Bumped by uiBeginScreen — detects a rebuild inside a handler
+static uint64_t    grid[ GRID_DIM ][ GRID_DIM ];
+static bool        gridStale   = true;
+
+static const char *const KIND_NAMES[] = { "panel", "label", "button", "toggle", "slider", "list" };
+
+static uint16_t resolveColor( uint16_t c ) {
+    return c == UI_THEME_TEXT ? getTextColor() : c;
+}
+
+static bool isInteractive( const UiWidget &w ) {
+    return w.kind != UI_PANEL && w.kind != UI_LABEL && w.onEvent != nullptr;
+}
+
+// Visible only when the widget and every enclosing panel are
+static bool isShown( int id ) {
+    while ( id >= 0 ) {
+        if ( !widgets[ id ].visible ) {
+            return false;
+        }
+        id = widgets[ id ].parent;
+    }
+    return true;
+}
+
+static bool contains( const Rect &r, int x, int y ) {
+    // Inclusive right / bottom edge, as the hand-written touch checks were
+    return x >= r.x && x <= r.x + r.w && y >= r.y && y <= r.y + r.h;
+}
+
+static int addWidget( UiKind kind, int x, int y, int w, int h, int parent ) {
+    if ( widgetCount >= UI_MAX_WIDGETS ) {
+        log_e( "[UI] Widget table full, cannot add a %s", KIND_NAMES[ kind ] );
+        return -1;
+    }
+    UiWidget &wd = widgets[ widgetCount ];
+    wd           = UiWidget();
+    wd.kind      = kind;
+    wd.parent    = ( int8_t )parent;
+    wd.visible   = true;
+    wd.bounds    = { ( int16_t )x, ( int16_t )y, ( int16_t )w, ( int16_t )h };
+    wd.font      = 2;
+    wd.datum     = MC_DATUM;
+    wd.color     = UI_THEME_TEXT;
+    wd.fillColor = UI_THEME_TEXT;
+    wd.textColor = UI_THEME_TEXT;
+    gridStale    = true;
+    return widgetCount++;
+}
+
+// ---------------------------------------------------------------------------
+// Default renderers
+// ---------------------------------------------------------------------------
+
+static void drawLabel( const UiWidget &w ) {
+    // Anchor follows the datum: column = datum % 3 (L/C/R), row = datum / 3 (T/M/B)
+    int ax = w.bounds.x + ( w.datum % 3 ) * w.bounds.w / 2;
+    int ay = w.bounds.y + ( w.datum / 3 ) * w.bounds.h / 2;
+    tft.setTextDatum( w.datum );
+    tft.setTextColor( resolveColor( w.textColor ) );
+    tft.drawString( w.text, ax, ay, w.font );
+}
+
+static void drawButton( const UiWidget &w ) {
+    const Rect &b = w.bounds;
+    if ( w.fillColor != UI_THEME_TEXT ) {
+        tft.fillRoundRect( b.x, b.y, b.w, b.h, 4, w.fillColor );
+    }
+    tft.drawRoundRect( b.x, b.y, b.w, b.h, 4, resolveColor( w.color ) );
+    tft.setTextDatum( MC_DATUM );
+    tft.setTextColor( resolveColor( w.textColor ) );
+    tft.drawString( w.text, b.x + b.w / 2, b.y + b.h / 2, w.font );
+}
+
+// Segmented switch: the active half is filled with the accent colour
+static void drawToggle( const UiWidget &w ) {
+    const Rect &b   = w.bounds;
+    uint16_t    txt = getTextColor();
+    tft.drawRect( b.x, b.y, b.w, b.h, txt );
+    int fx = w.value ? b.x + b.w / 2 : b.x + 2;
+    tft.fillRect( fx, b.y + 2, b.w / 2 - 2, b.h - 4, resolveColor( w.color ) );
+    tft.setTextDatum( MC_DATUM );
+    tft.setTextColor( w.value ? txt : TFT_WHITE );
+    tft.drawString( w.text, b.x + b.w / 4, b.y + b.h / 2, w.font );
+    tft.setTextColor( w.value ? TFT_WHITE : txt );
+    tft.drawString( w.altText, b.x + 3 * b.w / 4, b.y + b.h / 2, w.font );
+}
+
+static void drawSlider( const UiWidget &w ) {
+    const Rect &b    = w.bounds;
+    int         fill = map( w.value, w.minValue, w.maxValue, 0, b.w - 2 );
+    tft.drawRect( b.x, b.y, b.w, b.h, getTextColor() );
+    tft.fillRect( b.x + 1, b.y + 1, fill, b.h - 2, resolveColor( w.color ) );
+}
+
+// Rows with a double rounded border, as the settings menus have always used
+static void drawList( const UiWidget &w ) {
+    int      x  = w.bounds.x + 1;
+    int      rw = w.bounds.w - 2;
+    uint16_t bg = getBgColor();
+    tft.setTextDatum( MC_DATUM );
+    tft.setTextColor( resolveColor( w.textColor ) );
+    for ( int r = 0; r < w.rows && w.value + r < w.itemCount; r++ ) {
+        int      item = w.value + r;
+        int      y    = w.bounds.y + 1 + r * w.rowPitch;
+        uint16_t c    = w.itemColors != nullptr ? w.itemColors[ item ] : resolveColor( w.color );
+        tft.drawRoundRect( x, y, rw, w.rowHeight, 6, c );
+        tft.drawRoundRect( x - 1, y - 1, rw + 2, w.rowHeight + 2, 6, c );
+        tft.fillRoundRect( x + 1, y + 1, rw - 2, w.rowHeight - 2, 5, bg );
+        tft.drawString( w.items[ item ], x + rw / 2, y + w.rowHeight / 2, w.font );
+    }
+}
+
+static void drawWidget( const UiWidget &w ) {
+    if ( w.draw != nullptr ) {
+        w.draw( w );
+        return;
+    }
+    switch ( w.kind ) {
+        case UI_LABEL:
+            drawLabel( w );
+            break;
+        case UI_BUTTON:
+            drawButton( w );
+            break;
+        case UI_TOGGLE:
+            drawToggle( w );
+            break;
+        case UI_SLIDER:
+            drawSlider( w );
+            break;
+        case UI_LIST:
+            drawList( w );
+            break;
+        default:
+            break;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Building
+// ---------------------------------------------------------------------------
+
+void uiBeginScreen( ScreenState state ) {
+    widgetCount = 0;
+    owner       = state;
+    gridStale   = true;
+    screenGen++;
+}
+
+int uiAddPanel( int x, int y, int w, int h, int parent ) {
+    return addWidget( UI_PANEL, x, y, w, h, parent );
+}
+
+int uiAddLabel( int x, int y, int w, int h, const char *text, uint8_t font, uint8_t datum, int parent ) {
+    int id = addWidget( UI_LABEL, x, y, w, h, parent );
+    if ( id >= 0 ) {
+        widgets[ id ].font  = font;
+        widgets[ id ].datum = datum;
+        widgets[ id ].text  = text;       // Static text is referenced; uiSetText() copies
+    }
+    return id;
+}
+
+int uiAddButton( int x, int y, int w, int h, const char *text, uint16_t color, UiEventFn onTap, int parent ) {
+    int id = addWidget( UI_BUTTON, x, y, w, h, parent );
+    if ( id >= 0 ) {
+        widgets[ id ].text       = text;
+        widgets[ id ].color      = color;
+        widgets[ id ].textColor  = color;
+        widgets[ id ].onEvent    = onTap;
+        widgets[ id ].debounceMs = UI_DEBOUNCE_MS;
+    }
+    return id;
+}
+
+int uiAddToggle( int x, int y, int w, int h, const char *left, const char *right, bool state, UiEventFn onChange ) {
+    int id = addWidget( UI_TOGGLE, x, y, w, h, -1 );
+    if ( id >= 0 ) {
+        widgets[ id ].text       = left;
+        widgets[ id ].altText    = right;
+        widgets[ id ].value      = state ? 1 : 0;
+        widgets[ id ].color      = TFT_GREEN;
+        widgets[ id ].onEvent    = onChange;
+        widgets[ id ].debounceMs = TOUCH_DEBOUNCE_MS;
+    }
+    return id;
+}
+
+int uiAddSlider( int x, int y, int w, int h, int minValue, int maxValue, int value, UiEventFn onChange ) {
+    int id = addWidget( UI_SLIDER, x, y, w, h, -1 );
+    if ( id >= 0 ) {
+        widgets[ id ].minValue = minValue;
+        widgets[ id ].maxValue = maxValue;
+        widgets[ id ].value    = value;
+        widgets[ id ].color    = TFT_SKYBLUE;
+        widgets[ id ].onEvent  = onChange;     // No debounce — dragging repeats
+    }
+    return id;
+}
+
+int uiAddList( int x, int y, int w, const char *const *items, int count, int rows, int rowHeight, int rowPitch, UiEventFn onSelect ) {
+    // Bounds include the outer border ring drawn one pixel outside each row
+    int id = addWidget( UI_LIST, x - 1, y - 1, w + 2, ( rows - 1 ) * rowPitch + rowHeight + 2, -1 );
+    if ( id >= 0 ) {
+        UiWidget &wd  = widgets[ id ];
+        wd.items      = items;
+        wd.itemCount  = count;
+        wd.rows       = rows;
+        wd.rowHeight  = rowHeight;
+        wd.rowPitch   = rowPitch;
+        wd.onEvent    = onSelect;
+        wd.debounceMs = UI_DEBOUNCE_MS;
+    }
+    return id;
+}
+
+UiWidget &uiGet( int id ) {
+    return widgets[ id ];
+}
+
+// ---------------------------------------------------------------------------
+// Updating
+// ---------------------------------------------------------------------------
+
+void uiInvalidate( int id ) {
+    if ( id >= 0 && id < widgetCount ) {
+        widgets[ id ].dirty = true;
+    }
+}
+
+void uiSetValue( int id, int value ) {
+    if ( id < 0 || id >= widgetCount || widgets[ id ].value == value ) {
+        return;
+    }
+    widgets[ id ].value = value;
+    widgets[ id ].dirty = true;
+}
+
+void uiSetText( int id, const char *text ) {
+    if ( id < 0 || id >= widgetCount ) {
+        return;
+    }
+    UiWidget &w = widgets[ id ];
+    if ( w.text == w.buf && strcmp( w.buf, text ) == 0 ) {
+        return;
+    }
+    strncpy( w.buf, text, UI_TEXT_MAX - 1 );
+    w.buf[ UI_TEXT_MAX - 1 ] = '\0';
+    w.text                   = w.buf;
+    w.dirty                  = true;
+}
+
+void uiSetVisible( int id, bool visible ) {
+    if ( id < 0 || id >= widgetCount || widgets[ id ].visible == visible ) {
+        return;
+    }
+    widgets[ id ].visible = visible;
+    widgets[ id ].dirty   = true;     // Hiding must erase the area as well
+    gridStale             = true;
+}
+
+// ---------------------------------------------------------------------------
+// Drawing
+// ---------------------------------------------------------------------------
+
+void uiDrawAll() {
+    GFX_SCOPE( "ui-draw-all" );
+    tft.fillScreen( getBgColor() );
+    for ( int i = 0; i < widgetCount; i++ ) {
+        widgets[ i ].dirty = false;
+        if ( isShown( i ) ) {
+            drawWidget( widgets[ i ] );
+        }
+    }
+}
+
+// Erases each dirty widget's bounds and repaints every shown widget that
+// overlaps them, clipped to the bounds. Returns the pixels erased.
+static uint32_t flushDirty( int &redrawn ) {
+    uint32_t px = 0;
+    redrawn     = 0;
+    if ( currentState != owner ) {
+        return 0;       // A handler has left for a screen the tree does not own
+    }
+    uint16_t bg = getBgColor();
+    for ( int d = 0; d < widgetCount; d++ ) {
+        if ( !widgets[ d ].dirty ) {
+            continue;
+        }
+        widgets[ d ].dirty = false;
+        const Rect &r      = widgets[ d ].bounds;
+
+        tft.setViewport( r.x, r.y, r.w, r.h, false );
+        tft.fillRect( r.x, r.y, r.w, r.h, bg );
+        for ( int i = 0; i < widgetCount; i++ ) {
+            if ( widgets[ i ].kind != UI_PANEL && rectsIntersect( widgets[ i ].bounds, r ) && isShown( i ) ) {
+                drawWidget( widgets[ i ] );
+                redrawn++;
+            }
+        }
+        tft.resetViewport();
+        px += ( uint32_t )r.w * r.h;
+    }
+    return px;
+}
+
+void uiFlush() {
+    GFX_SCOPE( "ui-flush" );
+    int redrawn;
+    flushDirty( redrawn );
+}
+
+// ---------------------------------------------------------------------------
+// Hit testing — each bucket holds a bit per interactive widget overlapping it
+// ---------------------------------------------------------------------------
+
+static void buildGrid() {
+    memset( grid, 0, sizeof( grid ) );
+    for ( int i = 0; i < widgetCount; i++ ) {
+        if ( !isInteractive( widgets[ i ] ) || !isShown( i ) ) {
+            continue;
+        }
+        const Rect &b  = widgets[ i ].bounds;
+        int         c0 = constrain( b.x / UI_GRID_CELL, 0, GRID_DIM - 1 );
+        int         c1 = constrain( ( b.x + b.w ) / UI_GRID_CELL, 0, GRID_DIM - 1 );
+        int         r0 = constrain( b.y / UI_GRID_CELL, 0, GRID_DIM - 1 );
+        int         r1 = constrain( ( b.y + b.h ) / UI_GRID_CELL, 0, GRID_DIM - 1 );
+        for ( int r = r0; r <= r1; r++ ) {
+            for ( int c = c0; c <= c1; c++ ) {
+                grid[ r ][ c ] |= 1ULL << i;
+            }
+        }
+    }
+    gridStale = false;
+}
+
+int uiHitTest( int x, int y ) {
+    if ( x < 0 || y < 0 || x >= GRID_DIM * UI_GRID_CELL || y >= GRID_DIM * UI_GRID_CELL ) {
+        return -1;
+    }
+    if ( gridStale ) {
+        buildGrid();
+    }
+    uint64_t bits = grid[ y / UI_GRID_CELL ][ x / UI_GRID_CELL ];
+    while ( bits ) {
+        int id = 63 - __builtin_clzll( bits );     // Later widgets paint on top
+        if ( contains( widgets[ id ].bounds, x, y ) ) {
+            return id;
+        }
+        bits &= ~( 1ULL << id );
+    }
+    return -1;
+}
+
+// Value carried by a tap: new toggle state, slider position or list item;
+// -1 when the tap falls between list rows
+static int tapValue( const UiWidget &w, int x, int y ) {
+    switch ( w.kind ) {
+        case UI_TOGGLE:
+            return w.value ? 0 : 1;
+        case UI_SLIDER:
+            return constrain( ( int )map( x - w.bounds.x, 0, w.bounds.w, w.minValue, w.maxValue ), w.minValue, w.maxValue );
+        case UI_LIST: {
+            int dy  = y - ( w.bounds.y + 1 );
+            int row = dy / w.rowPitch;
+            if ( dy < 0 || row >= w.rows || dy - row * w.rowPitch > w.rowHeight || w.value + row >= w.itemCount ) {
+                return -1;
+            }
+            return w.value + row;
+        }
+        default:
+            return 0;
+    }
+}
+
+bool uiTouch( int x, int y ) {
+    [[maybe_unused]] uint32_t t0 = micros();   // Log only
+    int      id = uiHitTest( x, y );
+    if ( id < 0 ) {
+        return false;
+    }
+
+    UiWidget &w     = widgets[ id ];
+    int       value = tapValue( w, x, y );
+    if ( value < 0 ) {
+        return false;
+    }
+    if ( w.kind == UI_TOGGLE || w.kind == UI_SLIDER ) {
+        uiSetValue( id, value );
+    }
+
+    [[maybe_unused]] UiKind kind = w.kind;     // Log only; onEvent may rebuild w
+    uint16_t debounce = w.debounceMs;
+    uint32_t gen      = screenGen;
+    w.onEvent( id, value );
+
+    // A handler that rebuilt the screen has already drawn everything
+    int      redrawn = 0;
+    [[maybe_unused]] uint32_t px = gen == screenGen ? flushDirty( redrawn ) : ( uint32_t )tft.width() * tft.height();
+    log_i( "[UI] %s #%d: tap to pixels %lu us (%d widgets, %lu px%s)", KIND_NAMES[ kind ], id,
+           ( unsigned long )( micros() - t0 ), redrawn, ( unsigned long )px, gen == screenGen ? "" : ", full screen" );
+
+    if ( debounce ) {
+        touchHoldOff( debounce );
+    }
+    return true;
+}
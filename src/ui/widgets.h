@@ -0,0 +1,83 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "compositor.h"
+#include "../data/app_state.h"
+
+// ---------------------------------------------------------------------------
+// Retained widget tree for the settings screens
+//
+// A screen builds its widgets once (uiBeginScreen + uiAdd* calls) and draws
+// them with uiDrawAll(). Afterwards each widget owns its bounds: setters mark
+// it dirty, uiFlush() erases and repaints only dirty areas, and uiTouch()
+// finds the widget under a tap through a grid of buckets instead of a chain of
+// coordinate checks. Widgets are kept in creation order, which is also their
+// paint order; a widget whose parent panel is hidden is hidden too.
+// ---------------------------------------------------------------------------
+
+constexpr int UI_MAX_WIDGETS = 48;   // Widgets on one screen (hit-test masks are 64 bits)
+constexpr int UI_GRID_CELL   = 40;   // Hit-test bucket size in px (8 × 6 buckets on 320 × 240)
+constexpr int UI_TEXT_MAX    = 16;   // Dynamic label text, including the terminator
+
+constexpr uint16_t UI_THEME_TEXT = 0x0120;  // Colour placeholder: resolve to getTextColor() at draw time
+
+enum UiKind : uint8_t {
+    UI_PANEL,       // Invisible container; hides / shows its children
+    UI_LABEL,
+    UI_BUTTON,
+    UI_TOGGLE,      // Two-state switch, value 0 = left, 1 = right
+    UI_SLIDER,      // Horizontal, value in [minValue, maxValue]
+    UI_LIST         // Scrollable rows, value = first visible item
+};
+
+struct UiWidget;
+typedef void ( *UiDrawFn )( const UiWidget &w );
+typedef void ( *UiEventFn )( int id, int value );   // Button: 0, toggle: new state, slider: new value, list: item
+
+struct UiWidget {
+    UiKind             kind;
+    int8_t             parent;      // Enclosing panel, -1 = screen
+    bool               visible;
+    bool               dirty;
+    Rect               bounds;      // Every pixel the widget draws; also the hit area
+    const char        *text;        // Caption; toggles: left state
+    const char        *altText;     // Toggles: right state
+    uint8_t            font;
+    uint8_t            datum;       // Labels: text anchor within bounds
+    uint16_t           color;       // Border / accent
+    uint16_t           fillColor;
+    uint16_t           textColor;
+    int16_t            value;
+    int16_t            minValue, maxValue;
+    int16_t            tag;         // Free for the screen's handlers
+    const char *const *items;       // List rows
+    const uint16_t    *itemColors;  // List row border colours (nullptr = color)
+    uint8_t            itemCount, rows, rowHeight, rowPitch;
+    uint16_t           debounceMs;  // Presses ignored after a handled tap
+    UiDrawFn           draw;        // Custom renderer, nullptr = default for the kind
+    UiEventFn          onEvent;
+    char               buf[ UI_TEXT_MAX ];
+};
+
+// --- Building ---
+void uiBeginScreen( ScreenState owner );    // Drops the previous screen's widgets
+int  uiAddPanel( int x, int y, int w, int h, int parent = -1 );
+int  uiAddLabel( int x, int y, int w, int h, const char *text, uint8_t font, uint8_t datum, int parent = -1 );
+int  uiAddButton( int x, int y, int w, int h, const char *text, uint16_t color, UiEventFn onTap, int parent = -1 );
+int  uiAddToggle( int x, int y, int w, int h, const char *left, const char *right, bool state, UiEventFn onChange );
+int  uiAddSlider( int x, int y, int w, int h, int minValue, int maxValue, int value, UiEventFn onChange );
+int  uiAddList( int x, int y, int w, const char *const *items, int count, int rows, int rowHeight, int rowPitch, UiEventFn onSelect );
+UiWidget &uiGet( int id );
+
+// --- Updating (each marks the widget dirty only when something changed) ---
+void uiSetValue( int id, int value );
+void uiSetText( int id, const char *text );     // Copied into the widget
+void uiSetVisible( int id, bool visible );
+void uiInvalidate( int id );
+
+// --- Drawing and input ---
+void uiDrawAll();                   // Full repaint of the current screen
+void uiFlush();                     // Repaint dirty widgets only
+int  uiHitTest( int x, int y );     // Topmost interactive widget at (x, y), -1 if none
+bool uiTouch( int x, int y );       // Hit test, dispatch, flush; logs tap → pixels time
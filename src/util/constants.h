@@ -8,6 +8,7 @@
 // WiFi / connectivity
 constexpr unsigned long WIFI_CONNECT_TIMEOUT    = 15000UL;   // Max wait for initial WiFi association
 constexpr unsigned long WIFI_RECONNECT_INTERVAL = 30000UL;   // How often to retry a lost connection
+constexpr unsigned long WIFI_CHECK_INTERVAL     =  2000UL;   // How often loop() looks at the link
 
 // Weather refresh
 constexpr unsigned long WEATHER_UPDATE_INTERVAL    = 1800000UL; // 30 min weather refresh
@@ -15,10 +16,40 @@ constexpr unsigned long BRIGHTNESS_UPDATE_INTERVAL =   60000UL; // How often to
 
 // Touch / UI interaction
 constexpr int TOUCH_DEBOUNCE_MS  = 200;  // Minimum ms between touch events in main loop
-constexpr int UI_DEBOUNCE_MS     = 150;  // Button-tap debounce delay after an action
+constexpr int UI_DEBOUNCE_MS     = 150;  // Presses ignored after a button action (touchHoldOff)
 constexpr int UI_SPLASH_DELAY_MS = 2000; // Duration of splash / status message displays
+constexpr unsigned long UI_MODAL_TIMEOUT_MS = 30000UL; // A modal dialog left alone closes itself
 constexpr int BRIGHT_MIN         = 30;   // Minimum normal brightness (~12%) — keeps screen interactive
 
+// Main loop latency report (worst pass and worst touch handler) and scheduler job stats
+constexpr unsigned long LOOP_STATS_INTERVAL = 60000UL;
+constexpr unsigned long JOB_RETRY_MS        = 10000UL;  // A due weather / version check that cannot run yet
+constexpr unsigned long CLOCK_TICK_SLACK_MS = 5;        // Clock job wakes this far into each new second
+
+// Touch sampling task (hal/touch.h)
+constexpr int TOUCH_SAMPLE_MS   = 10;   // Sample period while the pen is down (100 Hz)
+constexpr int TOUCH_QUEUE_LEN   = 16;   // Events buffered between the task and loop()
+constexpr int TOUCH_STATS_EVERY = 16;   // Presses per touch-to-event latency log line
+
+// Analog clock sweep mode
+constexpr unsigned long SWEEP_FRAME_MS = 40;  // Frame interval for smooth-sweep hands (25 fps)
+
+// Digital clock digit transitions (NVS key "digitFx")
+constexpr int DIGIT_FX_NONE  = 0;  // Digits change in place
+constexpr int DIGIT_FX_SLIDE = 1;  // Old digit slides up, new one rises from below
+constexpr int DIGIT_FX_FLIP  = 2;  // Split-flap: top flap falls, bottom flap unfolds
+constexpr unsigned long DIGIT_FRAME_MS    = 33;  // Transition frame interval (30 fps)
+constexpr int           DIGIT_ANIM_FRAMES = 9;   // Frames per transition (~300 ms)
+
+// Virtualised scrolling lists (country / city / WiFi)
+constexpr int VLIST_FRAME_MS     = 16;  // Scroll animation frame interval
+constexpr int VLIST_STEP_FRAMES  = 6;   // Frames per animated one-row arrow step
+constexpr int VLIST_FLING_MS     = 250; // A swipe coasts on for release speed × this
+constexpr int VLIST_FLING_FRAMES = 10;  // Frames of the decelerating coast
+
+// On-screen keyboard
+constexpr unsigned long KB_FLASH_MS     = 80;  // Pressed-key highlight duration
+
 constexpr unsigned long SETTINGS_INACTIVITY_TIMEOUT = 180000UL; // 3 min — return to CLOCK if no touch while in any settings screen
 
 // OTA
@@ -37,3 +68,8 @@ constexpr int THEME_DARK   = 0;  // Classic dark background
 constexpr int THEME_WHITE  = 1;  // Classic white background
 constexpr int THEME_BLUE   = 2;  // Blue gradient
 constexpr int THEME_YELLOW = 3;  // Yellow gradient
+constexpr int THEME_USER   = 4;  // Palette loaded from data/user_theme.txt
+
+// Theme crossfade (theme swatches and the automatic day/night switch)
+constexpr unsigned long THEME_FADE_MS     = 300;  // Whole crossfade
+constexpr int           THEME_FADE_FRAMES = 8;    // Palette steps within it
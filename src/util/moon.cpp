@@ -2,8 +2,7 @@
 
 #include <math.h>
 
-int getMoonPhase( int y, int m, int d ) {
-    // More accurate moon phase calculation
+double getMoonCycle( int y, int m, int d ) {
     // Based on an astronomical algorithm with accuracy to days
 
     // Calculate Julian Date Number
@@ -28,7 +27,11 @@ int getMoonPhase( int y, int m, int d ) {
     double currentLunation = daysSinceNew / lunationCycle;
 
     // Position in current cycle (0.0 - 1.0)
-    double phasePosition = currentLunation - floor( currentLunation );
+    return currentLunation - floor( currentLunation );
+}
+
+int getMoonPhase( int y, int m, int d ) {
+    double phasePosition = getMoonCycle( y, m, d );
 
     // Convert to 8 phases (0-7) with accurate boundaries
     // Each phase spans 1/8 of the cycle, boundaries are at midpoints
@@ -63,3 +66,7 @@ int getMoonPhase( int y, int m, int d ) {
 
     return phase;
 }
+
+int moonCycleBucket( double cycle ) {
+    return ( int )( cycle * MOON_CYCLE_BUCKETS + 0.5 ) % MOON_CYCLE_BUCKETS;
+}
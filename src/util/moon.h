@@ -4,3 +4,11 @@
 // 0=New, 1=Waxing Crescent, 2=First Quarter, 3=Waxing Gibbous,
 // 4=Full, 5=Waning Gibbous, 6=Last Quarter, 7=Waning Crescent
 int getMoonPhase( int year, int month, int day );
+
+// Returns the position in the lunar cycle for the given date, 0.0–1.0
+// (0 = new, 0.25 = first quarter, 0.5 = full, 0.75 = last quarter).
+double getMoonCycle( int year, int month, int day );
+
+// Quantises a cycle position for the moon icon (~1 day per bucket)
+constexpr int MOON_CYCLE_BUCKETS = 30;
+int moonCycleBucket( double cycle );
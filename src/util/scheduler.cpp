@@ -0,0 +1,200 @@
+#include "scheduler.h"
+
+// ---------------------------------------------------------------------------
+
+static constexpr uint32_t TICK_MASK      = 0xFFFFFFFFUL >> SCHED_TICK_SHIFT;   // Ticks wrap with millis()
+static constexpr uint32_t SLOT_MASK      = SCHED_SLOTS - 1;
+static constexpr uint32_t MAX_SLEEP_MS   = 60000;   // Keeps pdMS_TO_TICKS() in range
+
+static SchedJob    *wheel[ SCHED_SLOTS ];
+static SchedJob    *listed    = nullptr;
+static uint32_t     wheelTick = 0;          // Last tick schedRun() covered
+static uint32_t     runPass   = 0;
+static TaskHandle_t loopTask  = nullptr;
+static uint32_t     wakesEvent = 0, wakesTimer = 0;
+
+static void unlink( SchedJob &job ) {
+    SchedJob **p = &wheel[ job.slot ];
+    while ( *p != nullptr && *p != &job ) {
+        p = &( *p )->next;
+    }
+    if ( *p != nullptr ) {
+        *p = job.next;
+    }
+    job.next  = nullptr;
+    job.armed = false;
+}
+
+static void arm( SchedJob &job, uint32_t due ) {
+    if ( job.armed ) {
+        unlink( job );
+    }
+    if ( !job.listed ) {
+        job.nextListed = listed;
+        listed         = &job;
+        job.listed     = true;
+    }
+    // A deadline already past goes in the current tick's slot, which the
+    // next schedRun() covers
+    uint32_t tick = due >> SCHED_TICK_SHIFT;
+    uint32_t cur  = millis() >> SCHED_TICK_SHIFT;
+    if ( ( int32_t )( due - ( cur << SCHED_TICK_SHIFT ) ) < 0 ) {
+        tick = cur;
+    }
+    job.due           = due;
+    job.slot          = tick & SLOT_MASK;
+    job.next          = wheel[ job.slot ];
+    wheel[ job.slot ] = &job;
+    job.armed         = true;
+}
+
+void schedBegin() {
+    loopTask  = xTaskGetCurrentTaskHandle();
+    wheelTick = millis() >> SCHED_TICK_SHIFT;
+}
+
+void schedAfter( SchedJob &job, uint32_t ms ) {
+    job.periodMs = 0;
+    arm( job, millis() + ms );
+}
+
+void schedEvery( SchedJob &job, uint32_t periodMs ) {
+    schedEvery( job, periodMs, periodMs );
+}
+
+void schedEvery( SchedJob &job, uint32_t periodMs, uint32_t firstMs ) {
+    job.periodMs = periodMs;
+    arm( job, millis() + firstMs );
+}
+
+void schedCancel( SchedJob &job ) {
+    if ( job.armed ) {
+        unlink( job );
+    }
+    job.periodMs = 0;
+}
+
+bool schedArmed( const SchedJob &job ) {
+    return job.armed;
+}
+
+// First job in a slot that is due and has not run in this pass
+static SchedJob *dueIn( uint32_t slot, uint32_t now ) {
+    for ( SchedJob *job = wheel[ slot ]; job != nullptr; job = job->next ) {
+        if ( ( int32_t )( now - job->due ) >= 0 && job->runPass != runPass ) {
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+static void runJob( SchedJob &job, uint32_t now ) {
+    uint32_t period = job.periodMs;
+    uint32_t due    = job.due;
+    unlink( job );
+    job.runPass   = runPass;
+    job.lateMaxMs = max( job.lateMaxMs, now - due );
+
+    uint32_t t0 = micros();
+    job.fn();
+    uint32_t us = micros() - t0;
+
+    job.runs++;
+    job.totalUs  += us;
+    job.maxUs     = max( job.maxUs, us );
+
+    // Periodic and left alone by its function: next period, skipping any it overran
+    if ( period != 0 && job.periodMs == period && !job.armed ) {
+        uint32_t next = due + period;
+        if ( ( int32_t )( next - millis() ) <= 0 ) {
+            next = millis() + period;
+        }
+        arm( job, next );
+    }
+}
+
+int schedRun() {
+    uint32_t now     = millis();
+    uint32_t nowTick = now >> SCHED_TICK_SHIFT;
+    uint32_t span    = min( ( nowTick - wheelTick ) & TICK_MASK, SLOT_MASK );
+    int      ran     = 0;
+    runPass++;
+    for ( uint32_t i = 0; i <= span; i++ ) {
+        uint32_t  slot = ( wheelTick + i ) & SLOT_MASK;
+        SchedJob *job;
+        while ( ( job = dueIn( slot, now ) ) != nullptr ) {
+            runJob( *job, now );
+            ran++;
+        }
+    }
+    wheelTick = nowTick;
+    return ran;
+}
+
+// ms to the nearest deadline: the first slot ahead holding a job due within
+// its tick has it; past one turn, the nearest of all armed jobs
+static uint32_t msToNext() {
+    uint32_t now = millis();
+    for ( uint32_t i = 0; i < SCHED_SLOTS; i++ ) {
+        uint32_t tick  = ( wheelTick + i ) & TICK_MASK;
+        uint32_t end   = ( tick + 1 ) << SCHED_TICK_SHIFT;
+        bool     found = false;
+        int32_t  best  = 0;
+        for ( SchedJob *job = wheel[ tick & SLOT_MASK ]; job != nullptr; job = job->next ) {
+            if ( ( int32_t )( job->due - end ) < 0 ) {
+                int32_t d = ( int32_t )( job->due - now );
+                best      = found ? min( best, d ) : d;
+                found     = true;
+            }
+        }
+        if ( found ) {
+            return best < 0 ? 0 : ( uint32_t )best;
+        }
+    }
+    uint32_t best = UINT32_MAX;
+    for ( SchedJob *job = listed; job != nullptr; job = job->nextListed ) {
+        if ( job->armed ) {
+            int32_t d = ( int32_t )( job->due - now );
+            best      = min( best, d < 0 ? 0 : ( uint32_t )d );
+        }
+    }
+    return best;
+}
+
+void schedSleep() {
+    uint32_t ms = min( msToNext(), MAX_SLEEP_MS );
+    if ( ms == 0 ) {
+        return;
+    }
+    // One tick over, so the deadline has passed on waking
+    if ( ulTaskNotifyTake( pdTRUE, pdMS_TO_TICKS( ms ) + 1 ) != 0 ) {
+        wakesEvent++;
+    }
+    else {
+        wakesTimer++;
+    }
+}
+
+void schedWake() {
+    if ( loopTask != nullptr ) {
+        xTaskNotifyGive( loopTask );
+    }
+}
+
+void schedStatsLog() {
+    log_i( "[SCHED] %lu wakes: %lu by events, %lu by deadlines", ( unsigned long )( wakesEvent + wakesTimer ),
+           ( unsigned long )wakesEvent, ( unsigned long )wakesTimer );
+    wakesEvent = wakesTimer = 0;
+    for ( SchedJob *job = listed; job != nullptr; job = job->nextListed ) {
+        if ( job->runs == 0 ) {
+            continue;
+        }
+        log_i( "[SCHED] %-12s %5lu runs, avg %6lu us, max %7lu us, late max %4lu ms", job->name,
+               ( unsigned long )job->runs, ( unsigned long )( job->totalUs / job->runs ), ( unsigned long )job->maxUs,
+               ( unsigned long )job->lateMaxMs );
+        job->runs      = 0;
+        job->totalUs   = 0;
+        job->maxUs     = 0;
+        job->lateMaxMs = 0;
+    }
+}
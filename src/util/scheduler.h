@@ -0,0 +1,62 @@
+#pragma once
+
+#include <Arduino.h>
+
+// ---------------------------------------------------------------------------
+// Cooperative job scheduler for loop()
+//
+// A job is a SchedJob owned by the module that runs it, armed with a delay
+// (one-shot) or a period. Armed jobs hang off a hashed timer wheel of
+// SCHED_SLOTS slots, SCHED_TICK_MS apart; a deadline further out than one
+// turn of the wheel waits in its slot until its turn comes round. schedRun()
+// runs what is due, schedSleep() blocks the loop task until the next deadline
+// or a schedWake() from another task (the touch task wakes it per event).
+//
+// Jobs run in loop() context, one at a time, and may arm or cancel any job
+// including themselves. A periodic job is re-armed one period after its
+// deadline (or after now, if it overran a whole period) unless it re-armed
+// or cancelled itself. Run count, time and lateness are kept per job and
+// logged by schedStatsLog().
+//
+// Not thread-safe: only schedWake() may be called from other tasks.
+// ---------------------------------------------------------------------------
+
+constexpr uint32_t SCHED_TICK_SHIFT = 3;                        // 8 ms ticks: a power of two, so
+constexpr uint32_t SCHED_TICK_MS    = 1UL << SCHED_TICK_SHIFT;  // the wheel turns evenly across the
+constexpr int      SCHED_SLOTS      = 64;                       // millis() wrap; one turn = 512 ms
+
+typedef void ( *SchedFn )();
+
+// Declared as { "name", fn }; the scheduler owns the rest
+struct SchedJob {
+    const char *name;
+    SchedFn     fn;
+
+    // Scheduler bookkeeping
+    uint32_t    due        = 0;         // millis() deadline
+    uint32_t    periodMs   = 0;         // 0 = one-shot
+    SchedJob   *next       = nullptr;   // Slot list
+    SchedJob   *nextListed = nullptr;   // Every job ever armed, for the stats
+    uint32_t    runPass    = 0;
+    uint16_t    slot       = 0;
+    bool        armed      = false;
+    bool        listed     = false;
+    uint32_t    runs       = 0;
+    uint32_t    totalUs    = 0;
+    uint32_t    maxUs      = 0;
+    uint32_t    lateMaxMs  = 0;
+};
+
+void schedBegin();      // From the loop task, before the first schedSleep()
+
+void schedAfter( SchedJob &job, uint32_t ms );                  // One-shot; re-arms if armed
+void schedEvery( SchedJob &job, uint32_t periodMs );            // First run one period from now
+void schedEvery( SchedJob &job, uint32_t periodMs, uint32_t firstMs );
+void schedCancel( SchedJob &job );
+bool schedArmed( const SchedJob &job );
+
+int  schedRun();        // Runs due jobs; returns how many ran
+void schedSleep();      // Until the next deadline or schedWake(); returns at once if a job is due
+void schedWake();       // Any task (not ISRs)
+
+void schedStatsLog();   // Per-job stats since the last call, then clears them
@@ -0,0 +1,77 @@
+#include "trig.h"
+
+#ifdef TRIG_BENCHMARK
+
+#include <Arduino.h>
+#include <math.h>
+
+static volatile int32_t benchSink;  // Keeps the optimiser from discarding the loops
+
+// One analog frame of geometry: 60 ticks (two endpoints each), 12 numerals,
+// 3 hands. Mirrors the original code, which called double cos()/sin().
+static int32_t frameFloat( int seed, int r ) {
+    const float degToRad = ( float )( PI / 180.0 );
+    int32_t acc = 0;
+    for ( int i = 0; i < 60; i++ ) {
+        float ang = ( i * 6 + seed - 90 ) * degToRad;
+        int r1 = ( i % 5 == 0 ) ? ( r - 10 ) : ( r - 5 );
+        acc += ( int )( cos( ang ) * r ) + ( int )( sin( ang ) * r ) + ( int )( cos( ang ) * r1 ) + ( int )( sin( ang ) * r1 );
+    }
+    for ( int n = 1; n <= 12; n++ ) {
+        float ang = ( n * 30 + seed - 90 ) * degToRad;
+        acc += ( int )( cos( ang ) * ( r - 22 ) ) + ( int )( sin( ang ) * ( r - 22 ) );
+    }
+    for ( int h = 0; h < 3; h++ ) {
+        float ang = ( h * 97 + seed ) * degToRad;
+        acc += ( int )( cos( ang ) * ( r - 14 ) ) + ( int )( sin( ang ) * ( r - 14 ) );
+    }
+    return acc;
+}
+
+static int32_t frameTable( int seed, int r ) {
+    int32_t acc = 0;
+    for ( int i = 0; i < 60; i++ ) {
+        int32_t a = ( i * 6 + seed - 90 ) * TRIG_DIV;
+        int r1 = ( i % 5 == 0 ) ? ( r - 10 ) : ( r - 5 );
+        acc += polarX( 0, r, a ) + polarY( 0, r, a ) + polarX( 0, r1, a ) + polarY( 0, r1, a );
+    }
+    for ( int n = 1; n <= 12; n++ ) {
+        int32_t a = ( n * 30 + seed - 90 ) * TRIG_DIV;
+        acc += polarX( 0, r - 22, a ) + polarY( 0, r - 22, a );
+    }
+    for ( int h = 0; h < 3; h++ ) {
+        int32_t a = ( h * 97 + seed ) * TRIG_DIV;
+        acc += polarX( 0, r - 14, a ) + polarY( 0, r - 14, a );
+    }
+    return acc;
+}
+
+void trigBenchmark() {
+    const int frames = 500;
+    const int r      = 67;
+
+    uint32_t t0 = micros();
+    for ( int f = 0; f < frames; f++ ) {
+        benchSink = frameFloat( f % 60, r );
+    }
+    uint32_t tFloat = micros() - t0;
+
+    t0 = micros();
+    for ( int f = 0; f < frames; f++ ) {
+        benchSink = frameTable( f % 60, r );
+    }
+    uint32_t tTable = micros() - t0;
+
+    // Worst-case disagreement between the two over every whole degree
+    int maxErr = 0;
+    for ( int deg = 0; deg < 360; deg++ ) {
+        int ref = ( int )lround( cos( deg * PI / 180.0 ) * r );
+        int err = abs( polarX( 0, r, deg * TRIG_DIV ) - ref );
+        maxErr = max( maxErr, err );
+    }
+
+    log_i( "[TRIG] Dial geometry per frame: libm %lu us, Q15 table %lu us (max error %d px at r=%d)",
+           ( unsigned long )( tFloat / frames ), ( unsigned long )( tTable / frames ), maxErr, r );
+}
+
+#endif
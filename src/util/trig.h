@@ -0,0 +1,131 @@
+#pragma once
+
+#include <stdint.h>
+
+// ============================================================
+// Fixed-point trigonometry for dial and icon geometry
+//
+// Angles are in tenths of a degree ("deci-degrees"): 0 = +x axis, increasing
+// clockwise on screen (y grows downward), so 12 o'clock is -900 / 2700.
+// Sine/cosine results are Q15 (32767 ≈ 1.0). Tables are generated at compile
+// time and live in flash; no libm calls at runtime.
+// ============================================================
+
+constexpr int     TRIG_DIV     = 10;              // Table steps per degree (0.1° resolution)
+constexpr int     TRIG_QUARTER = 90 * TRIG_DIV;   // Steps in a quarter turn
+constexpr int     TRIG_FULL    = 360 * TRIG_DIV;  // Steps in a full turn
+constexpr int32_t Q15_ONE      = 32767;
+
+// --- Compile-time generators (not for runtime use) ---
+constexpr double trigGenSin( double x ) {
+    // Taylor series; x is within [0, pi/2] so 12 terms are exact to double precision
+    double term = x, sum = x;
+    for ( int n = 1; n < 12; n++ ) {
+        term *= -x * x / ( ( 2 * n ) * ( 2 * n + 1 ) );
+        sum  += term;
+    }
+    return sum;
+}
+
+constexpr uint32_t isqrt32( uint32_t n ) {
+    uint32_t res = 0;
+    uint32_t bit = 1UL << 30;
+    while ( bit > n ) {
+        bit >>= 2;
+    }
+    while ( bit != 0 ) {
+        if ( n >= res + bit ) {
+            n  -= res + bit;
+            res = ( res >> 1 ) + bit;
+        }
+        else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return res;     // floor( sqrt( n ) )
+}
+
+// Quarter-wave sine table, 0..90° inclusive
+struct SineTableQ15 {
+    int16_t v[ TRIG_QUARTER + 1 ];
+    constexpr SineTableQ15() : v() {
+        for ( int i = 0; i <= TRIG_QUARTER; i++ ) {
+            v[ i ] = ( int16_t )( trigGenSin( i * 3.14159265358979323846 / ( 2.0 * TRIG_QUARTER ) ) * Q15_ONE + 0.5 );
+        }
+    }
+};
+inline constexpr SineTableQ15 SINE_Q15{};
+
+// Circle half-width table: CIRCLE_SPAN.v[ r ][ |dy| ] = floor( sqrt( r² - dy² ) )
+constexpr int SPAN_MAX_R = 32;  // Largest radius served from the table (icons, moon)
+
+struct CircleSpanTable {
+    uint8_t v[ SPAN_MAX_R + 1 ][ SPAN_MAX_R + 1 ];
+    constexpr CircleSpanTable() : v() {
+        for ( int r = 0; r <= SPAN_MAX_R; r++ ) {
+            for ( int dy = 0; dy <= r; dy++ ) {
+                v[ r ][ dy ] = ( uint8_t )isqrt32( ( uint32_t )( r * r - dy * dy ) );
+            }
+        }
+    }
+};
+inline constexpr CircleSpanTable CIRCLE_SPAN{};
+
+// --- Runtime API ---
+
+// Sine of a deci-degree angle (any integer, wraps), Q15
+inline int16_t isin( int32_t deci ) {
+    deci %= TRIG_FULL;
+    if ( deci < 0 ) {
+        deci += TRIG_FULL;
+    }
+    if ( deci <= TRIG_QUARTER ) {
+        return SINE_Q15.v[ deci ];
+    }
+    if ( deci <= 2 * TRIG_QUARTER ) {
+        return SINE_Q15.v[ 2 * TRIG_QUARTER - deci ];
+    }
+    if ( deci <= 3 * TRIG_QUARTER ) {
+        return -SINE_Q15.v[ deci - 2 * TRIG_QUARTER ];
+    }
+    return -SINE_Q15.v[ TRIG_FULL - deci ];
+}
+
+// Cosine of a deci-degree angle, Q15
+inline int16_t icos( int32_t deci ) {
+    return isin( deci + TRIG_QUARTER );
+}
+
+// v × q15 rounded to the nearest integer
+inline int32_t q15Mul( int32_t v, int32_t q15 ) {
+    return ( v * q15 + ( 1 << 14 ) ) >> 15;
+}
+
+// Point at distance r from a centre along a deci-degree angle
+inline int polarX( int cx, int r, int32_t deci ) {
+    return cx + q15Mul( r, icos( deci ) );
+}
+inline int polarY( int cy, int r, int32_t deci ) {
+    return cy + q15Mul( r, isin( deci ) );
+}
+
+// Half-width of a circle of radius r at row offset dy: floor( sqrt( r² - dy² ) ).
+// Returns -1 when the row is outside the circle.
+inline int circleSpan( int r, int dy ) {
+    if ( dy < 0 ) {
+        dy = -dy;
+    }
+    if ( dy > r ) {
+        return -1;
+    }
+    if ( r <= SPAN_MAX_R ) {
+        return CIRCLE_SPAN.v[ r ][ dy ];
+    }
+    return ( int )isqrt32( ( uint32_t )( r * r - dy * dy ) );
+}
+
+#ifdef TRIG_BENCHMARK
+// Times one frame of dial geometry with libm vs. the tables and logs both
+void trigBenchmark();
+#endif